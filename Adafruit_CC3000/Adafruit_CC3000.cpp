@@ -1370,6 +1370,8 @@ Adafruit_CC3000_Client Adafruit_CC3000::connectUDP(uint32_t destIP, uint16_t des
 /**********************************************************************/
 Adafruit_CC3000_Client::Adafruit_CC3000_Client(void) {
   _socket = -1;
+  bufsiz = 0;
+  _rx_buf_idx = 0;
 }
 
 Adafruit_CC3000_Client::Adafruit_CC3000_Client(uint16_t s) {
@@ -1498,8 +1500,18 @@ size_t Adafruit_CC3000_Client::fastrprintln(char *str) {
 
 int16_t Adafruit_CC3000_Client::read(void *buf, uint16_t len, uint32_t flags) 
 {
-  return recv(_socket, buf, len, flags);
-
+  if ((bufsiz > 0) && (_rx_buf_idx < bufsiz)) {
+    // Hand over what's already buffered first, so nothing comes out of order
+    uint16_t n = bufsiz - _rx_buf_idx;
+    if (n > len) n = len;
+    memcpy(buf, _rx_buf + _rx_buf_idx, n);
+    _rx_buf_idx += n;
+    return n;
+  }
+
+  // Nothing buffered: receive straight into the caller's buffer
+  if (len > RXMAXRECV) len = RXMAXRECV;
+  return recvInto(buf, len, flags);
 }
 
 int32_t Adafruit_CC3000_Client::close(void) {
@@ -1513,13 +1525,11 @@ uint8_t Adafruit_CC3000_Client::read(void)
   while ((bufsiz <= 0) || (bufsiz == _rx_buf_idx)) {
     cc3k_int_poll();
     // buffer in some more data
-    bufsiz = recv(_socket, _rx_buf, sizeof(_rx_buf), 0);
-    if (bufsiz == -57) {
+    if (fillRxBuffer() == -57) {
       close();
       return 0;
     }
     //if (CC3KPrinter != 0) { CC3KPrinter->println("Read "); CC3KPrinter->print(bufsiz); CC3KPrinter->println(" bytes"); }
-    _rx_buf_idx = 0;
   }
   uint8_t ret = _rx_buf[_rx_buf_idx];
   _rx_buf_idx++;
@@ -1531,25 +1541,55 @@ uint8_t Adafruit_CC3000_Client::available(void) {
   // not open!
   if (_socket < 0) return 0;
 
-  if ((bufsiz > 0) // we have some data in the internal buffer
-      && (_rx_buf_idx < bufsiz)) {  // we havent already spit it all out
-    return (bufsiz - _rx_buf_idx);
+  if ((bufsiz <= 0) // nothing in the internal buffer
+      || (_rx_buf_idx >= bufsiz)) {  // or we've already spit it all out
+    // do a select() call on this socket
+    timeval timeout;
+    fd_set fd_read;
+
+    memset(&fd_read, 0, sizeof(fd_read));
+    FD_SET(_socket, &fd_read);
+
+    timeout.tv_sec = 0;
+    timeout.tv_usec = 5000; // 5 millisec
+
+    int16_t s = select(_socket+1, &fd_read, NULL, NULL, &timeout);
+    //if (CC3KPrinter != 0) } CC3KPrinter->print(F("Select: ")); CC3KPrinter->println(s); }
+    if (s != 1) return 0;  // no data is available
+
+    // Some data is available to read: buffer it now, so we can say how much
+    // there is rather than just that there's some
+    if (fillRxBuffer() == -57) {
+      close();
+      return 0;
+    }
+    if (bufsiz <= 0) return 0;
   }
 
-  // do a select() call on this socket
-  timeval timeout;
-  fd_set fd_read;
+  uint16_t n = bufsiz - _rx_buf_idx;
+  return (n > 255) ? 255 : n;
+}
 
-  memset(&fd_read, 0, sizeof(fd_read));
-  FD_SET(_socket, &fd_read);
+// recv() with the data read off SPI straight into buf, rather than into
+// spi_buffer and copied from there, so len isn't limited by spi_buffer's size
+int16_t Adafruit_CC3000_Client::recvInto(void *buf, uint16_t len, uint32_t flags)
+{
+  tSpiRxSink sink;
+  sink.pBuf = (unsigned char *)buf;
+  sink.usLength = len;
 
-  timeout.tv_sec = 0;
-  timeout.tv_usec = 5000; // 5 millisec
+  pSpiRxSink = &sink;
+  int16_t n = recv(_socket, buf, len, flags);
+  pSpiRxSink = NULL;
+  return n;
+}
 
-  int16_t s = select(_socket+1, &fd_read, NULL, NULL, &timeout);
-  //if (CC3KPrinter != 0) } CC3KPrinter->print(F("Select: ")); CC3KPrinter->println(s); }
-  if (s == 1) return 1;  // some data is available to read
-  else return 0;  // no data is available
+// Refill the internal buffer, once it's all been read
+int16_t Adafruit_CC3000_Client::fillRxBuffer(void)
+{
+  bufsiz = recvInto(_rx_buf, RXBUFFERSIZE, 0);
+  _rx_buf_idx = 0;
+  return bufsiz;
 }
 
 void Adafruit_CC3000::setPrinter(Print* p) {
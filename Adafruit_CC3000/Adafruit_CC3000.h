@@ -46,7 +46,8 @@
 #endif
 
 #define WLAN_CONNECT_TIMEOUT 10000  // how long to wait, in milliseconds
-#define RXBUFFERSIZE  64 // how much to buffer on the incoming side
+#define RXBUFFERSIZE  64 // how much to buffer on the incoming side (read() and available())
+#define RXMAXRECV   1460 // most a bulk read(buf, len) asks the CC3000 for at once (one TCP segment)
 #define TXBUFFERSIZE  32 // how much to buffer on the outgoing side
 
 #define WIFI_ENABLE 1
@@ -101,12 +102,18 @@ class Adafruit_CC3000_Client : public Print {
   int32_t close(void);
   uint8_t available(void);
 
-  uint8_t _rx_buf[RXBUFFERSIZE], _rx_buf_idx;
+  // Received bytes not yet read are _rx_buf[_rx_buf_idx] up to _rx_buf[bufsiz].
+  // They're read into it straight from SPI, and bulk reads skip it once it's empty.
+  uint8_t _rx_buf[RXBUFFERSIZE];
+  uint16_t _rx_buf_idx;
   int16_t bufsiz;
 
  private:
   int16_t _socket;
 
+  int16_t recvInto(void *buf, uint16_t len, uint32_t flags);
+  int16_t fillRxBuffer(void);
+
 };
 
 // Ugly but necessary to include the server header after the client is fully defined.
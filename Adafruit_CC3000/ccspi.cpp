@@ -153,6 +153,7 @@ void cc3k_int_poll(void);
 
 char spi_buffer[CC3000_RX_BUFFER_SIZE];
 unsigned char wlan_tx_buffer[CC3000_TX_BUFFER_SIZE];
+tSpiRxSink *pSpiRxSink = NULL;
 
 static volatile char ccspi_is_in_irq = 0;
 static volatile char ccspi_int_enabled = 0;
@@ -425,6 +426,26 @@ void SpiReadDataSynchronous(unsigned char *data, unsigned short size)
   DEBUGPRINT_F("\n\r");
 }
 
+/**************************************************************************/
+/*!
+    Read the payload of a data packet into pSpiRxSink, dropping anything
+    that doesn't fit (there shouldn't be any, as recv() asks for no more)
+ */
+/**************************************************************************/
+void SpiReadDataToSink(unsigned short size)
+{
+  unsigned short n;
+  unsigned char discard;
+
+  n = (size < pSpiRxSink->usLength) ? size : pSpiRxSink->usLength;
+  SpiReadDataSynchronous(pSpiRxSink->pBuf, n);
+  size -= n;
+  while (size--)
+  {
+    SpiReadDataSynchronous(&discard, 1);
+  }
+}
+
 /**************************************************************************/
 /*!
 
@@ -465,7 +486,23 @@ long SpiReadDataCont(void)
           data_to_recv++;
         }
 
-        if (data_to_recv)
+        if (pSpiRxSink && data_to_recv)
+        {
+          /* Only the arguments go in spi_buffer; the payload goes straight where
+             it's wanted, so it isn't copied again and can be bigger than spi_buffer */
+          unsigned char args;
+          unsigned short length;
+          STREAM_TO_UINT8((char *)(evnt_buff + SPI_HEADER_SIZE), HCI_PACKET_ARGSIZE_OFFSET, args);
+          STREAM_TO_UINT16((char *)(evnt_buff + SPI_HEADER_SIZE), HCI_PACKET_LENGTH_OFFSET, length);
+          SpiReadDataSynchronous(evnt_buff + HEADERS_SIZE_EVNT, args);
+          SpiReadDataToSink(length - args);
+          if (data_to_recv > length)
+          {
+            /* padding byte */
+            SpiReadDataSynchronous(evnt_buff + HEADERS_SIZE_EVNT + args, 1);
+          }
+        }
+        else if (data_to_recv)
         {
           SpiReadDataSynchronous(evnt_buff + HEADERS_SIZE_EVNT, data_to_recv);
         }
@@ -61,7 +61,16 @@
 typedef void (*gcSpiHandleRx)(void *p);
 typedef void (*gcSpiHandleTx)(void);
 
+/* Where the payload of a received data packet goes when it's read straight off
+   the SPI bus instead of through spi_buffer.  Set pSpiRxSink around a recv() */
+typedef struct
+{
+  unsigned char *pBuf;
+  unsigned short usLength;
+} tSpiRxSink;
+
 extern unsigned char wlan_tx_buffer[];
+extern tSpiRxSink *pSpiRxSink;
 
 //*****************************************************************************
 //
@@ -0,0 +1,177 @@
+/*************************************************** 
+  Client_readThroughput test
+
+  Designed specifically to work with the Adafruit WiFi products:
+  ----> https://www.adafruit.com/products/1469
+
+  Adafruit invests time and resources providing this open source code, 
+  please support Adafruit and open-source hardware by purchasing 
+  products from Adafruit!
+
+  Based on the Client_fastrprint test and example code written by
+  Limor Fried & Kevin Townsend for Adafruit Industries.  
+  BSD license, all text above must be included in any redistribution
+ ****************************************************/
+ 
+#include <Adafruit_CC3000.h>
+#include <ccspi.h>
+#include <SPI.h>
+#include <string.h>
+#include "utility/debug.h"
+
+// These are the interrupt and control pins
+#define ADAFRUIT_CC3000_IRQ   3  // MUST be an interrupt pin!
+// These can be any two pins
+#define ADAFRUIT_CC3000_VBAT  5
+#define ADAFRUIT_CC3000_CS    10
+// Use hardware SPI for the remaining pins
+// On an UNO, SCK = 13, MISO = 12, and MOSI = 11
+Adafruit_CC3000 cc3000 = Adafruit_CC3000(ADAFRUIT_CC3000_CS, ADAFRUIT_CC3000_IRQ, ADAFRUIT_CC3000_VBAT,
+                                         SPI_CLOCK_DIV2); // you can change this clock speed
+
+#define WLAN_SSID       "myNetwork"           // cannot be longer than 32 characters!
+#define WLAN_PASS       "myPassword"
+
+// Security can be WLAN_SEC_UNSEC, WLAN_SEC_WEP, WLAN_SEC_WPA or WLAN_SEC_WPA2
+#define WLAN_SECURITY   WLAN_SEC_WPA2
+
+// Test server configuration
+const uint8_t   SERVER_IP[4]   = { 192, 168, 1, 101 };
+const uint16_t  SERVER_PORT    = 9001;
+
+// How much sender.py sends on each connection, and how long to wait for it
+const uint32_t  TEST_BYTES     = 65536;
+const uint32_t  TEST_TIMEOUT   = 60000;
+
+// Big enough for the largest bulk read tested (one TCP segment), so this
+// wants a board with more than 2K of RAM, e.g. a Mega
+uint8_t buf[RXMAXRECV];
+
+// Byte i of what sender.py sends
+uint8_t expected(uint32_t i) {
+  return (uint8_t)(i * 7 + 3 + (i >> 8));
+}
+
+// Read everything sender.py sends on a new connection, either a byte at a
+// time with available() and read() (chunk = 0) or chunk bytes at a time
+// with read(buf, chunk), and report how fast it came in
+void timeRead(uint16_t chunk) {
+  Adafruit_CC3000_Client client = cc3000.connectTCP(cc3000.IP2U32(SERVER_IP[0], SERVER_IP[1], SERVER_IP[2], SERVER_IP[3]), 
+                                                    SERVER_PORT);
+  if (!client.connected()) {
+    Serial.println(F("Couldn't connect to server! Make sure sender.py is running on the server."));
+    return;
+  }
+
+  uint32_t count = 0, errors = 0;
+  unsigned long start = millis();
+  while ((count < TEST_BYTES) && (millis() - start < TEST_TIMEOUT)) {
+    if (chunk == 0) {
+      if (client.available()) {
+        if (client.read() != expected(count)) errors++;
+        count++;
+      }
+    } else {
+      int16_t n = client.read(buf, chunk);
+      if (n < 0) break;
+      for (int16_t i = 0; i < n; i++) {
+        if (buf[i] != expected(count + i)) errors++;
+      }
+      count += n;
+    }
+  }
+  unsigned long elapsed = millis() - start;
+  client.close();
+
+  if (chunk == 0) {
+    Serial.print(F("available()/read():  "));
+  } else {
+    Serial.print(F("read(buf, ")); Serial.print(chunk, DEC); Serial.print(F("): "));
+  }
+  Serial.print(count, DEC); Serial.print(F(" bytes in "));
+  Serial.print(elapsed, DEC); Serial.print(F(" ms, "));
+  Serial.print(count / (elapsed ? elapsed : 1), DEC); Serial.println(F(" KB/s"));
+  if (count != TEST_BYTES) {
+    Serial.print(F("FAILURE: Expected ")); Serial.print(TEST_BYTES, DEC); Serial.println(F(" bytes"));
+  }
+  if (errors) {
+    Serial.print(F("FAILURE: ")); Serial.print(errors, DEC); Serial.println(F(" bytes wrong"));
+  }
+}
+
+// Run the test
+void runTest(void) {
+  Serial.print(F("Free RAM: ")); Serial.println(getFreeRam(), DEC);
+  Serial.println(F("Starting tests..."));
+
+  timeRead(0);
+  timeRead(64);
+  timeRead(512);
+  timeRead(RXMAXRECV);
+
+  Serial.println(F("Tests finished!"));
+  cc3000.disconnect();
+}
+
+// Set up the HW and the CC3000 module (called automatically on startup)
+void setup(void)
+{
+  Serial.begin(115200);
+  Serial.println(F("Hello, CC3000!\n")); 
+  
+  /* Initialise the module */
+  Serial.println(F("\nInitializing..."));
+  if (!cc3000.begin())
+  {
+    Serial.println(F("Couldn't begin()! Check your wiring?"));
+    while(1);
+  }
+  
+  if (!cc3000.connectToAP(WLAN_SSID, WLAN_PASS, WLAN_SECURITY)) {
+    Serial.println(F("Failed!"));
+    while(1);
+  }
+   
+  Serial.println(F("Connected!"));
+  
+  /* Wait for DHCP to complete */
+  Serial.println(F("Request DHCP"));
+  while (!cc3000.checkDHCP())
+  {
+    delay(100); // ToDo: Insert a DHCP timeout!
+  }  
+
+  /* Display the IP address DNS, Gateway, etc. */  
+  while (! displayConnectionDetails()) {
+    delay(1000);
+  }
+  
+  runTest();
+}
+
+void loop(void)
+{
+ delay(1000);
+}
+
+// Tries to read the IP address and other connection details
+bool displayConnectionDetails(void)
+{
+  uint32_t ipAddress, netmask, gateway, dhcpserv, dnsserv;
+  
+  if(!cc3000.getIPAddress(&ipAddress, &netmask, &gateway, &dhcpserv, &dnsserv))
+  {
+    Serial.println(F("Unable to retrieve the IP Address!\r\n"));
+    return false;
+  }
+  else
+  {
+    Serial.print(F("\nIP Addr: ")); cc3000.printIPdotsRev(ipAddress);
+    Serial.print(F("\nNetmask: ")); cc3000.printIPdotsRev(netmask);
+    Serial.print(F("\nGateway: ")); cc3000.printIPdotsRev(gateway);
+    Serial.print(F("\nDHCPsrv: ")); cc3000.printIPdotsRev(dhcpserv);
+    Serial.print(F("\nDNSserv: ")); cc3000.printIPdotsRev(dnsserv);
+    Serial.println();
+    return true;
+  }
+}
@@ -0,0 +1,49 @@
+# Adafruit CC3000 Library Test Sender
+# Released with the same license as the Adafruit CC3000 library (BSD)
+
+# Create a simple server to listen by default on port 9001 (or on the port specified in
+# the first command line parameter), accept any connections and send each one a block of
+# test data, 65536 bytes by default (or the size in the second command line parameter),
+# then close it.  Byte i of the data is (i * 7 + 3 + i / 256) % 256 so the client can check
+# what it read.  Must be terminated by hitting ctrl-c to kill the process!
+
+from socket import *
+import sys
+import threading
+
+SERVER_PORT = 9001
+if len(sys.argv) > 1:
+	SERVER_PORT = int(sys.argv[1])
+SEND_SIZE = 65536
+if len(sys.argv) > 2:
+	SEND_SIZE = int(sys.argv[2])
+
+# Build the test data once.
+data = bytearray((i * 7 + 3 + (i >> 8)) & 0xFF for i in range(SEND_SIZE))
+
+# Create listening socket
+server = socket(AF_INET, SOCK_STREAM)
+
+# Ignore waiting for the socket to close if it's already open.  See the python socket
+# doc for more info (very bottom of http://docs.python.org/2/library/socket.html).
+server.setsockopt(SOL_SOCKET, SO_REUSEADDR, 1)
+
+# Listen on any network interface for the specified port
+server.bind(('', SERVER_PORT))
+server.listen(5)
+
+# Worker process to send the test data then close the connection.
+def process_connection(client, address):
+	client.sendall(bytes(data))
+	client.close()
+	sys.stdout.write('Sent %d bytes to %s\n' % (SEND_SIZE, address[0]))
+	sys.stdout.flush()
+
+try:
+	# Wait for connections and spawn worker threads to process them.
+	while True:
+		client, address = server.accept()
+		thread = threading.Thread(target=process_connection, args=(client, address))
+		thread.start()
+except:
+	server.close()
@@ -466,8 +466,12 @@ hci_event_handler(void *pRetParams, unsigned char *from, unsigned char *fromlen)
 					memcpy(from, (pucReceivedData + HCI_DATA_HEADER_SIZE + BSD_RECV_FROM_FROM_OFFSET) ,*fromlen);
 				}
 
-				memcpy(pRetParams, pucReceivedParams + HCI_DATA_HEADER_SIZE + ucArgsize,
-							 usLength - ucArgsize);
+				// With a sink set the data was read straight into it off SPI
+				if (pSpiRxSink == NULL)
+				{
+					memcpy(pRetParams, pucReceivedParams + HCI_DATA_HEADER_SIZE + ucArgsize,
+								 usLength - ucArgsize);
+				}
 
 				tSLInformation.usRxDataPending = 0;
 			}
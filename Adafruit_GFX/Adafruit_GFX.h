@@ -77,6 +77,19 @@ class Adafruit_GFX : public Print {
   int16_t getCursorY(void) const;
 
  protected:
+  // Map a point in rotation r's coordinates onto the raw w x h display.
+  // Drivers built for one fixed orientation pass r as a constant so the
+  // switch folds away at compile time.
+  template <uint8_t r> static inline void
+    rotateToRaw(int16_t &x, int16_t &y, int16_t w, int16_t h) {
+      int16_t t;
+      switch(r & 3) {
+       case 1: t = x; x = w - 1 - y; y = t; break;
+       case 2: x = w - 1 - x; y = h - 1 - y; break;
+       case 3: t = x; x = y; y = h - 1 - t; break;
+      }
+    }
+
   const int16_t
     WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
   int16_t
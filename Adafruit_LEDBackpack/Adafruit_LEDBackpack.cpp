@@ -198,6 +198,7 @@ void Adafruit_LEDBackpack::blinkRate(uint8_t b) {
 }
 
 Adafruit_LEDBackpack::Adafruit_LEDBackpack(void) {
+  resend = true;
 }
 
 void Adafruit_LEDBackpack::begin(uint8_t _addr = 0x70) {
@@ -212,6 +213,7 @@ void Adafruit_LEDBackpack::begin(uint8_t _addr = 0x70) {
   // ensure RAM is cleared before turning on display
   // SRG changed, see: https://github.com/adafruit/Adafruit-LED-Backpack-Library/issues/20
   clear();
+  invalidate();
   writeDisplay();
 
   blinkRate(HT16K33_BLINK_OFF);
@@ -220,14 +222,72 @@ void Adafruit_LEDBackpack::begin(uint8_t _addr = 0x70) {
 }
 
 void Adafruit_LEDBackpack::writeDisplay(void) {
-  Wire.beginTransmission(i2c_addr);
-  Wire.write((uint8_t)0x00); // start at address $00
+  sendDisplay(true);
+}
 
-  for (uint8_t i=0; i<8; i++) {
-    Wire.write(displaybuffer[i] & 0xFF);    
-    Wire.write(displaybuffer[i] >> 8);    
+void Adafruit_LEDBackpack::invalidate(void) {
+  resend = true;
+}
+
+// Index of the first row at or after 'row' that differs from what the
+// HT16K33 has, or 8 if none do.
+uint8_t Adafruit_LEDBackpack::nextChange(uint8_t row) {
+  for (; row<8; row++) {
+    if (resend || (displaybuffer[row] != shadowbuffer[row])) break;
+  }
+  return row;
+}
+
+// Send the changed rows.  Display RAM auto-increments, so each run of
+// changed rows is one transaction starting at that row's address; a
+// single unchanged row between two changes is sent along with them, as
+// that's cheaper than starting another transaction.  If stop is false
+// the bus is kept with a repeated start for the next device.  Returns
+// false if there was nothing to send.
+boolean Adafruit_LEDBackpack::sendDisplay(boolean stop) {
+  uint8_t first, last, i;
+
+  first = nextChange(0);
+  if (first >= 8) return false;
+
+  while (first < 8) {
+    last = first;
+    for (i=first+1; i<8 && (i - last) <= 2; i++) {
+      if (nextChange(i) == i) last = i;
+    }
+
+    Wire.beginTransmission(i2c_addr);
+    Wire.write((uint8_t)(first * 2)); // start at this row's address
+
+    for (i=first; i<=last; i++) {
+      Wire.write(displaybuffer[i] & 0xFF);    
+      Wire.write(displaybuffer[i] >> 8);    
+      shadowbuffer[i] = displaybuffer[i];
+    }
+
+    if (last == 7) resend = false;
+    first = nextChange(last + 1);
+#ifdef __AVR_ATtiny85__
+    Wire.endTransmission();
+#else
+    Wire.endTransmission((stop && first >= 8) ? true : false);
+#endif
+  }
+  resend = false;
+  return true;
+}
+
+void Adafruit_LEDBackpack::writeDisplays(Adafruit_LEDBackpack *displays[],
+                                         uint8_t n) {
+  int16_t i, lastChanged = -1;
+
+  // Only the last one with anything to send releases the bus
+  for (i=0; i<n; i++) {
+    if (displays[i]->nextChange(0) < 8) lastChanged = i;
+  }
+  for (i=0; i<=lastChanged; i++) {
+    displays[i]->sendDisplay(i == lastChanged);
   }
-  Wire.endTransmission();  
 }
 
 void Adafruit_LEDBackpack::clear(void) {
@@ -501,6 +561,7 @@ void Adafruit_7segment::writeColon(void) {
     Wire.write(displaybuffer[2] >> 8);
 
     Wire.endTransmission();
+    shadowbuffer[2] = displaybuffer[2];
 }
 
 void Adafruit_7segment::writeDigitNum(uint8_t d, uint8_t num, boolean dot) {
@@ -62,11 +62,27 @@ class Adafruit_LEDBackpack {
   void writeDisplay(void);
   void clear(void);
 
+  // Forget what the HT16K33 holds, so the next writeDisplay() sends every
+  // row (e.g. if the backpack was power cycled on its own).
+  void invalidate(void);
+
+  // Write a group of backpacks on the same bus in one pass: only rows
+  // that changed are sent, and the bus is held with repeated starts
+  // until the last one.
+  static void writeDisplays(Adafruit_LEDBackpack *displays[], uint8_t n);
+
   uint16_t displaybuffer[8]; 
 
   void init(uint8_t a);
  protected:
   uint8_t i2c_addr;
+
+  // What the HT16K33 is showing, as of the last write
+  uint16_t shadowbuffer[8];
+  boolean resend;
+
+  uint8_t nextChange(uint8_t row);
+  boolean sendDisplay(boolean stop);
 };
 
 class Adafruit_AlphaNum4 : public Adafruit_LEDBackpack {
@@ -0,0 +1,70 @@
+/*************************************************** 
+  This is a library for our I2C LED Backpacks
+
+  Measures how long it takes to update several 7-segment backpacks
+  three ways: rewriting every row of every display, writing only the
+  rows that changed (what writeDisplay() does), and writing the changes
+  for the whole group in one pass with writeDisplays().  Results go to
+  the Serial Monitor at 9600 baud.
+
+  Backpacks are expected at 0x70 thru 0x70+NUM_DISPLAYS-1; missing
+  addresses still take bus time, so the figures hold with fewer fitted.
+
+  Adafruit invests time and resources providing this open source code, 
+  please support Adafruit and open-source hardware by purchasing 
+  products from Adafruit!
+
+  BSD license, all text above must be included in any redistribution
+ ****************************************************/
+
+#include <Wire.h>
+#include "Adafruit_LEDBackpack.h"
+#include "Adafruit_GFX.h"
+
+#define NUM_DISPLAYS 4
+#define UPDATES      200
+
+Adafruit_7segment     displays[NUM_DISPLAYS];
+Adafruit_LEDBackpack *group[NUM_DISPLAYS];
+
+void setup() {
+  Serial.begin(9600);
+  Serial.println("Backpack bus time, per update of all displays");
+
+  for (uint8_t i=0; i<NUM_DISPLAYS; i++) {
+    displays[i].begin(0x70 + i);
+    group[i] = &displays[i];
+  }
+
+  report("Every row   ", run(0));
+  report("Changed rows", run(1));
+  report("Group       ", run(2));
+}
+
+// Counts up on every display, as a clock or counter would
+unsigned long run(uint8_t mode) {
+  unsigned long start = micros();
+
+  for (uint16_t n=0; n<UPDATES; n++) {
+    for (uint8_t i=0; i<NUM_DISPLAYS; i++) {
+      displays[i].print(n + i * 1000);
+      if (mode == 0) displays[i].invalidate();
+    }
+    if (mode == 2) {
+      Adafruit_LEDBackpack::writeDisplays(group, NUM_DISPLAYS);
+    } else {
+      for (uint8_t i=0; i<NUM_DISPLAYS; i++) displays[i].writeDisplay();
+    }
+  }
+  return (micros() - start) / UPDATES;
+}
+
+void report(const char *name, unsigned long us) {
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(us);
+  Serial.println(" us");
+}
+
+void loop() {
+}
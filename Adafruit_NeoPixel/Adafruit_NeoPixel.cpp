@@ -33,7 +33,7 @@
 
 #include "Adafruit_NeoPixel.h"
 
-Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, uint8_t p, uint8_t t) : numLEDs(n), numBytes(n * 3), pin(p), pixels(NULL)
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, uint8_t p, uint8_t t) : numLEDs(n), numBytes(n * 3), pin(p), brightness(0), pixels(NULL), frontPixels(NULL), gamma(NULL), chunkBytes(0)
 #if defined(NEO_RGB) || defined(NEO_KHZ400)
   ,type(t)
 #endif
@@ -48,7 +48,8 @@ Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, uint8_t p, uint8_t t) : numLEDs
 }
 
 Adafruit_NeoPixel::~Adafruit_NeoPixel() {
-  if(pixels) free(pixels);
+  if(pixels)      free(pixels);
+  if(frontPixels) free(frontPixels);
   pinMode(pin, INPUT);
 }
 
@@ -84,6 +85,65 @@ void Adafruit_NeoPixel::show(void) {
   // instances on different pins can be quickly issued in succession (each
   // instance doesn't delay the next).
 
+  // With double buffering enabled, the frame is snapshotted into the
+  // front buffer and issued from there.  Code running in the interrupt
+  // windows below (or in the mainline while waiting on the latch) can
+  // then safely modify 'pixels' without tearing the frame in progress.
+  // Brightness and gamma are applied in this same pass rather than on
+  // write, so 'pixels' holds the original colors and changing either
+  // setting is non-destructive.  Each case gets its own loop to keep the
+  // tests out of the per-byte path: roughly 0.5 us/byte on a 16 MHz AVR
+  // with both enabled, versus 30 us/pixel to clock the data out anyway.
+  uint8_t *p = pixels;
+  if(frontPixels) {
+    uint8_t *src = pixels, *dst = frontPixels;
+    uint16_t i   = numBytes;
+    if(gamma) {
+      if(brightness) {
+        while(i--) *dst++ = pgm_read_byte(&gamma[(*src++ * brightness) >> 8]);
+      } else {
+        while(i--) *dst++ = pgm_read_byte(&gamma[*src++]);
+      }
+    } else if(brightness) {
+      while(i--) *dst++ = (*src++ * brightness) >> 8;
+    } else {
+      memcpy(dst, src, numBytes);
+    }
+    p = frontPixels;
+  }
+
+  uint16_t n, left = numBytes,
+           chunk   = chunkBytes ? chunkBytes : numBytes;
+
+  noInterrupts(); // Need 100% focus on instruction timing
+
+  // Data is issued in chunks of 'chunk' bytes (the whole strip unless
+  // setChunkSize() was called).  Between chunks, interrupts are briefly
+  // re-enabled so that pending handlers (millis() timer, serial RX, etc.)
+  // get serviced rather than lost.  This works because the LEDs treat an
+  // overlong low period after a bit as part of that bit, so long as it
+  // stays shy of the latch time; handlers must therefore be short (a
+  // few microseconds) or the strip will latch mid-frame.  The sei/nop/cli
+  // sequence is deliberate: AVR always executes the instruction after
+  // SEI before servicing an interrupt, so sei/cli alone would do nothing.
+  for(;;) {
+    n = (left < chunk) ? left : chunk;
+    sendBytes(p, n);
+    if(!(left -= n)) break;
+    p += n;
+    interrupts();
+    asm volatile("nop");
+    noInterrupts();
+  }
+
+  interrupts();
+  endTime = micros(); // Save EOD time for latch on next call
+}
+
+// Issue 'count' bytes from 'data' to the LEDs.  Called by show() with
+// interrupts disabled; may be called several times per frame.
+void Adafruit_NeoPixel::sendBytes(uint8_t *data, uint16_t count) {
+
   // In order to make this code runtime-configurable to work with any pin,
   // SBI/CBI instructions are eschewed in favor of full PORT writes via the
   // OUT or ST instructions.  It relies on two facts: that peripheral
@@ -94,14 +154,12 @@ void Adafruit_NeoPixel::show(void) {
   // state, computes 'pin high' and 'pin low' values, and writes these back
   // to the PORT register as needed.
 
-  noInterrupts(); // Need 100% focus on instruction timing
-
 #ifdef __AVR__
 
   volatile uint16_t
-    i   = numBytes; // Loop counter
+    i   = count;    // Loop counter
   volatile uint8_t
-   *ptr = pixels,   // Pointer to next byte
+   *ptr = data,     // Pointer to next byte
     b   = *ptr++,   // Current byte value
     hi,             // PORT w/output bit set high
     lo;             // PORT w/output bit set low
@@ -732,8 +790,8 @@ void Adafruit_NeoPixel::show(void) {
   volatile uint8_t *clr = portClearRegister(pin);
   #define SET_HI   *set = 1;
   #define SET_LO   *clr = 1;
-  uint8_t *p   = pixels,
-          *end = p + numBytes, pix, mask;
+  uint8_t *p   = data,
+          *end = p + count, pix, mask;
 
 #ifdef NEO_KHZ400
   if((type & NEO_SPDMASK) == NEO_KHZ800) { // 800 KHz bitstream
@@ -801,8 +859,8 @@ void Adafruit_NeoPixel::show(void) {
   portClear = &(port->PIO_CODR);            // starting timer to minimize
   timeValue = &(TC1->TC_CHANNEL[0].TC_CV);  // the initial 'while'.
   timeReset = &(TC1->TC_CHANNEL[0].TC_CCR);
-  p         =  pixels;
-  end       =  p + numBytes;
+  p         =  data;
+  end       =  p + count;
   pix       = *p++;
   mask      = 0x80;
 
@@ -839,9 +897,6 @@ void Adafruit_NeoPixel::show(void) {
 #endif // end Arduino Due
 
 #endif // end Architecture select
-
-  interrupts();
-  endTime = micros(); // Save EOD time for latch on next call
 }
 
 // Set the output pin number
@@ -860,10 +915,17 @@ void Adafruit_NeoPixel::setPin(uint8_t p) {
 void Adafruit_NeoPixel::setPixelColor(
  uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
   if(n < numLEDs) {
-    if(brightness) { // See notes in setBrightness()
-      r = (r * brightness) >> 8;
-      g = (g * brightness) >> 8;
-      b = (b * brightness) >> 8;
+    if(!frontPixels) { // Else show() does this; see notes there
+      if(brightness) { // See notes in setBrightness()
+        r = (r * brightness) >> 8;
+        g = (g * brightness) >> 8;
+        b = (b * brightness) >> 8;
+      }
+      if(gamma) {
+        r = pgm_read_byte(&gamma[r]);
+        g = pgm_read_byte(&gamma[g]);
+        b = pgm_read_byte(&gamma[b]);
+      }
     }
     uint8_t *p = &pixels[n * 3];
 #ifdef NEO_RGB
@@ -888,10 +950,17 @@ void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
       r = (uint8_t)(c >> 16),
       g = (uint8_t)(c >>  8),
       b = (uint8_t)c;
-    if(brightness) { // See notes in setBrightness()
-      r = (r * brightness) >> 8;
-      g = (g * brightness) >> 8;
-      b = (b * brightness) >> 8;
+    if(!frontPixels) { // Else show() does this; see notes there
+      if(brightness) { // See notes in setBrightness()
+        r = (r * brightness) >> 8;
+        g = (g * brightness) >> 8;
+        b = (b * brightness) >> 8;
+      }
+      if(gamma) {
+        r = pgm_read_byte(&gamma[r]);
+        g = pgm_read_byte(&gamma[g]);
+        b = pgm_read_byte(&gamma[b]);
+      }
     }
     uint8_t *p = &pixels[n * 3];
 #ifdef NEO_RGB
@@ -945,6 +1014,43 @@ uint16_t Adafruit_NeoPixel::numPixels(void) const {
   return numLEDs;
 }
 
+// Apply a 256-entry gamma correction table (in PROGMEM) to all colors,
+// e.g. NeoPixel_gamma8 below; NULL disables.  Like brightness, this is
+// applied by show() when double buffered, else to subsequently-set
+// pixels only.  Saves effects code doing pow() or its own lookups.
+// Without the front buffer there's nowhere to keep the original colors,
+// so the two modes only give the same output if brightness and gamma are
+// set before drawing.  Changed later, single-buffered pixels keep their
+// old gamma, and setBrightness() rescales already-corrected values.
+void Adafruit_NeoPixel::setGamma(const uint8_t *table) {
+  gamma = table;
+}
+
+// Enable or disable the front buffer used by show().  Costs another
+// numPixels() * 3 bytes of RAM; returns false if that can't be allocated
+// (show() then simply continues to work directly from the pixel data).
+// Switching modes doesn't convert existing pixel data between raw and
+// scaled colors, so settle on one at startup, before drawing anything.
+boolean Adafruit_NeoPixel::setDoubleBuffer(boolean on) {
+  if(on) {
+    if(!frontPixels) frontPixels = (uint8_t *)malloc(numBytes);
+    return (frontPixels != NULL);
+  }
+  if(frontPixels) {
+    free(frontPixels);
+    frontPixels = NULL;
+  }
+  return true;
+}
+
+// Number of pixels issued per chunk by show(), with interrupts serviced
+// between chunks.  0 (the default) issues the whole strip in one go with
+// interrupts disabled throughout, as in earlier versions of the library.
+// Smaller chunks mean less interrupt latency but more time per frame.
+void Adafruit_NeoPixel::setChunkSize(uint16_t n) {
+  chunkBytes = (n < numLEDs) ? n * 3 : 0;
+}
+
 // Adjust output brightness; 0=darkest (off), 255=brightest.  This does
 // NOT immediately affect what's currently displayed on the LEDs.  The
 // next call to show() will refresh the LEDs at this level.  However,
@@ -965,7 +1071,10 @@ void Adafruit_NeoPixel::setBrightness(uint8_t b) {
   // (color values are interpreted literally; no scaling), 1 = min
   // brightness (off), 255 = just below max brightness.
   uint8_t newBrightness = b + 1;
-  if(newBrightness != brightness) { // Compare against prior value
+  if(frontPixels) {
+    // Double buffered: scaling happens in show(), data is untouched
+    brightness = newBrightness;
+  } else if(newBrightness != brightness) { // Compare against prior value
     // Brightness has changed -- re-scale existing data in RAM
     uint8_t  c,
             *ptr           = pixels,
@@ -981,3 +1090,23 @@ void Adafruit_NeoPixel::setBrightness(uint8_t b) {
     brightness = newBrightness;
   }
 }
+
+// Gamma 2.8 table for setGamma().  Only linked in if referenced.
+const uint8_t PROGMEM NeoPixel_gamma8[256] = {
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,
+    1,  1,  1,  1,  1,  1,  1,  1,  1,  2,  2,  2,  2,  2,  2,  2,
+    2,  3,  3,  3,  3,  3,  3,  3,  4,  4,  4,  4,  4,  5,  5,  5,
+    5,  6,  6,  6,  6,  7,  7,  7,  7,  8,  8,  8,  9,  9,  9, 10,
+   10, 10, 11, 11, 11, 12, 12, 13, 13, 13, 14, 14, 15, 15, 16, 16,
+   17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23, 24, 24, 25,
+   25, 26, 27, 27, 28, 29, 29, 30, 31, 32, 32, 33, 34, 35, 35, 36,
+   37, 38, 39, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 50,
+   51, 52, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 66, 67, 68,
+   69, 70, 72, 73, 74, 75, 77, 78, 79, 81, 82, 83, 85, 86, 87, 89,
+   90, 92, 93, 95, 96, 98, 99,101,102,104,105,107,109,110,112,114,
+  115,117,119,120,122,124,126,127,129,131,133,135,137,138,140,142,
+  144,146,148,150,152,154,156,158,160,162,164,167,169,171,173,175,
+  177,180,182,184,186,189,191,193,196,198,200,203,205,208,210,213,
+  215,218,220,223,225,228,231,233,236,239,241,244,247,249,252,255
+};
@@ -53,7 +53,11 @@ class Adafruit_NeoPixel {
     setPin(uint8_t p),
     setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b),
     setPixelColor(uint16_t n, uint32_t c),
-    setBrightness(uint8_t);
+    setBrightness(uint8_t),
+    setChunkSize(uint16_t n),
+    setGamma(const uint8_t *table); // show() applies it only if double buffered
+  boolean
+    setDoubleBuffer(boolean on);
   uint8_t
    *getPixels() const;
   uint16_t
@@ -65,6 +69,8 @@ class Adafruit_NeoPixel {
 
  private:
 
+  void
+    sendBytes(uint8_t *data, uint16_t count);
   const uint16_t
     numLEDs,       // Number of RGB LEDs in strip
     numBytes;      // Size of 'pixels' buffer below
@@ -75,7 +81,12 @@ class Adafruit_NeoPixel {
   uint8_t
     pin,           // Output pin number
     brightness,
-   *pixels;        // Holds LED color values (3 bytes each)
+   *pixels,        // Holds LED color values (3 bytes each)
+   *frontPixels;   // Copy issued by show() if double buffered, else NULL
+  const uint8_t
+   *gamma;         // Gamma table in PROGMEM, or NULL
+  uint16_t
+    chunkBytes;    // Bytes per interrupt-free chunk in show(), 0 = all
   uint32_t
     endTime;       // Latch timing reference
 #ifdef __AVR__
@@ -87,4 +98,7 @@ class Adafruit_NeoPixel {
 
 };
 
+// Gamma 2.8 correction table for use with setGamma()
+extern const uint8_t PROGMEM NeoPixel_gamma8[256];
+
 #endif // ADAFRUIT_NEOPIXEL_H
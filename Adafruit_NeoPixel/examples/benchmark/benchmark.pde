@@ -0,0 +1,63 @@
+// Measures show() frame rate and interrupt latency with different chunk
+// sizes.  With interrupts held off for the whole strip, millis() ticks
+// (and incoming serial bytes) are lost on long strips; the 'lost' column
+// shows how many milliseconds the system clock fell behind per 100 frames.
+// Open the Serial Monitor at 9600 baud to see the results.  No LEDs need
+// be connected, though the pattern shown is harmless if they are.
+
+#include <Adafruit_NeoPixel.h>
+
+#define PIN    6
+#define N_LEDS 240
+#define FRAMES 100
+
+Adafruit_NeoPixel strip = Adafruit_NeoPixel(N_LEDS, PIN, NEO_GRB + NEO_KHZ800);
+
+void setup() {
+  Serial.begin(9600);
+  strip.begin();
+  for(uint16_t i=0; i<N_LEDS; i++) strip.setPixelColor(i, (i & 1) ? 8 : 0, 0, 0);
+
+  // Bitstream time per frame at 800 KHz: 1.25 us/bit, 24 bits/pixel,
+  // plus 50 us latch.  Anything millis() reports beyond this is overhead;
+  // anything it reports *under* this is timer interrupts that were lost.
+  uint32_t ideal = ((uint32_t)N_LEDS * 30L + 50L) * FRAMES / 1000L;
+  Serial.print("Ideal ms/");
+  Serial.print(FRAMES);
+  Serial.print(" frames: ");
+  Serial.println(ideal);
+
+  run(0, false, ideal);
+  run(32, false, ideal);
+  run(8, false, ideal);
+  run(1, false, ideal);
+  if(strip.setDoubleBuffer(true)) run(8, true, ideal);
+  else Serial.println("Not enough RAM for double buffer");
+}
+
+void run(uint16_t chunk, boolean dbl, uint32_t ideal) {
+  uint32_t t;
+  long     lost;
+
+  strip.setChunkSize(chunk);
+  strip.show(); // Prime latch timing
+  t = millis();
+  for(uint16_t f=0; f<FRAMES; f++) strip.show();
+  t = millis() - t;
+  lost = (long)ideal - (long)t;
+  if(lost < 0) lost = 0;
+
+  Serial.print("chunk ");
+  Serial.print(chunk);
+  Serial.print(dbl ? " dbl" : "");
+  Serial.print(": ");
+  Serial.print(t);
+  Serial.print(" ms, ");
+  Serial.print((FRAMES * 1000L) / (t ? t : 1));
+  Serial.print(" fps, lost ");
+  Serial.print(lost);
+  Serial.println(" ms");
+}
+
+void loop() {
+}
@@ -93,6 +93,7 @@ Adafruit_PCD8544::Adafruit_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC,
   _dc = DC;
   _rst = RST;
   _cs = CS;
+  hwSPI = false;
 }
 
 Adafruit_PCD8544::Adafruit_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC,
@@ -102,6 +103,18 @@ Adafruit_PCD8544::Adafruit_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC,
   _dc = DC;
   _rst = RST;
   _cs = -1;
+  hwSPI = false;
+}
+
+// constructor for hardware SPI
+Adafruit_PCD8544::Adafruit_PCD8544(int8_t DC, int8_t CS, int8_t RST) : 
+  Adafruit_GFX(LCDWIDTH, LCDHEIGHT) {
+  _din = -1;
+  _sclk = -1;
+  _dc = DC;
+  _rst = RST;
+  _cs = CS;
+  hwSPI = true;
 }
 
 
@@ -131,13 +144,24 @@ uint8_t Adafruit_PCD8544::getPixel(int8_t x, int8_t y) {
 
 void Adafruit_PCD8544::begin(uint8_t contrast) {
   // set pin directions
-  pinMode(_din, OUTPUT);
-  pinMode(_sclk, OUTPUT);
+  if (hwSPI) {
+    SPI.begin();
+#ifdef __SAM3X8E__
+    SPI.setClockDivider(21); // 4 MHz, the fastest the PCD8544 allows
+#else
+    SPI.setClockDivider(SPI_CLOCK_DIV4); // 4 MHz, the fastest the PCD8544 allows
+#endif
+  } else {
+    pinMode(_din, OUTPUT);
+    pinMode(_sclk, OUTPUT);
+  }
   pinMode(_dc, OUTPUT);
   if (_rst > 0)
     pinMode(_rst, OUTPUT);
-  if (_cs > 0)
+  if (_cs > 0) {
     pinMode(_cs, OUTPUT);
+    digitalWrite(_cs, HIGH);
+  }
 
   // toggle RST low to reset
   if (_rst > 0) {
@@ -146,10 +170,12 @@ void Adafruit_PCD8544::begin(uint8_t contrast) {
     digitalWrite(_rst, HIGH);
   }
 
-  clkport     = portOutputRegister(digitalPinToPort(_sclk));
-  clkpinmask  = digitalPinToBitMask(_sclk);
-  mosiport    = portOutputRegister(digitalPinToPort(_din));
-  mosipinmask = digitalPinToBitMask(_din);
+  if (! hwSPI) {
+    clkport     = portOutputRegister(digitalPinToPort(_sclk));
+    clkpinmask  = digitalPinToBitMask(_sclk);
+    mosiport    = portOutputRegister(digitalPinToPort(_din));
+    mosipinmask = digitalPinToBitMask(_din);
+  }
   csport    = portOutputRegister(digitalPinToPort(_cs));
   cspinmask = digitalPinToBitMask(_cs);
   dcport    = portOutputRegister(digitalPinToPort(_dc));
@@ -189,6 +215,10 @@ void Adafruit_PCD8544::begin(uint8_t contrast) {
 
 inline void Adafruit_PCD8544::fastSPIwrite(uint8_t d) {
   
+  if (hwSPI) {
+    (void)SPI.transfer(d);
+    return;
+  }
   for(uint8_t bit = 0x80; bit; bit >>= 1) {
     *clkport &= ~clkpinmask;
     if(d & bit) *mosiport |=  mosipinmask;
@@ -197,6 +227,25 @@ inline void Adafruit_PCD8544::fastSPIwrite(uint8_t d) {
   }
 }
 
+// write a run of bytes; on AVR the next byte is fetched while the 
+// previous one is still shifting out
+void Adafruit_PCD8544::fastSPIwrite(const uint8_t *buf, uint16_t n) {
+  if (! n) return;
+#ifdef __AVR__
+  if (hwSPI) {
+    SPDR = *buf++;
+    while (--n) {
+      uint8_t c = *buf++;
+      while (!(SPSR & _BV(SPIF)));
+      SPDR = c;
+    }
+    while (!(SPSR & _BV(SPIF)));
+    return;
+  }
+#endif
+  while (n--) fastSPIwrite(*buf++);
+}
+
 inline void Adafruit_PCD8544::slowSPIwrite(uint8_t c) {
   shiftOut(_din, _sclk, MSBFIRST, c);
 }
@@ -232,7 +281,7 @@ void Adafruit_PCD8544::setContrast(uint8_t val) {
 
 
 void Adafruit_PCD8544::display(void) {
-  uint8_t col, maxcol, p;
+  uint8_t col, maxcol, p, lastp;
   
   for(p = 0; p < 6; p++) {
 #ifdef enablePartialUpdate
@@ -251,21 +300,28 @@ void Adafruit_PCD8544::display(void) {
 #ifdef enablePartialUpdate
     col = xUpdateMin;
     maxcol = xUpdateMax;
+    lastp = yUpdateMax / 8;
 #else
     // start at the beginning of the row
     col = 0;
     maxcol = LCDWIDTH-1;
+    lastp = 5;
 #endif
+    if (maxcol < col) 
+      break;
 
     command(PCD8544_SETXADDR | col);
 
     digitalWrite(_dc, HIGH);
     if (_cs > 0)
       digitalWrite(_cs, LOW);
-    for(; col <= maxcol; col++) {
-      //uart_putw_dec(col);
-      //uart_putchar(' ');
-      fastSPIwrite(pcd8544_buffer[(LCDWIDTH*p)+col]);
+    if (col == 0 && maxcol == LCDWIDTH-1) {
+      // full rows: the address wraps to the next page by itself, 
+      // so the rest of the update goes out in one block
+      fastSPIwrite(pcd8544_buffer+(LCDWIDTH*p), LCDWIDTH*(lastp-p+1));
+      p = lastp;
+    } else {
+      fastSPIwrite(pcd8544_buffer+(LCDWIDTH*p)+col, maxcol-col+1);
     }
     if (_cs > 0)
       digitalWrite(_cs, HIGH);
@@ -22,6 +22,7 @@ All text above, and the splash screen must be included in any redistribution
   #include "WProgram.h"
   #include "pins_arduino.h"
 #endif
+#include <SPI.h>
 
 #define BLACK 1
 #define WHITE 0
@@ -53,6 +54,8 @@ class Adafruit_PCD8544 : public Adafruit_GFX {
  public:
   Adafruit_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC, int8_t CS, int8_t RST);
   Adafruit_PCD8544(int8_t SCLK, int8_t DIN, int8_t DC, int8_t RST);
+  // hardware SPI: DIN and SCLK go to the MOSI and SCK pins
+  Adafruit_PCD8544(int8_t DC, int8_t CS, int8_t RST);
 
   void begin(uint8_t contrast = 40);
   
@@ -70,7 +73,9 @@ class Adafruit_PCD8544 : public Adafruit_GFX {
   int8_t _din, _sclk, _dc, _rst, _cs;
   volatile uint8_t *mosiport, *clkport, *csport, *dcport;
   uint8_t mosipinmask, clkpinmask, cspinmask, dcpinmask;
+  boolean hwSPI;
 
   void slowSPIwrite(uint8_t c);
   void fastSPIwrite(uint8_t c);
+  void fastSPIwrite(const uint8_t *buf, uint16_t n);
 };
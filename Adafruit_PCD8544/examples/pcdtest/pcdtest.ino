@@ -16,6 +16,7 @@ BSD license, check license.txt for more information
 All text above, and the splash screen must be included in any redistribution
 *********************************************************************/
 
+#include <SPI.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_PCD8544.h>
 
@@ -26,6 +27,11 @@ All text above, and the splash screen must be included in any redistribution
 // pin 3 - LCD reset (RST)
 Adafruit_PCD8544 display = Adafruit_PCD8544(7, 6, 5, 4, 3);
 
+// Hardware SPI: DIN to MOSI and SCLK to SCK (11 and 13 on an Uno),
+// then only D/C, CS and RST are given.  display() is then several
+// times faster.
+// Adafruit_PCD8544 display = Adafruit_PCD8544(5, 4, 3);
+
 #define NUMFLAKES 10
 #define XPOS 0
 #define YPOS 1
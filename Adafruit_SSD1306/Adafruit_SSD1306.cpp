@@ -123,6 +123,10 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
     break;
   }  
 
+  drawPixelInternal(x, y, color);
+}
+
+void Adafruit_SSD1306::drawPixelInternal(int16_t x, int16_t y, uint16_t color) {
   // x is which column
     switch (color) 
     {
@@ -769,3 +773,51 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y, int16_t __h
     }
   }
 }
+
+
+// Fixed-rotation versions.  The rotation is a constant, so the coordinate
+// mapping and the H/V line choice are resolved by the compiler and the
+// bounds checks compare against constants.
+#define ROT_LCDWIDTH  ((R & 1) ? SSD1306_LCDHEIGHT : SSD1306_LCDWIDTH)
+#define ROT_LCDHEIGHT ((R & 1) ? SSD1306_LCDWIDTH : SSD1306_LCDHEIGHT)
+
+template <uint8_t R>
+void Adafruit_SSD1306_Rotated<R>::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < 0) || (x >= ROT_LCDWIDTH) || (y < 0) || (y >= ROT_LCDHEIGHT))
+    return;
+
+  rotateToRaw<R>(x, y, SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT);
+  drawPixelInternal(x, y, color);
+}
+
+template <uint8_t R>
+void Adafruit_SSD1306_Rotated<R>::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  // at 180 and 270 degrees the far end of the line lands on the low raw coordinate
+  if(R >= 2) x += w - 1;
+  rotateToRaw<R>(x, y, SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT);
+  if(R & 1) {
+    drawFastVLineInternal(x, y, w, color);
+  } else {
+    drawFastHLineInternal(x, y, w, color);
+  }
+}
+
+template <uint8_t R>
+void Adafruit_SSD1306_Rotated<R>::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  // at 90 and 180 degrees the far end of the line lands on the low raw coordinate
+  if(R == 1 || R == 2) y += h - 1;
+  rotateToRaw<R>(x, y, SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT);
+  if(R & 1) {
+    drawFastHLineInternal(x, y, h, color);
+  } else {
+    drawFastVLineInternal(x, y, h, color);
+  }
+}
+
+#undef ROT_LCDWIDTH
+#undef ROT_LCDHEIGHT
+
+template class Adafruit_SSD1306_Rotated<0>;
+template class Adafruit_SSD1306_Rotated<1>;
+template class Adafruit_SSD1306_Rotated<2>;
+template class Adafruit_SSD1306_Rotated<3>;
@@ -154,6 +154,12 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 
+ protected:
+  // raw buffer access, no rotation applied
+  inline void drawPixelInternal(int16_t x, int16_t y, uint16_t color) __attribute__((always_inline));
+  inline void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint16_t color) __attribute__((always_inline));
+  inline void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color) __attribute__((always_inline));
+
  private:
   int8_t _i2caddr, _vccstate, sid, sclk, dc, rst, cs;
   void fastSPIwrite(uint8_t c);
@@ -162,9 +168,26 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
   PortReg *mosiport, *clkport, *csport, *dcport;
   PortMask mosipinmask, clkpinmask, cspinmask, dcpinmask;
 
-  inline void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint16_t color) __attribute__((always_inline));
-  inline void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color) __attribute__((always_inline));
+};
 
+// For a display that never changes orientation: the rotation (0-3) is a
+// template argument, so drawPixel() and the fast lines go straight to the
+// buffer without the per-call rotation switch.  Only 0-3 are instantiated
+// (in Adafruit_SSD1306.cpp).  Don't call setRotation() on one of these.
+//
+//   Adafruit_SSD1306_Rotated<1> display(OLED_RESET);
+template <uint8_t R> class Adafruit_SSD1306_Rotated : public Adafruit_SSD1306 {
+ public:
+  Adafruit_SSD1306_Rotated(int8_t SID, int8_t SCLK, int8_t DC, int8_t RST, int8_t CS) :
+    Adafruit_SSD1306(SID, SCLK, DC, RST, CS) { setRotation(R); }
+  Adafruit_SSD1306_Rotated(int8_t DC, int8_t RST, int8_t CS) :
+    Adafruit_SSD1306(DC, RST, CS) { setRotation(R); }
+  Adafruit_SSD1306_Rotated(int8_t RST) :
+    Adafruit_SSD1306(RST) { setRotation(R); }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 };
 
 #endif /* ADAFRUIT_SSD1306_H */
@@ -0,0 +1,78 @@
+/*********************************************************************
+Times the drawing primitives on a display rotated at run time with
+setRotation(1) against the same display built as
+Adafruit_SSD1306_Rotated<1>, where the rotation is fixed at compile time.
+
+Both objects draw into the library's one shared frame buffer, so no
+display needs to be attached and no extra RAM is used.  Open the Serial
+Monitor at 9600 baud to see the results.
+*********************************************************************/
+
+#include <SPI.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+
+#define OLED_RESET 4
+#define RUNS 10
+
+Adafruit_SSD1306            runtime(OLED_RESET);
+Adafruit_SSD1306_Rotated<1> fixed(OLED_RESET);
+
+unsigned long pixels(Adafruit_GFX &d) {
+  unsigned long start = micros();
+  for(uint8_t r=0; r<RUNS; r++)
+    for(int16_t y=0; y<d.height(); y++)
+      for(int16_t x=0; x<d.width(); x++)
+        d.drawPixel(x, y, (x ^ y) & 1);
+  return (micros() - start) / RUNS;
+}
+
+unsigned long hlines(Adafruit_GFX &d) {
+  unsigned long start = micros();
+  for(uint8_t r=0; r<RUNS; r++)
+    for(int16_t y=0; y<d.height(); y++)
+      d.drawFastHLine(0, y, d.width(), r & 1);
+  return (micros() - start) / RUNS;
+}
+
+unsigned long vlines(Adafruit_GFX &d) {
+  unsigned long start = micros();
+  for(uint8_t r=0; r<RUNS; r++)
+    for(int16_t x=0; x<d.width(); x++)
+      d.drawFastVLine(x, 0, d.height(), r & 1);
+  return (micros() - start) / RUNS;
+}
+
+unsigned long text(Adafruit_GFX &d) {
+  unsigned long start = micros();
+  for(uint8_t r=0; r<RUNS; r++) {
+    d.setCursor(0, 0);
+    d.print("The quick brown fox");
+  }
+  return (micros() - start) / RUNS;
+}
+
+void report(const char *name, unsigned long rt, unsigned long fx) {
+  Serial.print(name);
+  Serial.print(": setRotation ");
+  Serial.print(rt);
+  Serial.print(" us, fixed ");
+  Serial.print(fx);
+  Serial.println(" us");
+}
+
+void setup() {
+  Serial.begin(9600);
+  runtime.setRotation(1);
+  runtime.setTextColor(WHITE);
+  fixed.setTextColor(WHITE);
+
+  report("drawPixel (whole screen)", pixels(runtime), pixels(fixed));
+  report("drawFastHLine (every row)", hlines(runtime), hlines(fixed));
+  report("drawFastVLine (every column)", vlines(runtime), vlines(fixed));
+  report("print (19 chars)", text(runtime), text(fixed));
+}
+
+void loop() {
+}
@@ -104,6 +104,11 @@ Adafruit_VS1053_FilePlayer::Adafruit_VS1053_FilePlayer(
                : Adafruit_VS1053(rst, cs, dcs, dreq) {
 
   playingMusic = false;
+  ringbuffer = NULL;
+  ringsize = ringhead = ringtail = 0;
+  spibusy = starved = trackended = false;
+  bufferUnderruns = 0;
+  bufferLowWater = 0xFFFF;
 
   // Set the card to be disabled while we get the VS1053 up
   pinMode(_cardCS, OUTPUT);
@@ -118,6 +123,11 @@ Adafruit_VS1053_FilePlayer::Adafruit_VS1053_FilePlayer(
                : Adafruit_VS1053(mosi, miso, clk, rst, cs, dcs, dreq) {
 
   playingMusic = false;
+  ringbuffer = NULL;
+  ringsize = ringhead = ringtail = 0;
+  spibusy = starved = trackended = false;
+  bufferUnderruns = 0;
+  bufferLowWater = 0xFFFF;
 
   // Set the card to be disabled while we get the VS1053 up
   pinMode(_cardCS, OUTPUT);
@@ -141,6 +151,7 @@ boolean Adafruit_VS1053_FilePlayer::playFullFile(char *trackname) {
 
   while (playingMusic) {
     // twiddle thumbs
+    fillBuffer();
     feedBuffer();
   }
   // music file finished!
@@ -151,6 +162,9 @@ void Adafruit_VS1053_FilePlayer::stopPlaying(void) {
   // wrap it up!
   playingMusic = false;
   currentTrack.close();
+  cli();
+  ringhead = ringtail = 0;
+  sei();
 }
 
 void Adafruit_VS1053_FilePlayer::pausePlaying(boolean pause) {
@@ -163,11 +177,11 @@ void Adafruit_VS1053_FilePlayer::pausePlaying(boolean pause) {
 }
 
 boolean Adafruit_VS1053_FilePlayer::paused(void) {
-  return (!playingMusic && currentTrack);
+  return (!playingMusic && (currentTrack || bufferedBytes()));
 }
 
 boolean Adafruit_VS1053_FilePlayer::stopped(void) {
-  return (!playingMusic && !currentTrack);
+  return (!playingMusic && !currentTrack && !bufferedBytes());
 }
 
 
@@ -177,6 +191,12 @@ boolean Adafruit_VS1053_FilePlayer::startPlayingFile(char *trackname) {
     return false;
   }
 
+  // prime the ring before the interrupt can start emptying it
+  playingMusic = false;
+  ringhead = ringtail = 0;
+  trackended = starved = false;
+  fillBuffer();
+
   playingMusic = true;
 
   // wait till its ready for data
@@ -184,8 +204,10 @@ boolean Adafruit_VS1053_FilePlayer::startPlayingFile(char *trackname) {
   
 
   // fill it up!
-  while (readyForData()) 
+  while (playingMusic && readyForData()) {
     feedBuffer();
+    if (ringbuffer && ! fillBuffer()) break;
+  }
 
 //  Serial.println("Ready");
   
@@ -196,6 +218,10 @@ void Adafruit_VS1053_FilePlayer::feedBuffer(void) {
   if (! playingMusic) {
     return; // paused or stopped
   }
+  if (ringbuffer) {
+    drainBuffer();
+    return;
+  }
   if (! currentTrack) {
     return;
   }
@@ -221,6 +247,116 @@ void Adafruit_VS1053_FilePlayer::feedBuffer(void) {
   return;
 }
 
+// Size 0 frees the ring and goes back to reading the card from feedBuffer().
+// Only allowed while stopped; returns false if not, or if out of memory.
+boolean Adafruit_VS1053_FilePlayer::setBufferSize(uint16_t size) {
+  if (playingMusic || currentTrack) return false;
+
+  if (ringbuffer) {
+    free(ringbuffer);
+    ringbuffer = NULL;
+  }
+  ringsize = ringhead = ringtail = 0;
+  bufferUnderruns = 0;
+  bufferLowWater = 0xFFFF;
+  if (! size) return true;
+
+  // one byte stays empty so a full ring can be told from an empty one
+  if ((ringbuffer = (uint8_t *)malloc(size + 1)) == NULL) return false;
+  ringsize = size + 1;
+  return true;
+}
+
+uint16_t Adafruit_VS1053_FilePlayer::bufferedBytes(void) {
+  if (! ringbuffer) return 0;
+  cli();
+  uint16_t head = ringhead, tail = ringtail;
+  sei();
+  return (head >= tail) ? (head - tail) : (ringsize - tail + head);
+}
+
+// Call often from loop().  Reads the card until the ring is full or the
+// track ends, and returns how many bytes were added.
+uint16_t Adafruit_VS1053_FilePlayer::fillBuffer(void) {
+  uint16_t added = 0;
+
+  if (! ringbuffer) return 0;
+
+  while (currentTrack) {
+    uint16_t head = ringhead, tail, n;
+    cli();
+    tail = ringtail;
+    sei();
+
+    // free space up to the tail, or up to the end of the ring
+    if (tail > head) n = tail - head - 1;
+    else n = ringsize - head - (tail == 0);
+    if (! n) break;
+    if (n > VS1053_FILEREADLEN) n = VS1053_FILEREADLEN;
+
+    // the card shares the SPI bus, so hold off drainBuffer() meanwhile
+    spibusy = true;
+    int bytesread = currentTrack.read(ringbuffer + head, n);
+    spibusy = false;
+
+    if (bytesread <= 0) {
+      // end of the file; playback stops once the ring is empty
+      trackended = true;
+      currentTrack.close();
+    } else {
+      head += bytesread;
+      if (head == ringsize) head = 0;
+      cli();
+      ringhead = head;
+      sei();
+      added += bytesread;
+    }
+    // catch up on any DREQ that came in during the read
+    feedBuffer();
+  }
+  return added;
+}
+
+// Runs from the interrupt (or feedBuffer()): sends what the ring holds for
+// as long as DREQ stays up, with xDCS held low for the whole burst.
+void Adafruit_VS1053_FilePlayer::drainBuffer(void) {
+  if (spibusy) return;
+  spibusy = true;
+
+  uint16_t head = ringhead, tail = ringtail;
+  uint16_t avail = (head >= tail) ? (head - tail) : (ringsize - tail + head);
+
+  if (readyForData()) {
+    if (! trackended && avail < bufferLowWater) bufferLowWater = avail;
+
+    if (avail) {
+      starved = false;
+      digitalWrite(_dcs, LOW);
+      do {
+	// DREQ high means room for at least 32 bytes
+	uint8_t n = (avail < VS1053_DATABUFFERLEN) ? avail : VS1053_DATABUFFERLEN;
+	avail -= n;
+	while (n--) {
+	  spiwrite(ringbuffer[tail]);
+	  if (++tail == ringsize) tail = 0;
+	}
+      } while (avail && readyForData());
+      digitalWrite(_dcs, HIGH);
+      ringtail = tail;
+    }
+
+    if (! avail && readyForData()) {
+      if (trackended) {
+	playingMusic = false;      // all of it has been sent
+      } else if (! starved) {
+	starved = true;            // count each dry spell once
+	bufferUnderruns++;
+      }
+    }
+  }
+  spibusy = false;
+}
+
 
 /***************************************************************/
 
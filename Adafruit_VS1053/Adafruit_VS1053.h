@@ -69,6 +69,7 @@
 #define VS1053_SCI_AICTRL3 0x0F
 
 #define VS1053_DATABUFFERLEN 32
+#define VS1053_FILEREADLEN 512   // most SD bytes read per go when filling the ring buffer
 
 
 class Adafruit_VS1053 {
@@ -136,6 +137,24 @@ class Adafruit_VS1053_FilePlayer : public Adafruit_VS1053 {
   boolean stopped(void);
   void pausePlaying(boolean pause);
 
+  // Optional ring buffer between the SD card and the VS1053.  The sketch
+  // calls fillBuffer() from loop() to read the card, and the DREQ (or timer)
+  // interrupt only moves data from the ring to the VS1053, so SD reads never
+  // happen inside the interrupt.
+  boolean setBufferSize(uint16_t size);
+  uint16_t fillBuffer(void);
+  uint16_t bufferedBytes(void);
+  // Times the ring ran dry while the VS1053 was asking for data, and the
+  // fewest bytes that were waiting when it asked (0xFFFF until it asks).
+  // Neither counts the end of a track.
+  volatile uint16_t bufferUnderruns;
+  volatile uint16_t bufferLowWater;
+
  private:
+  void drainBuffer(void);
   uint8_t _cardCS;
+  uint8_t *ringbuffer;
+  uint16_t ringsize;
+  volatile uint16_t ringhead, ringtail; // written by fillBuffer, drainBuffer
+  volatile boolean spibusy, starved, trackended;
 };
@@ -0,0 +1,103 @@
+/*************************************************** 
+  This is an example for the Adafruit VS1053 Codec Breakout
+
+  Designed specifically to work with the Adafruit VS1053 Codec Breakout 
+  ----> https://www.adafruit.com/products/1381
+
+  Adafruit invests time and resources providing this open source code, 
+  please support Adafruit and open-source hardware by purchasing 
+  products from Adafruit!
+
+  Written by Limor Fried/Ladyada for Adafruit Industries.  
+  BSD license, all text above must be included in any redistribution
+ ****************************************************/
+
+// Plays a file through a RAM ring buffer.  loop() reads the SD card
+// with fillBuffer() whenever it gets the chance, and the DREQ interrupt
+// only copies from RAM to the VS1053, so it is short and never touches
+// the card.  The ring covers however long loop() is busy elsewhere.
+//
+// Every few seconds the sketch prints how often the ring ran dry while
+// the VS1053 wanted data, and the fewest bytes that were left when it
+// asked.  If 'dry' keeps climbing, make BUFFERSIZE bigger or call
+// fillBuffer() more often; if 'low' never gets near 0 you can make it
+// smaller.  The VS1053 has 2K of its own, so an occasional dry ring
+// isn't always an audible gap.
+
+// include SPI, MP3 and SD libraries
+#include <SPI.h>
+#include <Adafruit_VS1053.h>
+#include <SD.h>
+
+// define the pins used
+#define RESET 9      // VS1053 reset pin (output)
+#define CS 10        // VS1053 chip select pin (output)
+#define DCS 8        // VS1053 Data/command select pin (output)
+#define DREQ 3       // VS1053 Data request pin (into Arduino)
+#define CARDCS 4     // Card chip select pin
+
+// Bytes of RAM for the ring.  The SD library needs ~700 bytes itself,
+// so keep this modest on an Uno; a Mega can go to 4K or more.
+#define BUFFERSIZE 512
+
+// How long loop() is 'busy' between fills, standing in for other work
+#define BUSYTIME 40
+
+Adafruit_VS1053_FilePlayer musicPlayer = Adafruit_VS1053_FilePlayer(RESET, CS, DCS, DREQ, CARDCS);
+
+void setup() {
+  Serial.begin(9600);
+  Serial.println("Adafruit VS1053 Buffered Player");
+
+  // initialise the music player
+  if (!musicPlayer.begin()) {
+    Serial.println("VS1053 not found");
+    while (1);  // don't do anything more
+  }
+ 
+  if (!SD.begin(CARDCS)) {
+    Serial.println("SD failed, or not present");
+    while (1);  // don't do anything more
+  }
+  Serial.println("SD OK!");
+
+  if (!musicPlayer.setBufferSize(BUFFERSIZE)) {
+    Serial.println("Not enough RAM for the ring buffer");
+    while (1);
+  }
+  
+  // Set volume for left, right channels. lower numbers == louder volume!
+  musicPlayer.setVolume(20,20);
+
+  // DREQ must be on an interrupt pin. For Uno/Duemilanove/Diecimilla
+  // that's Digital #2 or #3
+  if (! musicPlayer.useInterrupt(VS1053_FILEPLAYER_PIN_INT))
+    Serial.println("DREQ pin is not an interrupt pin");
+}
+
+void loop() {  
+  if (! musicPlayer.startPlayingFile("track001.mp3")) {
+    Serial.print("Could not open file");
+    while (1);
+  }
+  Serial.println("Started playing");
+
+  uint32_t lastReport = millis();
+  while (musicPlayer.playingMusic) {
+    // top up the ring, then go do something else for a while
+    musicPlayer.fillBuffer();
+    delay(BUSYTIME);
+
+    if (millis() - lastReport >= 5000) {
+      lastReport = millis();
+      Serial.print("dry ");
+      Serial.print(musicPlayer.bufferUnderruns);
+      Serial.print(", low ");
+      Serial.print(musicPlayer.bufferLowWater);
+      Serial.print(" of ");
+      Serial.println(BUFFERSIZE);
+    }
+  }
+  Serial.println("Done playing music");
+  delay(1000);
+}
@@ -1,5 +1,7 @@
 #include "Animation.h"
 
+#define NO_FRAME 0xFFFF
+
 Animation::Animation() {
   init(0, NULL, ENCODING_RGB24, 0);
 }
@@ -27,10 +29,20 @@ void Animation::init(uint16_t frameCount,
  
 void Animation::reset() {
   m_frameIndex = 0;
+  m_lastFrame = NO_FRAME;
   currentFrameData = m_frameData;
 }
 
 void Animation::draw(struct CRGB strip[]) {
+  load(strip);
+  LEDS.show();
+};
+
+void Animation::load(struct CRGB strip[]) {
+  if(m_frameCount == 0) {
+    return;
+  }
+
   switch(m_encoding) {
     case ENCODING_RGB24:
       drawNoEncoding(strip);
@@ -38,8 +50,51 @@ void Animation::draw(struct CRGB strip[]) {
     case ENCODING_RGB565_RLE:
       draw16bitRLE(strip);
       break;
+    case ENCODING_RGB565_DELTA:
+      drawDelta(strip);
+      break;
   }
-};
+
+  m_frameIndex = (m_frameIndex + 1)%m_frameCount;
+  if(m_frameIndex == 0) {
+    currentFrameData = m_frameData;
+  }
+}
+
+void Animation::setFrame(uint16_t frame) {
+  if(m_frameCount == 0) {
+    return;
+  }
+  frame = frame%m_frameCount;
+
+  if(m_encoding == ENCODING_RGB565_RLE) {
+    // Frames are different lengths, so count runs from the start (or from
+    // where we are now, if that's on the way).
+    if(frame < m_frameIndex) {
+      m_frameIndex = 0;
+      currentFrameData = m_frameData;
+    }
+    while(m_frameIndex < frame) {
+      uint8_t count = 0;
+      while(count < m_ledCount) {
+        count += 0x7F & pgm_read_byte(currentFrameData);
+        currentFrameData += 3;
+      }
+      m_frameIndex++;
+    }
+  }
+
+  m_frameIndex = frame;
+  m_lastFrame = NO_FRAME;
+}
+
+uint16_t Animation::getFrame() {
+  return m_frameIndex;
+}
+
+uint16_t Animation::getFrameCount() {
+  return m_frameCount;
+}
 
 void Animation::drawNoEncoding(struct CRGB strip[]) {
   currentFrameData = m_frameData + m_frameIndex*m_ledCount*3;
@@ -49,10 +104,6 @@ void Animation::drawNoEncoding(struct CRGB strip[]) {
                     pgm_read_byte(currentFrameData + i*3 + 1),
                     pgm_read_byte(currentFrameData + i*3 + 2));
   }
-  
-  LEDS.show();
-  
-  m_frameIndex = (m_frameIndex + 1)%m_frameCount;
 }
 
 void Animation::draw16bitRLE(struct CRGB strip[]) {
@@ -77,11 +128,57 @@ void Animation::draw16bitRLE(struct CRGB strip[]) {
     count += run_length;
     currentFrameData += 3;
   }
-  
-  LEDS.show();
+};
 
-  m_frameIndex = (m_frameIndex + 1)%m_frameCount;
-  if(m_frameIndex == 0) {
-    currentFrameData = m_frameData;
+void Animation::drawDelta(struct CRGB strip[]) {
+  // Sequential playback only needs this frame's changes. Anything else
+  // (the first frame, a seek, running backwards) rebuilds the strip from
+  // the nearest keyframe at or before the one we want.
+  if(m_lastFrame == NO_FRAME
+     || (uint16_t)(m_lastFrame + 1) != m_frameIndex) {
+    uint16_t key = m_frameIndex;
+    while(key > 0
+          && !(pgm_read_byte(deltaFrame(key)) & DELTA_KEYFRAME)) {
+      key--;
+    }
+    for(; key < m_frameIndex; key++) {
+      decodeDelta(strip, key);
+    }
   }
-};
+
+  decodeDelta(strip, m_frameIndex);
+  m_lastFrame = m_frameIndex;
+}
+
+prog_uint8_t* Animation::deltaFrame(uint16_t frame) {
+  prog_uint8_t* entry = m_frameData + frame*2;
+  return m_frameData + (pgm_read_byte(entry)
+                        | (pgm_read_byte(entry + 1) << 8));
+}
+
+void Animation::decodeDelta(struct CRGB strip[], uint16_t frame) {
+  prog_uint8_t* data = deltaFrame(frame) + 1;
+
+  uint8_t count = 0;
+  while(count < m_ledCount) {
+    uint8_t run = pgm_read_byte(data++);
+
+    if(run & DELTA_SKIP) {
+      count += run & 0x7F;
+      continue;
+    }
+
+    uint8_t upperByte = pgm_read_byte(data++);
+    uint8_t lowerByte = pgm_read_byte(data++);
+    
+    CRGB color = CRGB(((upperByte & 0xF8)     ),
+                      ((upperByte & 0x07) << 5)
+                    | ((lowerByte & 0xE0) >> 3),
+                      ((lowerByte & 0x1F) << 3));
+
+    for(uint8_t i = 0; i < run; i+=1) {
+      strip[count + i] = color;
+    }
+    count += run;
+  }
+}
@@ -4,8 +4,18 @@
 #include <Arduino.h>
 #include <FastSPI_LED2.h>
 
-#define ENCODING_RGB24      0
-#define ENCODING_RGB565_RLE 1
+#define ENCODING_RGB24        0
+#define ENCODING_RGB565_RLE   1
+#define ENCODING_RGB565_DELTA 2
+
+// ENCODING_RGB565_DELTA layout (see extras/animation_codec.py):
+//   frameCount little-endian uint16 offsets, one per frame, measured from the
+//   start of the data; then for each frame a flag byte (DELTA_KEYFRAME if it
+//   stands alone, 0 if it builds on the previous frame) followed by runs:
+//     0nnnnnnn hi lo  - n pixels of RGB565 color hi:lo
+//     1nnnnnnn        - n pixels unchanged from the previous frame
+#define DELTA_KEYFRAME        0x01
+#define DELTA_SKIP            0x80
 
 class Animation {
  private:
@@ -17,8 +27,15 @@ class Animation {
   uint16_t m_frameIndex;
   prog_uint8_t* currentFrameData;
 
+  // Last frame decoded into the strip, for delta frames
+  uint16_t m_lastFrame;
+
   void drawNoEncoding(struct CRGB strip[]);
   void draw16bitRLE(struct CRGB strip[]);
+  void drawDelta(struct CRGB strip[]);
+
+  prog_uint8_t* deltaFrame(uint16_t frame);
+  void decodeDelta(struct CRGB strip[], uint16_t frame);
   
  public:
   Animation();
@@ -38,6 +55,18 @@ class Animation {
   
   // Draw the next frame of the animation
   void draw(struct CRGB strip[]);
+
+  // Decode the next frame into the strip without showing it. Delta frames
+  // are drawn on top of whatever the last call left in the strip, so leave it
+  // alone between calls (or call setFrame() after changing it).
+  void load(struct CRGB strip[]);
+
+  // Choose the frame that the next draw() will show. Use this to play back
+  // in reverse or skip frames; RLE data has to be scanned from the start.
+  void setFrame(uint16_t frame);
+
+  uint16_t getFrame();
+  uint16_t getFrameCount();
 };
 
 #endif
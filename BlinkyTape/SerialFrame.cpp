@@ -0,0 +1,231 @@
+#include "SerialFrame.h"
+
+#ifdef __AVR__
+#include <util/crc16.h>
+#else
+static uint16_t _crc_ccitt_update(uint16_t crc, uint8_t data) {
+  data ^= crc & 0xFF;
+  data ^= data << 4;
+
+  return ((((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4)
+          ^ ((uint16_t)data << 3));
+}
+#endif
+
+enum {
+  STATE_SYNC1,
+  STATE_SYNC2,
+  STATE_TYPE,
+  STATE_SEQ,
+  STATE_LENGTH_LO,
+  STATE_LENGTH_HI,
+  STATE_PAYLOAD,
+  STATE_CRC_LO,
+  STATE_CRC_HI
+};
+
+// Payload run types, as in the top bits of each run's first byte
+#define OP_LITERAL 0x00
+#define OP_FILL    0x40
+#define OP_SKIP    0x80
+
+SerialFrame::SerialFrame(uint8_t* pixels,
+                         uint16_t pixelCount,
+                         uint8_t rOffset,
+                         uint8_t gOffset,
+                         uint8_t bOffset)
+{
+  m_pixels = pixels;
+  m_pixelCount = pixelCount;
+  m_offset[0] = rOffset;
+  m_offset[1] = gOffset;
+  m_offset[2] = bOffset;
+  m_state = STATE_SYNC1;
+  m_lastByte = 0;
+  m_errors = 0;
+
+  // Frames are decoded here and only copied to the strip once their CRC
+  // checks out. Without the RAM for it, they go straight to the strip.
+  m_staging = (uint8_t*)malloc(pixelCount*3);
+}
+
+SerialFrame::~SerialFrame() {
+  free(m_staging);
+}
+
+boolean SerialFrame::poll(Stream& stream) {
+  if(m_state != STATE_SYNC1 && stream.available() == 0
+     && millis() - m_lastByte > FRAME_TIMEOUT) {
+    m_state = STATE_SYNC1;
+  }
+
+  while(stream.available() > 0) {
+    m_lastByte = millis();
+    uint8_t c = stream.read();
+
+    if(feed(c)) {
+      if(!m_overflow && m_received == m_length
+         && m_channel == 0 && m_run == 0) {
+        if(m_staging) {
+          memcpy(m_pixels, m_staging, m_pixelCount*3);
+        }
+        return true;
+      }
+      m_errors++;
+      reply(stream, FRAME_NAK);
+    }
+  }
+  return false;
+}
+
+void SerialFrame::ack(Stream& stream) {
+  reply(stream, FRAME_ACK);
+}
+
+uint16_t SerialFrame::getErrors() {
+  return m_errors;
+}
+
+void SerialFrame::reply(Stream& stream, uint8_t code) {
+  stream.write(code);
+  stream.write(m_seq);
+}
+
+// Returns true at the end of a frame, good or bad. A damaged header ends the
+// frame early (with m_overflow set), so it gets a NAK rather than leaving the
+// sender to time out.
+boolean SerialFrame::feed(uint8_t c) {
+  switch(m_state) {
+    case STATE_SYNC1:
+      if(c == FRAME_SYNC1) {
+        m_state = STATE_SYNC2;
+      }
+      break;
+    case STATE_SYNC2:
+      if(c == FRAME_SYNC2) {
+        m_state = STATE_TYPE;
+      }
+      else if(c != FRAME_SYNC1) {
+        m_state = STATE_SYNC1;
+      }
+      break;
+    case STATE_TYPE:
+      m_crc = _crc_ccitt_update(0xFFFF, c);
+      m_type = c;
+      m_overflow = !(c == FRAME_RAW || c == FRAME_RUNS);
+      m_state = STATE_SEQ;
+      break;
+    case STATE_SEQ:
+      m_crc = _crc_ccitt_update(m_crc, c);
+      m_seq = c;
+      if(m_overflow) {
+        // Unknown type: NAK it, then look for the next header
+        m_state = STATE_SYNC1;
+        return true;
+      }
+      m_state = STATE_LENGTH_LO;
+      break;
+    case STATE_LENGTH_LO:
+      m_crc = _crc_ccitt_update(m_crc, c);
+      m_length = c;
+      m_state = STATE_LENGTH_HI;
+      break;
+    case STATE_LENGTH_HI:
+      m_crc = _crc_ccitt_update(m_crc, c);
+      m_length |= (uint16_t)c << 8;
+      m_received = 0;
+      m_pixel = 0;
+      m_channel = 0;
+      m_run = 0;
+      // Nothing sensible is longer than a fill run for every pixel, so
+      // this is a damaged header; NAK it and look for the next one.
+      if(m_length > m_pixelCount*4 + 4) {
+        m_overflow = true;
+        m_state = STATE_SYNC1;
+        return true;
+      }
+      if(m_staging) {
+        // Skipped pixels keep their colors from the last frame
+        memcpy(m_staging, m_pixels, m_pixelCount*3);
+      }
+      m_state = (m_length > 0) ? STATE_PAYLOAD : STATE_CRC_LO;
+      break;
+    case STATE_PAYLOAD:
+      m_crc = _crc_ccitt_update(m_crc, c);
+      payload(c);
+      if(++m_received == m_length) {
+        m_state = STATE_CRC_LO;
+      }
+      break;
+    case STATE_CRC_LO:
+      m_crc ^= c;
+      m_state = STATE_CRC_HI;
+      break;
+    case STATE_CRC_HI:
+      m_crc ^= (uint16_t)c << 8;
+      m_state = STATE_SYNC1;
+      if(m_crc != 0) {
+        m_overflow = true;
+      }
+      return true;
+  }
+  return false;
+}
+
+void SerialFrame::payload(uint8_t c) {
+  if(m_type == FRAME_RAW) {
+    put(m_pixel, m_channel, c);
+    if(++m_channel == 3) {
+      m_channel = 0;
+      m_pixel++;
+    }
+    return;
+  }
+
+  // Start of a run
+  if(m_run == 0) {
+    if(c & OP_SKIP) {
+      m_pixel += (c & 0x7F) + 1;
+      if(m_pixel > m_pixelCount) {
+        m_overflow = true;
+      }
+    }
+    else {
+      m_op = c & 0xC0;
+      m_run = (c & 0x3F) + 1;
+    }
+    return;
+  }
+
+  if(m_op == OP_LITERAL) {
+    put(m_pixel, m_channel, c);
+    if(++m_channel == 3) {
+      m_channel = 0;
+      m_pixel++;
+      m_run--;
+    }
+    return;
+  }
+
+  // A fill, once all three colors are in
+  m_color[m_channel] = c;
+  if(++m_channel < 3) {
+    return;
+  }
+  m_channel = 0;
+  for(; m_run > 0; m_run--) {
+    put(m_pixel, 0, m_color[0]);
+    put(m_pixel, 1, m_color[1]);
+    put(m_pixel, 2, m_color[2]);
+    m_pixel++;
+  }
+}
+
+void SerialFrame::put(uint16_t pixel, uint8_t channel, uint8_t value) {
+  if(pixel < m_pixelCount) {
+    (m_staging ? m_staging : m_pixels)[pixel*3 + m_offset[channel]] = value;
+  }
+  else {
+    m_overflow = true;
+  }
+}
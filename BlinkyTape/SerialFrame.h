@@ -0,0 +1,91 @@
+#ifndef SERIALFRAME_H
+#define SERIALFRAME_H
+
+#include <Arduino.h>
+
+// Framed pixel protocol for streaming from a PC (see extras/frame_sender.py).
+// Every frame is
+//
+//   0xA5 0x5A type seq lenLo lenHi payload[len] crcLo crcHi
+//
+// where the CRC is CRC-16/CCITT (as _crc_ccitt_update(), starting at 0xFFFF)
+// over everything from type to the end of the payload. A FRAME_RAW payload is
+// r,g,b for each pixel from the start of the strip. A FRAME_RUNS payload is a
+// list of runs, each starting with one byte:
+//
+//   00nnnnnn r g b ...  - n+1 pixels, each with its own color
+//   01nnnnnn r g b      - n+1 pixels of one color
+//   1nnnnnnn            - n+1 pixels left as they were in the last frame
+//
+// The board answers each frame with FRAME_ACK seq once it has been shown, or
+// FRAME_NAK seq if it was damaged (including a bad type or length). The sender waits for the answer before
+// sending the next frame, so nothing arrives while show() has interrupts off.
+#define FRAME_SYNC1 0xA5
+#define FRAME_SYNC2 0x5A
+
+#define FRAME_RAW   0
+#define FRAME_RUNS  1
+
+#define FRAME_ACK   0x06
+#define FRAME_NAK   0x15
+
+// Give up on a half received frame after this many milliseconds of silence
+#define FRAME_TIMEOUT 100
+
+class SerialFrame {
+ private:
+  uint8_t* m_pixels;
+  uint8_t* m_staging;
+  uint16_t m_pixelCount;
+  uint8_t m_offset[3];
+
+  uint8_t m_state;
+  uint8_t m_type;
+  uint8_t m_seq;
+  uint16_t m_length;
+  uint16_t m_crc;
+  uint16_t m_received;
+  unsigned long m_lastByte;
+  boolean m_overflow;
+
+  // Payload decoding
+  uint16_t m_pixel;
+  uint8_t m_channel;
+  uint8_t m_run;
+  uint8_t m_op;
+  uint8_t m_color[3];
+
+  uint16_t m_errors;
+
+  boolean feed(uint8_t c);
+  void payload(uint8_t c);
+  void put(uint16_t pixel, uint8_t channel, uint8_t value);
+  void reply(Stream& stream, uint8_t code);
+  
+ public:
+  // pixels is the strip's own buffer, 3 bytes per pixel. The offsets say
+  // where red, green and blue live in each pixel: 0,1,2 for a CRGB array,
+  // 1,0,2 for a NEO_GRB Adafruit_NeoPixel's getPixels().
+  SerialFrame(uint8_t* pixels,
+              uint16_t pixelCount,
+              uint8_t rOffset = 0,
+              uint8_t gOffset = 1,
+              uint8_t bOffset = 2);
+  ~SerialFrame();
+
+  // Read whatever has arrived. Returns true when a whole, undamaged frame
+  // has been written to the pixels; show it, then call ack(). Damaged
+  // frames (bad CRC, length, type or runs) are answered with FRAME_NAK here
+  // and leave the pixels as they were. That takes another 3 bytes of RAM
+  // per pixel; if there isn't enough, frames are decoded straight into the
+  // pixels and a damaged one may be partly written.
+  boolean poll(Stream& stream);
+
+  // Tell the sender the last frame is on the strip and it can send another
+  void ack(Stream& stream);
+
+  // Number of frames thrown away for bad CRCs, lengths or runs
+  uint16_t getErrors();
+};
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * Times how long Animation takes to decode a frame with each encoding, and
+ * how long a jump to a random frame costs. rle.h and delta.h hold the same
+ * animation (WeHeartOSHW), made with extras/animation_codec.py:
+ *
+ *   animation_codec.py pov.h --leds 60 -e rle -n rle -o rle.h
+ *   animation_codec.py pov.h --leds 60 -n delta -o delta.h
+ *
+ * Open the serial monitor to see the results.
+ */
+
+#include <FastSPI_LED2.h>
+#include <avr/pgmspace.h>
+#include <Animation.h>
+#include "rle.h"
+#include "delta.h"
+
+#define LED_COUNT 60
+struct CRGB leds[LED_COUNT];
+
+void report(const char* name, Animation& animation) {
+  uint16_t frames = animation.getFrameCount();
+  unsigned long start;
+
+  animation.reset();
+  start = micros();
+  for(uint16_t i = 0; i < frames; i++) {
+    animation.load(leds);
+  }
+  unsigned long sequential = micros() - start;
+
+  start = micros();
+  for(uint8_t i = 0; i < 32; i++) {
+    animation.setFrame(random(frames));
+    animation.load(leds);
+  }
+  unsigned long seek = micros() - start;
+
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(sequential / frames);
+  Serial.print(" us/frame, ");
+  Serial.print(seek / 32);
+  Serial.println(" us/seek");
+}
+
+void setup()
+{
+  Serial.begin(57600);
+  while(!Serial);
+
+  report("RLE", rle);
+  report("Delta", delta);
+}
+
+void loop()
+{
+}
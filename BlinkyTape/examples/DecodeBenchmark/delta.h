@@ -0,0 +1,535 @@
+// Data file for animation delta
+// Compression: 16 bit RLE, delta from previous frame
+// Uncompressed size: 51660 bytes
+// Compressed size: 6327 bytes
+const PROGMEM prog_uint8_t deltaData[]  = {
+   62,   2,  66,   2,  68,   2,  70,   2,  72,   2,  74,   2,
+   76,   2,  78,   2,  80,   2,  92,   2, 116,   2, 141,   2,
+  162,   2, 183,   2, 204,   2, 225,   2, 246,   2,  11,   3,
+   32,   3,  57,   3,  91,   3, 134,   3, 171,   3, 202,   3,
+  226,   3, 250,   3,  28,   4,  50,   4,  80,   4, 110,   4,
+  140,   4, 170,   4, 215,   4,   9,   5,  41,   5,  71,   5,
+   97,   5, 123,   5, 149,   5, 172,   5, 206,   5, 233,   5,
+    7,   6,  41,   6,  81,   6, 130,   6, 164,   6, 195,   6,
+  222,   6, 252,   6,  23,   7,  44,   7,  71,   7,  98,   7,
+  122,   7, 149,   7, 191,   7, 235,   7,  11,   8,  40,   8,
+   64,   8,  84,   8, 104,   8, 124,   8, 144,   8, 164,   8,
+  187,   8, 211,   8, 231,   8, 235,   8, 237,   8, 239,   8,
+  241,   8,   0,   9,  18,   9,  27,   9,  29,   9,  31,   9,
+   33,   9,  35,   9,  37,   9,  39,   9,  41,   9,  60,   9,
+  100,   9, 119,   9, 121,   9, 123,   9, 125,   9, 127,   9,
+  129,   9, 131,   9, 133,   9, 135,   9, 137,   9, 139,   9,
+  141,   9, 143,   9, 145,   9, 147,   9, 149,   9, 151,   9,
+  153,   9, 155,   9, 161,   9, 173,   9, 185,   9, 201,   9,
+  216,   9, 231,   9, 235,   9, 237,   9, 239,   9, 241,   9,
+  243,   9, 245,   9, 247,   9, 249,   9, 251,   9, 253,   9,
+  255,   9,   1,  10,   3,  10,   5,  10,   7,  10,  25,  10,
+   61,  10,  91,  10, 115,  10, 136,  10, 160,  10, 181,  10,
+  202,  10, 223,  10, 245,  10,   7,  11,  29,  11,  66,  11,
+  107,  11, 148,  11, 190,  11, 231,  11,  19,  12,  63,  12,
+   96,  12, 129,  12, 163,  12, 201,  12, 242,  12,  23,  13,
+   64,  13,  89,  13, 114,  13, 133,  13, 155,  13, 180,  13,
+  202,  13, 227,  13, 249,  13,  18,  14,  49,  14,  77,  14,
+   99,  14, 124,  14, 153,  14, 176,  14, 197,  14, 221,  14,
+  242,  14,  12,  15,  33,  15,  54,  15,  75,  15,  99,  15,
+  123,  15, 146,  15, 167,  15, 189,  15, 206,  15, 227,  15,
+  245,  15,  13,  16,  37,  16,  55,  16,  74,  16,  95,  16,
+  119,  16, 143,  16, 167,  16, 188,  16, 209,  16, 236,  16,
+    4,  17,  31,  17,  61,  17,  88,  17, 124,  17, 161,  17,
+  183,  17, 187,  17, 189,  17, 191,  17, 193,  17, 195,  17,
+  197,  17, 199,  17, 201,  17, 203,  17, 205,  17, 207,  17,
+  209,  17, 211,  17, 213,  17, 215,  17, 239,  17, 254,  17,
+   14,  18,  30,  18,  42,  18,  55,  18,  82,  18, 121,  18,
+  169,  18, 244,  18,  47,  19,  95,  19, 112,  19, 127,  19,
+  142,  19, 157,  19, 172,  19, 188,  19, 203,  19, 221,  19,
+  237,  19, 250,  19,  10,  20,  22,  20,  63,  20, 109,  20,
+  148,  20, 191,  20, 247,  20,  25,  21,  41,  21,  53,  21,
+   65,  21,  74,  21,  80,  21,  89,  21,  97,  21, 119,  21,
+  165,  21, 217,  21,   6,  22,  44,  22,  99,  22, 130,  22,
+  146,  22, 162,  22, 174,  22, 187,  22, 202,  22, 217,  22,
+  233,  22, 248,  22,   6,  23,  21,  23,  33,  23,  68,  23,
+  130,  23, 194,  23, 252,  23,  43,  24,  81,  24, 100,  24,
+  112,  24, 125,  24, 138,  24, 154,  24, 167,  24, 171,  24,
+  173,  24, 175,  24, 177,  24, 179,  24, 181,  24,   1,  60,
+    0,   0,   0, 188,   0, 188,   0, 188,   0, 188,   0, 188,
+    0, 188,   0, 188,   0, 135,   1,   2, 242,   1,   3, 150,
+    1,   0,  11, 178,   0, 135,   1, 206, 186,   1, 255, 255,
+    1, 215, 191,   1, 158, 126,   1,  68, 153,   1,   1, 113,
+    1,   0,   5, 174,   0, 135,   1, 214, 154, 129,   3, 255,
+  255,   1, 239, 255,   1, 183,  95,   1, 117, 156,   1,   3,
+   53,   1,   0,  12, 171,   0, 140,   4, 255, 255,   1, 215,
+  191,   1, 158, 158,   1,  76, 153,   1,   2,  18,   1,   0,
+    8, 167,   0, 144,   3, 255, 255,   1, 239, 255,   1, 191,
+   95,   1, 125, 188,   1,   3, 150,   1,   0,  12, 164,   0,
+  147,   4, 255, 255,   1, 215, 223,   1, 158, 158,   1,  76,
+  217,   1,   2,  18,   1,   0,   8, 160,   0, 151,   3, 255,
+  255,   1, 239, 255,   1, 191,  95,   1, 125, 188,   1,   3,
+  150,   1,   0,  14, 157,   0, 154,   4, 255, 255,   1, 223,
+  223,   1, 158, 190,   1,  76, 218,   1,   2,  19,   1,   0,
+    8, 153,   0, 158,   3, 255, 255,   1, 239, 255,   1, 199,
+  127,   1, 133, 252,   1,  43, 214,   1,   0,  14, 150,   0,
+  161,   4, 255, 255,   1, 223, 223,   1, 166, 254,   1,  92,
+  250,   1,   2, 115,   1,   0,   9, 146,   0, 135,   1, 214,
+  186, 157,   3, 255, 255,   1, 247, 255,   1, 199, 127,   1,
+  134,  29,   1,  43, 215,   1,   0,  15, 143,   0, 135,   1,
+  188, 204,   1, 255,  22,   1, 255, 219,   1, 255, 254, 157,
+    4, 255, 255,   1, 231, 255,   1, 166, 254,   1,  92, 250,
+    1,   2, 115,   1,   0,   9, 139,   1,   9,   0,   0,   1,
+  112,   0,   1, 171,  32,   1, 212, 236,   1, 246, 147,   1,
+  255, 185,   1, 255, 253,  32, 255, 255,   1, 247, 255,   1,
+  207, 159,   1, 142,  29,   1,  44,  23,   1,   0,  15,   8,
+    0,   0,   1,  13,   0,   0,   1,  88,   0,   1, 154,  96,
+    1, 204, 137,   1, 238,  81,   1, 255, 119,   1, 255, 252,
+   32, 255, 255,   1, 231, 255,   1, 175,  30,   1,  92, 250,
+    6,   0,   0,   1,  17,   0,   0,   1,  64,   0,   1, 129,
+   96,   1, 187, 197,   1, 229, 175,   1, 255,  22,   1, 255,
+  219,   1, 255, 254,  30, 255, 255,   6,   0,   0,   0, 145,
+    5,   0,   0,   1, 112,   0,   1, 171,  32,   1, 213,  44,
+    1, 246, 179,   1, 255, 185,   1, 255, 253, 160,   0, 150,
+    4,   0,   0,   1,  88,   0,   1, 154,  96,   1, 204, 137,
+    1, 238,  81,   1, 255, 120,   1, 255, 252, 156,   0, 154,
+    4,   0,   0,   1,  64,   0,   1, 137,  96,   1, 187, 200,
+    1, 229, 175,   1, 246, 180,   1, 255, 185,   1, 255, 253,
+    1, 255, 254, 130,   1, 255, 223, 147,   1,  35,   0,   0,
+    1,  64,   0,   1, 128,   9,   1, 172,  19,   1, 222,  89,
+   15, 255, 255,   6,   0,   0,   0, 158,   1,   0,   5,   1,
+    0,  11,   1,   2,  19,   1,  68,  88,   1, 125, 188,   1,
+  158, 190,   1, 207, 159,   1, 231, 255,   1, 247, 255, 149,
+    0, 153,   1,   0,   5,   1,   0,  12,   1,   2, 115,   1,
+   68,  89,   1, 133, 252,   1, 174, 254,   1, 215, 191,   1,
+  247, 255,  21, 255, 255, 134,   0, 148,   1,   0,   8,   1,
+    0,  14,   1,   2, 115,   1,  76, 153,   1, 142,  29,   1,
+  183,  31,   1, 215, 191,   1, 247, 255,  26, 255, 255, 134,
+    0, 143,   1,   0,   8,   1,   0,  15,   1,   2, 244,   1,
+   76, 217,   1, 142,  93,   1, 183,  63,   1, 215, 223,   1,
+  247, 255,  31, 255, 255, 134,   0, 138,   1,   0,   8,   1,
+    1, 112,   1,   3,  53,   1,  76, 218,   1, 150, 125,   1,
+  191,  95,   1, 223, 223,   1, 247, 255,  31, 255, 255,   1,
+  255, 254,   1, 255, 219,   1, 255,  54,   1, 238,  17,   1,
+  204, 137, 134,   0, 135,   1,  43,  51,   1,  92, 250,   1,
+  150, 126,   1, 199, 127,   1, 231, 255,   1, 247, 255,  31,
+  255, 255,   1, 255, 254,   1, 255, 252,   1, 255,  87,   1,
+  238,  82,   1, 212, 201,   1, 162, 224,   1, 112,   0,   1,
+   40,   0,   8,   0,   0,   0, 135,   1, 206, 186,  32, 255,
+  255,   1, 255, 252,   1, 255, 120,   1, 246, 115,   1, 212,
+  235,   1, 171,  32,   1, 120,   0,   1,  64,   0,  13,   0,
+    0,   0, 135,   1, 214, 154, 155,   1, 255, 253,   1, 255,
+  153,   1, 246, 147,   1, 221,  44,   1, 179, 133,   1, 129,
+   96,   1,  64,   0,  18,   0,   0,   0, 158,   1, 255, 253,
+    1, 255, 185,   1, 246, 180,   1, 229, 142,   1, 187, 200,
+    1, 146,   0,   1,  72,   0,  23,   0,   0,   0, 153,   1,
+  255, 253,   1, 255, 186,   1, 254, 245,   1, 229, 175,   1,
+  196,  72,   1, 146,   0,   1,  88,   0,  28,   0,   0,   0,
+  148,   1, 255, 188,   1, 255,  56,   1, 246, 113,   1, 213,
+   43,   1, 188,   5,   1, 154,   0,   1,  88,   0,  33,   0,
+    0,   0, 148,   1, 223,  62,   1, 157, 252,   1,  68,  25,
+    1,   2, 115,   1,   0,  16,   1,   0,   9,  34,   0,   0,
+    0, 146,   1, 255, 223, 129,   3, 255, 255,   1, 247, 255,
+    1, 231, 255,   1, 207, 127,   1, 158, 158,   1, 101,  58,
+    1,  43, 150,   1,   1, 113,   1,   0,   9, 157,   0, 146,
+   11, 255, 255,   1, 231, 255,   1, 207, 127,   1, 150, 126,
+    1,  92, 250,   1,   3,  53,   1,   0,  15,   1,   0,   8,
+  152,   0, 157,   4, 255, 255,   1, 247, 255,   1, 231, 255,
+    1, 191,  95,   1, 150,  93,   1,  76, 218,   1,   2, 244,
+    1,   0,  14,   1,   0,   5, 147,   0, 135,   1, 214, 187,
+  153,   5, 255, 255,   1, 247, 255,   1, 223, 223,   1, 183,
+   63,   1, 142,  29,   1,  76, 153,   1,   2, 115,   1,   0,
+   12,   1,   0,   5, 142,   0, 135,   1, 205,  47,   1, 255,
+  120,   1, 255, 252,   1, 255, 254, 155,   5, 255, 255,   1,
+  247, 255,   1, 215, 191,   1, 183,  31,   1, 133, 252,   1,
+   68,  89,   1,   2,  19,   1,   0,  11, 138,   1,   8,   0,
+    0,   1,  64,   0,   1, 121,  96,   1, 171,  32,   1, 212,
+  235,   1, 246, 147,   1, 255, 121,   1, 255, 252,  33, 255,
+  255,   1, 247, 255,   1, 215, 191,   1, 166, 254,   1, 125,
+  156,   1,  68,  24,   1,   2,  18,   6,   0,   0,   1,  13,
+    0,   0,   1,  64,   0,   1, 137,  96,   1, 179, 197,   1,
+  221,  76,   1, 246, 179,   1, 255, 153,   1, 255, 253,  33,
+  255, 255,   1, 239, 255,   6,   0,   0,   1,  18,   0,   0,
+    1,  72,   0,   1, 146,   0,   1, 188,   8,   1, 229, 143,
+    1, 246, 244,   1, 255, 186,   1, 255, 253,  29, 255, 255,
+    6,   0,   0,   0, 146,   5,   0,   0,   1,  88,   0,   1,
+  154,  96,   1, 204,  72,   1, 229, 240,   1, 255,  22,   1,
+  255, 218,   1, 255, 254, 158,   0, 151,   4,   0,   0,   1,
+   40,   0,   1,  96,   0,   1, 154,  96,   1, 204, 137,   1,
+  238,  81,   1, 255,  54,   1, 255, 219,   1, 255, 254, 153,
+    0, 155,   5,   0,   0,   1,  40,   0,   1, 112,   0,   1,
+  162, 224,   1, 204, 136,   1, 238,  15,   1, 254, 245,   1,
+  255, 122, 149,   0, 160,   2,   0,   0,   1,   0,   9,   1,
+    0,  17,   1,   3,  54,   1, 116, 250,   1, 182, 157, 149,
+    0, 158,   1,   0,  14,   1,   2, 244,   1,  92, 250,   1,
+  158, 158,   1, 207, 159,   1, 239, 255,   4, 255, 255,   1,
+  255, 223, 147,   0, 153,   1,   0,   8,   1,   1, 112,   1,
+   43, 214,   1, 117, 156,   1, 175,  30,   1, 215, 223,   1,
+  247, 255,  22, 255, 255, 134,   0, 149,   1,   0,   9,   1,
+    2,  19,   1,  68,  89,   1, 142,  29,   1, 191,  95,   1,
+  231, 255,  27, 255, 255, 134,   0, 145,   1,   0,  14,   1,
+    2, 244,   1,  92, 250,   1, 158, 158,   1, 207, 159,   1,
+  239, 255,  30, 255, 255,   1, 255, 186, 134,   0, 140,   1,
+    0,   8,   1,   1, 112,   1,  43, 214,   1, 117, 156,   1,
+  174, 254,   1, 215, 223,   1, 247, 255,  30, 255, 255,   1,
+  255, 253,   1, 255,  87,   1, 229, 175,   1, 179, 133,   1,
+   96,   0, 134,   0, 136,   1,   0,   9,   1,   2,  18,   1,
+   68,  89,   1, 142,  29,   1, 191,  95,   1, 231, 255,  31,
+  255, 255,   1, 255, 254,   1, 255, 186,   1, 246, 147,   1,
+  204, 137,   1, 138,   0,   1,  64,   0,   9,   0,   0,   0,
+  135,   1, 125,  89,   1, 207, 191,   1, 239, 255,  32, 255,
+  255,   1, 255, 252,   1, 255,  54,   1, 229, 142,   1, 171,
+   32,   1,  96,   0,  13,   0,   0,   0, 135,   1, 222, 186,
+   30, 255, 255,   1, 255, 254,   1, 255, 185,   1, 246, 114,
+    1, 204,  72,   1, 137,  96,   1,  40,   0,  16,   0,   0,
+    0, 135,   1, 214, 154, 155,   1, 255, 252,   1, 255,  22,
+    1, 221,  78,   1, 162, 224,   1,  88,   0,  20,   0,   0,
+    0, 159,   1, 255, 254,   1, 255, 153,   1, 238,  81,   1,
+  196,   8,   1, 128,   0,  24,   0,   0,   0, 156,   1, 255,
+  252,   1, 254, 245,   1, 213,  44,   1, 154,  96,   1,  72,
+    0,  27,   0,   0,   0, 152,   1, 255, 253,   1, 255, 120,
+    1, 238,  16,   1, 187, 197,   1, 120,   0,  31,   0,   0,
+    0, 149,   1, 255, 219,   1, 246, 180,   1, 212, 203,   1,
+  154,  96,   1,  64,   0,  34,   0,   0,   0, 145,   1, 255,
+  253,   1, 255,  87,   1, 229, 175,   1, 179, 133,   1, 112,
+    0,  38,   0,   0,   0, 141,   1, 255, 254,   1, 255, 218,
+    1, 246, 147,   1, 204, 201,   1, 146,   0,   1,  64,   0,
+   41,   0,   0,   0, 135,   1, 214, 186, 130,   1, 255, 253,
+    1, 255,  86,   1, 229, 143,   1, 171,  32,   1,  96,   0,
+   45,   0,   0,   0, 135,   1, 205,  79,   1, 246, 147,   1,
+  204,  73,   1, 137,  96,   1,  40,   0,  48,   0,   0,   1,
+   60,   0,   0,   0, 188,   0, 188,   0, 188,   0, 135,   1,
+    1, 110,   1,   2, 115,  44,   2,  19,   1,   2,  18, 134,
+    0, 135,   1, 190, 154,   1, 247, 255,  43, 239, 255,   1,
+  247, 255,   1, 239, 255, 134,   0, 135,   1, 214, 154,  46,
+  255, 255, 134,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  188,   0, 188,   0, 188,   0, 144,   1, 255, 218,   1, 255,
+  153,   6, 255, 185,   1, 255, 153, 137,  11, 255, 185, 143,
+    0, 144,   1, 113, 101,   6,  72,   0,   1,  88,   0,   1,
+   64,   0,   1, 230, 251, 135,   1, 255, 190,   1,  72,   0,
+    1,  88,   0,   7,  72,   0,   1,  88,   0,   1,  64,   0,
+    1, 247, 158, 142,   0, 144,   1,  66,   8,   8,   0,   0,
+    1, 222, 251, 135,   1, 247, 158,  11,   0,   0, 143,   0,
+  188,   0, 188,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  188,   0, 188,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  188,   0, 188,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  153,   1, 222, 252, 162,   0, 153,   1, 231,  25,   7, 255,
+  254,   1, 255, 188, 154,   0, 153,   1, 130,   0,   7, 154,
+   96,   1, 146,   0, 154,   0, 135,   1, 214, 184,   8, 255,
+  254,   1,  66,   5, 136,  20,   0,   0, 143,   0, 135,   1,
+  122,   0,   8, 154,  96,  29,   0,   0,   1, 247, 222, 142,
+    0, 135,  38,   0,   0,   1, 188,   8,   7, 212, 203,   1,
+  204, 137, 134,   1,  60,   0,   0,   0, 188,   0, 188,   0,
+  188,   0, 188,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  188,   0, 188,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  141,   1,  16,   0,   1,  48,   0,   2,  64,   0,   1,  56,
+    0,   1,  32,   0, 169,   0, 139,   1,  16,   0,   1,  64,
+    0,   1, 120,   0,   1, 168,   0,   1, 200,   0,   1, 216,
+    0,   1, 192,   0,   1, 144,   0,   1,  80,   0,   1,  40,
+    0,   1,   8,   0, 166,   0, 138,   1,  64,   0,   1, 144,
+    0,   1, 200,   0,   1, 232,   0,   5, 248,   0,   1, 208,
+    0,   1, 176,   0,   1, 112,   0,   1,  32,   0, 165,   0,
+  136,   1,  16,   0,   1,  88,   0,   1, 184,   0,  10, 248,
+    0,   1, 240,   0,   1, 152,   0,   1,  56,   0, 164,   0,
+  135,   1,  16,   0,   1, 104,   0,   1, 208,   0,  13, 248,
+    0,   1, 176,   0,   1,  64,   0, 163,   0, 134,   1,   8,
+    0,   1, 112,   0,   1, 216,   0,  15, 248,   0,   1, 184,
+    0,   1,  72,   0,   1,   8,   0, 161,   0, 134,   1,  88,
+    0,   1, 208,   0,  17, 248,   0,   1, 192,   0,   1,  96,
+    0,   1,  16,   0, 160,   0, 133,   1,  56,   0,   1, 184,
+    0,  19, 248,   0,   1, 208,   0,   1, 104,   0,   1,  24,
+    0, 159,   0, 132,   1,  24,   0,   1, 144,   0,  21, 248,
+    0,   1, 216,   0,   1, 120,   0,   1,  32,   0, 158,   0,
+  132,   1,  72,   0,   1, 216,   0, 149,   1, 248,   0,   1,
+  224,   0,   1, 120,   0,   1,  16,   0, 157,   0, 131,   1,
+   16,   0,   1, 128,   0,  24, 248,   0,   1, 192,   0,   1,
+   72,   0, 157,   0, 131,   1,  72,   0,   1, 200,   0, 152,
+    1, 248,   0,   1, 176,   0,   1,  88,   0,   1,  32,   0,
+  155,   0, 131,   1, 120,   0,   4, 248,   0,   1, 248,   3,
+    1, 249, 137,   1, 250, 172,   1, 250, 139,   1, 248,  70,
+  145,   1, 248,   0,   1, 224,   0,   1, 152,   0,   1,  56,
+    0, 154,   0, 130,   1,  24,   0,   1, 152,   0, 131,   1,
+  250,  42,   1, 252,  49,   1, 253,  85,   1, 253, 215,   1,
+  253,  85,   1, 251, 110,   1, 248,   3, 145,   2, 248,   0,
+    1, 160,   0,   1,  48,   0, 153,   0, 130,   1,  48,   0,
+    1, 168,   0, 130,   1, 248, 199,   1, 253,  20,   1, 254,
+  219,   2, 255,  60,   1, 254, 121,   1, 252,  81,   1, 248,
+    5, 147,   1, 248,   0,   1, 136,   0,   1,  24,   0, 152,
+    0, 129,   1,   8,   0,   1,  72,   0,   1, 192,   0, 130,
+    1, 250, 140,   1, 254,  57,   1, 255, 125, 129,   1, 254,
+  219,   1, 253, 215,   1, 251, 110,   1, 248,   2, 148,   1,
+  224,   0,   1,  96,   0, 152,   0, 129,   1,  16,   0,   1,
+  104,   0,   1, 216,   0, 130,   1, 251,  78, 129,   1, 254,
+  251,   1, 254, 154,   1, 253, 183,   1, 251, 208,   1, 248,
+  103,  22, 248,   0,   1, 176,   0,   1,  56,   0, 151,   0,
+  129,   1,  32,   0,   1, 136,   0,   1, 240,   0, 129,   1,
+  248,   6,   1, 252,  82,   1, 254,  89, 129,   1, 254, 122,
+    1, 252, 179,   1, 249,  72,  24, 248,   0,   1, 168,   0,
+    1,  72,   0,   1,   8,   0, 149,   0, 129,   1,  48,   0,
+    1, 168,   0,   2, 248,   0,   1, 250,  75,   1, 253,  53,
+    1, 254, 154, 129,   1, 254, 121,   1, 251, 240,   1, 248,
+    1, 152,   1, 248,   0,   1, 184,   0,   1,  96,   0,   1,
+    8,   0, 148,   0, 129,   1,  64,   0,   1, 184,   0, 130,
+    1, 251,  46,   1, 253, 215, 129,   1, 254, 219, 129,   1,
+  251, 208,  27, 248,   0,   1, 208,   0,   1,  96,   0, 148,
+    0, 129,   1,  72,   0,   1, 200,   0, 130,   1, 251, 208,
+    1, 254,  57, 129,   1, 254, 186,   1, 254,  89, 156,   1,
+  248,   0,   1, 208,   0,   1,  88,   0, 147,   0, 132,   1,
+  248,   1,   1, 252,  49,   1, 254, 154,   1, 254, 219,   1,
+  254, 154,   1, 253, 248,   1, 251, 110, 156,   1, 248,   0,
+    1, 208,   0,   1,  88,   0, 146,   0, 130,   1, 192,   0,
+  129,   1, 248,   2,   1, 252, 114,   1, 255,  28,   1, 255,
+  158,   1, 254, 251,   1, 253, 118,   1, 250,  75, 157,   1,
+  248,   0,   1, 208,   0,   1,  80,   0, 145,   0, 129,   1,
+   56,   0,   1, 176,   0, 129,   1, 248,   0,   1, 251, 240,
+    1, 254, 251,   1, 255, 190,   1, 254, 219,   1, 252,  82,
+    1, 248,   5, 158,   1, 248,   0,   1, 208,   0,   1,  80,
+    0, 144,   0, 129,   1,  48,   0,   1, 152,   0, 130,   1,
+  250, 107,   1, 253,  85,   1, 254,  89,   1, 253,  85,   1,
+  250, 107,  33, 248,   0,   1, 216,   0,   1, 104,   0,   1,
+    8,   0, 142,   0, 129,   1,  24,   0,   1, 120,   0,   1,
+  232,   0, 129,   1, 248,   2,   1, 250,  10,   1, 251,  13,
+    1, 250,  42,   1, 248,   2, 161,   1, 248,   0,   1, 232,
+    0,   1, 112,   0,   1,  16,   0, 141,   0, 129,   1,   8,
+    0,   1,  88,   0,   1, 200,   0, 129,  40, 248,   0,   1,
+  224,   0,   1, 120,   0,   1,  32,   0, 140,   1,   2,   0,
+    0,   1,  48,   0,   1, 168,   0,  42, 248,   0,   1, 232,
+    0,   1, 128,   0,   1,  24,   0,  11,   0,   0,   0, 130,
+    1,  32,   0,   1, 160,   0, 170,   1, 248,   0,   1, 224,
+    0,   1,  96,   0, 139,   0, 130,   1,  16,   0,   1, 144,
+    0, 171,   1, 248,   0,   1, 200,   0,   1,  96,   0,   1,
+   24,   0, 137,   1,   3,   0,   0,   1, 104,   0,   1, 232,
+    0,  44, 248,   0,   1, 216,   0,   1, 128,   0,   1,  32,
+    0,   8,   0,   0,   0, 131,   1,  48,   0,   1, 168,   0,
+  172,   1, 248,   0,   1, 240,   0,   1, 136,   0,   1,  24,
+    0, 135,   1,   4,   0,   0,   1,  96,   0,   1, 232,   0,
+   45, 248,   0,   1, 232,   0,   1, 104,   0,   1,   8,   0,
+    6,   0,   0,   0, 132,   1,  40,   0,   1, 176,   0, 173,
+    1, 248,   0,   1, 200,   0,   1,  88,   0,   1,   8,   0,
+  133,   0, 132,   1,   8,   0,   1, 104,   0,   1, 224,   0,
+  173,   1, 248,   0,   1, 192,   0,   1,  88,   0,   1,   8,
+    0, 132,   1,   5,   0,   0,   1,  24,   0,   1, 128,   0,
+    1, 232,   0,  46, 248,   0,   1, 208,   0,   1, 112,   0,
+    1,  40,   0,   1,   8,   0,   2,   0,   0,   1,   6,   0,
+    0,   1,  48,   0,   1, 176,   0,  47, 248,   0,   1, 232,
+    0,   1, 160,   0,   1,  72,   0,   1,   8,   0,   1,   0,
+    0,   0, 134,   1,  32,   0,   1, 160,   0, 175,   1, 248,
+    0,   1, 224,   0,   1, 120,   0,   1,  24,   0, 129,   0,
+  133,   1,   8,   0,   1,  96,   0,   1, 216,   0, 175,   1,
+  232,   0,   1, 160,   0,   1,  72,   0,   1,   8,   0, 129,
+    0, 133,   1,  80,   0,   1, 200,   0,  46, 248,   0,   1,
+  240,   0,   1, 184,   0,   1, 104,   0,   1,  48,   0,   1,
+    8,   0,   2,   0,   0,   0, 132,   1,  32,   0,   1, 160,
+    0,  47, 248,   0,   1, 192,   0,   1,  96,   0,   1,  16,
+    0,   4,   0,   0,   0, 132,   1,  72,   0,   1, 224,   0,
+  174,   1, 224,   0,   1, 136,   0,   1,  40,   0,   5,   0,
+    0,   0, 131,   1,  24,   0,   1, 144,   0,  46, 248,   0,
+    1, 240,   0,   1, 160,   0,   1,  72,   0,   1,  16,   0,
+  133,   0, 131,   1,  96,   0,   1, 216,   0, 174,   1, 176,
+    0,   1,  88,   0,   1,  24,   0,   6,   0,   0,   0, 130,
+    1,   8,   0,   1, 136,   0,  45, 248,   0,   1, 240,   0,
+    1, 168,   0,   1,  80,   0,   1,  16,   0,   7,   0,   0,
+    0, 130,   1,  16,   0,   1, 144,   0, 173,   1, 160,   0,
+    1,  72,   0,   1,   8,   0,   8,   0,   0,   0, 130,   1,
+   32,   0,   1, 152,   0, 172,   1, 176,   0,   1,  72,   0,
+    1,   8,   0,   9,   0,   0,   0, 130,   1,  56,   0,   1,
+  168,   0, 170,   1, 240,   0,   1, 168,   0,   1,  72,   0,
+   11,   0,   0,   0, 129,   1,   8,   0,   1,  96,   0,   1,
+  208,   0, 169,   1, 232,   0,   1, 144,   0,   1,  48,   0,
+   12,   0,   0,   0, 129,   1,  32,   0,   1, 136,   0,   1,
+  240,   0, 168,   1, 240,   0,   1, 152,   0,   1,  48,   0,
+   13,   0,   0,   0, 129,   1,  56,   0,   1, 168,   0,  40,
+  248,   0,   1, 216,   0,   1, 152,   0,   1,  64,   0,  14,
+    0,   0,   0, 129,   1,  64,   0,   1, 192,   0, 167,   1,
+  224,   0,   1, 144,   0,   1,  64,   0,  15,   0,   0,   0,
+  129,   1,  72,   0,   1, 200,   0, 166,   1, 240,   0,   1,
+  160,   0,   1,  72,   0,   1,  16,   0, 143,   0, 168,   1,
+  232,   0,   1, 160,   0,   1,  80,   0,   1,  16,   0,  16,
+    0,   0,   0, 129,   1,  64,   0,   1, 184,   0, 165,   1,
+  160,   0,   1,  64,   0,   1,   8,   0,  17,   0,   0,   0,
+  129,   1,  48,   0,   1, 152,   0, 164,   1, 168,   0,   1,
+   64,   0,  19,   0,   0,   0, 129,   1,  24,   0,   1, 112,
+    0,   1, 224,   0, 161,   1, 216,   0,   1, 144,   0,   1,
+   64,   0,  20,   0,   0,   0, 129,   1,   0,   0,   1,  72,
+    0,   1, 192,   0, 160,   1, 216,   0,   1, 120,   0,   1,
+   40,   0,  21,   0,   0,   0, 130,   1,  48,   0,   1, 168,
+    0, 160,   1, 160,   0,   1,  56,   0,  22,   0,   0,   0,
+  130,   1,  24,   0,   1, 152,   0, 159,   1, 192,   0,   1,
+   96,   0,   1,  24,   0, 150,   0, 130,   1,   8,   0,   1,
+  144,   0, 158,   1, 200,   0,   1, 112,   0,   1,  32,   0,
+   23,   0,   0,   0, 130,   1,   0,   0,   1, 112,   0,   1,
+  240,   0, 156,   1, 184,   0,   1, 112,   0,   1,  48,   0,
+   24,   0,   0,   0, 131,   1,  56,   0,   1, 176,   0, 154,
+    1, 240,   0,   1, 168,   0,   1,  88,   0,   1,  24,   0,
+   25,   0,   0,   0, 131,   1,   0,   0,   1, 104,   0,   1,
+  232,   0, 153,   1, 184,   0,   1,  88,   0,   1,  16,   0,
+   26,   0,   0,   0, 132,   1,  64,   0,   1, 208,   0, 152,
+    1, 192,   0,   1, 104,   0,   1,  32,   0,  27,   0,   0,
+    0, 132,   1,  24,   0,   1, 128,   0, 151,   1, 176,   0,
+    1,  88,   0,   1,  24,   0,  28,   0,   0,   0, 132,   1,
+    0,   0,   1,  40,   0,   1, 160,   0, 148,   1, 232,   0,
+    1, 144,   0,   1,  56,   0,   1,   8,   0,  29,   0,   0,
+    0, 133,   1,   0,   0,   1,  64,   0,   1, 184,   0, 146,
+    1, 240,   0,   1, 136,   0,   1,  40,   0,  31,   0,   0,
+    0, 134,   1,   0,   0,   1,  88,   0,   1, 192,   0, 143,
+    1, 216,   0,   1, 184,   0,   1, 136,   0,   1,  48,   0,
+   32,   0,   0,   0, 135,   1,   8,   0,   1,  80,   0,   1,
+  176,   0, 140,   1, 224,   0,   1, 152,   0,   1,  96,   0,
+    1,  56,   0,   1,  32,   0,  33,   0,   0,   0, 135,   2,
+    0,   0,   1,  64,   0,   1, 168,   0, 138,   1, 208,   0,
+    1, 128,   0,   1,  48,   0,   1,   8,   0,  35,   0,   0,
+    0, 137,   1,   0,   0,   1,  48,   0,   1, 120,   0,   1,
+  176,   0,   1, 216,   0, 132,   1, 232,   0,   1, 184,   0,
+    1, 144,   0,   1,  88,   0,   1,  24,   0,  37,   0,   0,
+    1,  11,   0,   0,   1,   8,   0,   1,  40,   0,   1,  88,
+    0,   1, 144,   0,   1, 200,   0,   1, 208,   0,   1, 176,
+    0,   1, 120,   0,   1,  64,   0,   1,  24,   0,  39,   0,
+    0,   1,  14,   0,   0,   1,  32,   0,   1,  56,   0,   1,
+   64,   0,   1,  48,   0,   1,  24,   0,  41,   0,   0,   1,
+   60,   0,   0,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  188,   0, 188,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  188,   0, 188,   0, 188,   0, 188,   0, 156,   1,   1, 200,
+    1,   4, 149,   1,   4, 116,   5,   4,  83,   1,   4, 149,
+    1,   3,  46,   1,   0,  65, 149,   0, 156,   1,   2, 172,
+    8,   4, 214,   1,   4,  18,   1,   1,   4, 149,   0, 155,
+    1,   0,  97,   1,   3, 111, 136,   1,   4, 181,   1,   1,
+  167, 149,   0, 155,   1,   0, 195,   1,   4,  50, 136,   1,
+    4, 214,   1,   2,  42, 149,   0, 155,   1,   1,  37,  10,
+    4, 214,   1,   2, 204, 149,   0, 155,   1,   1, 167, 138,
+    1,   3, 111,   1,   0,  65, 148,   0, 140,   1,   0,  98,
+    1,   0, 162, 141,   1,   2, 106, 138,   1,   3, 242,   1,
+    0, 195, 140,   1,   0,  32,   1,   0, 195, 134,   0, 139,
+    1,   0,  97,   1,   3,  79,   1,   4,  51,   1,   1, 200,
+  140,   1,   3,  46, 138,   1,   4, 148,   1,   1,  37, 139,
+    1,   0, 163,   1,   3,  78,   1,   4,  83,   1,   1, 200,
+  133,   0, 138,   1,   0,  97,   1,   3,  79,   3,   4, 214,
+    1,   2, 237,   1,   0, 130, 137,   1,   0, 130,   1,   3,
+  242, 138,   1,   4, 214,   1,   2,  42, 138,   1,   1, 135,
+    1,   4,  18,   2,   4, 214,   1,   4, 148,   1,   1, 167,
+  132,   0, 137,   1,   0,  65,   1,   3,  79,   2,   4, 214,
+    1,   4, 181, 129,   1,   4, 214,   1,   3, 242,   1,   1,
+   70, 134,   1,   0,  32,   1,   1, 102,   1,   3, 144,  12,
+    4, 214,   1,   4, 149,   1,   3,  79,   1,   1, 135,   1,
+    0,  97, 133,   1,   0,  97,   1,   2, 172,   1,   4, 181,
+    2,   4, 214,   1,   4, 181,   1,   4, 214,   1,   4, 148,
+    1,   1, 167, 131,   0, 136,   1,   0,  65,   1,   3, 111,
+    7,   4, 214,   1,   4, 181,   1,   2, 139,   1,   0,  65,
+  130,   1,   0, 163,   1,   2,   9,   1,   3, 241,  17,   4,
+  214,   1,   4,  51,   1,   2,  74,   1,   0, 228, 130,   1,
+    1, 102,   1,   3, 242,   7,   4, 214,   1,   4, 181,   1,
+    1, 168, 130,   0, 135,   1,   0,  65,   1,   3,  78,  10,
+    4, 214,   1,   3, 144,   1,   1, 135,   1,   2, 107,   1,
+    4,  83,  21,   4, 214,   1,   4, 148,   1,   2, 237,   1,
+    2, 204,   1,   4, 149,   9,   4, 214,   1,   4, 181,   1,
+    1, 200, 129,   0, 134,   1,   0,  98,   1,   3,  46,  50,
+    4, 214,   1,   4, 116,   1,   1, 200,   0, 134,   1,   1,
+    5,   1,   4, 181, 178,   1,   4, 214,   1,   3,  46,   0,
+  134,   1,   0,   0,   1,   2, 204, 178,   1,   4,  83,   1,
+    1,   5,   0, 135,   1,   0,  97,   1,   3, 209, 177,   1,
+    1, 233,   1,   0,   0,   0, 135,   1,   0,   0,   1,   1,
+  102, 176,   1,   3,  46,   2,   0,   0,   0, 136,   1,   0,
+    0,   1,   2, 172, 174,   1,   4,  51,   1,   0, 195, 130,
+    0, 137,   1,   0,  98,   1,   3, 209, 173,   1,   1, 200,
+    3,   0,   0,   0, 137,   1,   0,   0,   1,   1,  69,   1,
+    4, 149, 171,   1,   2, 205,   4,   0,   0,   0, 138,   1,
+    0,   0,   1,   2, 107, 170,   1,   4, 213,   1,   1, 135,
+  132,   0, 139,   1,   2,   9, 170,   1,   4, 214,   1,   2,
+  237, 132,   0, 138,   1,   0,  98,   1,   3, 177, 171,   1,
+    4, 213,   1,   1, 167, 131,   0, 138,   1,   1, 135,  45,
+    4, 214,   1,   2, 204, 131,   0, 138,   1,   3,  13, 146,
+    1,   4, 148,   1,   3,  46,   1,   2,  74,   1,   1, 232,
+    1,   1, 200,   1,   2,   9,   1,   2, 172,   1,   3, 209,
+  145,   1,   3, 209,   1,   2, 107,   1,   1,   4, 131,   0,
+  137,   1,   0, 195,   1,   4, 148, 145,   1,   3,  13,   1,
+    1,  37,   1,   0,  32,   5,   0,   0,   1,   0, 130,   1,
+    1, 232,   1,   4,  18, 140,   1,   4, 181,   1,   3,  78,
+    1,   1, 200,   1,   0, 130,   5,   0,   0,   0, 137,   1,
+    2,  74,  16,   4, 214,   1,   4, 181,   1,   2,   9,  10,
+    0,   0,   1,   0, 163,   1,   3, 111, 137,   1,   4, 116,
+    1,   2, 204,   1,   1,  37,   1,   0,  32,   7,   0,   0,
+    0, 133,   1,   0,  98,   1,   1,  37,   1,   1, 232,   1,
+    2, 204,   1,   4, 116, 144,   1,   1, 232,  12,   0,   0,
+    1,   0,  65,   1,   3, 144, 134,   1,   3, 241,   1,   2,
+   41,   1,   0, 195,  10,   0,   0,   0,   1,   0, 130,   1,
+    1, 102,   1,   2,  42,   1,   2, 237,   1,   3, 209,   1,
+    4,  83,   1,   4, 116,   1,   4, 181,  17,   4, 214,   1,
+    2, 237,  14,   0,   0,   1,   0, 163,   1,   4,  83, 130,
+    1,   4, 116,   1,   3,  78,   1,   1, 102,   1,   0,  65,
+   12,   0,   0,   1,   1,   4,  51,   1,   4, 213,  22,   4,
+  214,   1,   4,  83,   1,   0, 162,  15,   0,   0,   1,   1,
+  200,   1,   3, 242,   1,   2, 172,   1,   0, 195,  15,   0,
+    0,   1,  24,   4, 214,   1,   2, 204,  17,   0,   0,   1,
+    0,  32,  17,   0,   0,   0,   1,   4, 149, 151,   1,   1,
+  135, 145,  18,   0,   0,   0,   1,   4, 148, 150,   1,   4,
+  213,   1,   0, 228, 163,   0, 151,   1,   4, 116,   1,   0,
+  195, 163,   0, 151,   1,   4, 181, 164,   0, 151,   1,   4,
+  214,   1,   1,  69, 163,   0,  24,   4, 214,   1,   2,  74,
+  163,   0,   1,   4, 148, 151,   1,   3, 242,   1,   0,  65,
+  143,   1,   1,  37,   1,   2, 205,   1,   1, 135, 144,   0,
+    1,   1, 135,   1,   2, 139,   1,   3, 111,   1,   4,  18,
+    1,   4, 116,   1,   4, 148, 146,   1,   4, 214,   1,   2,
+   42, 142,   1,   0,  33,   1,   3, 176,   2,   4, 214,   1,
+    3, 209,   1,   2,   9,   1,   0, 130, 141,   0,   3,   0,
+    0,   1,   0,  32,   1,   0, 195,   1,   1, 135,   1,   2,
+   74,   1,   3,  14,   1,   3, 209,   1,   4, 181, 143,   1,
+    4, 148,   1,   1,  37, 141,   1,   2, 204,   5,   4, 214,
+    1,   4,  83,   1,   2, 172,   1,   1,  37,   1,   0,  33,
+  138,   0, 131,   6,   0,   0,   1,   2, 237, 143,   1,   4,
+  214,   1,   4,  18,   1,   1,  37, 139,   1,   2, 139,   2,
+    4, 214,   1,   4, 213, 131,   2,   4, 214,   1,   4, 181,
+    1,   3,  79,   1,   1, 167,   1,   0, 130, 136,   0, 137,
+    1,   1,  37, 144,   1,   4, 214,   1,   4,  83,   1,   2,
+    9,   1,   0,  97, 135,   1,   1,   4,   1,   3,  46,  12,
+    4, 214,   1,   3, 209,   1,   2,  42,   1,   0, 228, 134,
+    0, 137,   1,   0,  65,   1,   3, 144, 144,   2,   4, 214,
+    1,   3, 176,   1,   2,  74,   1,   1, 102,   1,   1,   5,
+    1,   0, 228,   1,   1,  37,   1,   1, 200,   1,   2, 204,
+    1,   4,  84,  15,   4, 214,   1,   4,  83,   1,   2, 204,
+    1,   1, 102,   1,   0,  65, 131,   1,  10,   0,   0,   1,
+    1, 232,  20,   4, 214,   1,   4, 181,   1,   4,  51,   1,
+    4,  18,   1,   4,  83,  21,   4, 214,   1,   2, 107,   3,
+    0,   0,   0, 138,   1,   0, 195,   1,   4,  51, 147,  25,
+    4, 214,   1,   2,  74, 131,   0, 138,   1,   0,   0,   1,
+    2, 107, 171,   1,   3, 144,   1,   0,  65, 131,   0, 139,
+    1,   2,   9, 171,   1,   1, 200,   4,   0,   0,   0, 138,
+    1,   0, 163,   1,   4,  18, 171,   1,   2,  74, 132,   0,
+  138,   1,   3,  46,  44,   4, 214,   1,   4, 116,   1,   1,
+   69, 131,   0, 137,   1,   1, 233,  46,   4, 214,   1,   3,
+  176,   1,   0,  65, 130,   0, 136,   1,   0, 163,   1,   4,
+   83, 174,   1,   4, 214,   1,   2, 107, 130,   0, 136,   1,
+    3,  46,  48,   4, 214,   1,   4, 181,   1,   1,  70, 129,
+    0, 135,   1,   2,   9,  50,   4, 214,   1,   3, 209,   1,
+    0,  98,   0, 134,   1,   0, 228,   1,   4,  84, 178,   1,
+    4, 214,   1,   2, 204,   0, 134,   1,   0, 163,   1,   4,
+   18, 179,   1,   2, 139,   0, 134,   1,   0,   0,   1,   1,
+    4,   1,   4,  18, 138,   1,   4,  83,   1,   2, 204,   1,
+    3, 144, 151,   1,   4,  18,   1,   3, 241, 139,   1,   2,
+  139,   1,   0,   0,   0, 135,   1,   0,   0,   1,   1,   4,
+    1,   4,  51, 136,   1,   3, 176,   1,   1,   4,   1,   0,
+    0,   1,   0,  65,   1,   1, 134,   1,   3,  79,   1,   4,
+  181, 145,   1,   4, 213,   1,   3, 144,   1,   1, 232,   1,
+    0, 130,   1,   0,  97,   1,   2, 107,   1,   4, 149, 136,
+    1,   2, 140,   2,   0,   0,   0, 136,   1,   0,   0,   1,
+    1,   4,   1,   4,  51, 130,   1,   4, 181, 130,   1,   4,
+  181,   1,   2, 106,   6,   0,   0,   1,   0, 228,   1,   2,
+  172,   1,   4,  84, 141,   1,   4,  83,   1,   2, 205,   1,
+    1,  37,   5,   0,   0,   1,   1,  69,   1,   3, 177, 131,
+    1,   4, 213, 130,   1,   2, 139,   3,   0,   0,   1,  10,
+    0,   0,   1,   1,   4,   1,   4,  51,   3,   4, 214,   1,
+    3, 241,   1,   1, 102,   9,   0,   0,   1,   1,   4,   1,
+    4,  83,  11,   4, 214,   1,   2, 237,   1,   0,  65,   8,
+    0,   0,   1,   0,  65,   1,   2, 172,   1,   4, 181,   3,
+    4, 214,   1,   2, 139,   4,   0,   0,   0, 138,   1,   0,
+    0,   1,   1,   5,   1,   4,  51, 129,   1,   2, 205,   1,
+    0,  98,  11,   0,   0,   1,   3,  79, 138,   1,   4, 181,
+    1,   1, 102,  11,   0,   0,   1,   1, 167,   1,   4,  18,
+  129,   1,   2, 140,   5,   0,   0,   0, 139,   1,   0,   0,
+    1,   1,  37,   1,   1, 167,  13,   0,   0,   1,   2, 140,
+  138,   1,   4,  18,   1,   0, 228, 139,   1,   0,   0,   1,
+    0, 195,   1,   1, 200,   1,   0,  32, 133,   1,  27,   0,
+    0,   1,   1, 232,  10,   4, 214,   1,   3, 144,   1,   0,
+   98,  20,   0,   0,   0, 155,   1,   1,  69, 138,   1,   3,
+   13,  21,   0,   0,   0, 155,   1,   0, 195,   1,   4,  83,
+  137,   1,   2, 107, 149,   0, 155,   1,   0, 130,   1,   3,
+  176, 137,   1,   1, 200, 149,   0, 155,   1,   0,   0,   1,
+    2, 237, 136,   1,   4,  83,   1,   1,  37, 149,   0, 156,
+    1,   2,  42, 136,   1,   3, 209,   1,   0, 130, 149,   1,
+   60,   0,   0,   0, 188,   0, 188,   0, 188,   0, 188,   0,
+  188,   0, 188,
+};
+Animation delta(287,deltaData, ENCODING_RGB565_DELTA, 60);
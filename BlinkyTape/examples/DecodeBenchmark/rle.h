@@ -0,0 +1,611 @@
+// Data file for animation rle
+// Compression: 16 bit RLE
+// Uncompressed size: 51660 bytes
+// Compressed size: 7248 bytes
+const PROGMEM prog_uint8_t rleData[]  = {
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+    7,   0,   0,   1,   2, 242,   1,   3, 150,   1,   0,  11,
+   50,   0,   0,   7,   0,   0,   1, 206, 186,   1, 255, 255,
+    1, 215, 191,   1, 158, 126,   1,  68, 153,   1,   1, 113,
+    1,   0,   5,  46,   0,   0,   7,   0,   0,   1, 214, 154,
+    4, 255, 255,   1, 239, 255,   1, 183,  95,   1, 117, 156,
+    1,   3,  53,   1,   0,  12,  43,   0,   0,   7,   0,   0,
+    1, 214, 154,   8, 255, 255,   1, 215, 191,   1, 158, 158,
+    1,  76, 153,   1,   2,  18,   1,   0,   8,  39,   0,   0,
+    7,   0,   0,   1, 214, 154,  11, 255, 255,   1, 239, 255,
+    1, 191,  95,   1, 125, 188,   1,   3, 150,   1,   0,  12,
+   36,   0,   0,   7,   0,   0,   1, 214, 154,  15, 255, 255,
+    1, 215, 223,   1, 158, 158,   1,  76, 217,   1,   2,  18,
+    1,   0,   8,  32,   0,   0,   7,   0,   0,   1, 214, 154,
+   18, 255, 255,   1, 239, 255,   1, 191,  95,   1, 125, 188,
+    1,   3, 150,   1,   0,  14,  29,   0,   0,   7,   0,   0,
+    1, 214, 154,  22, 255, 255,   1, 223, 223,   1, 158, 190,
+    1,  76, 218,   1,   2,  19,   1,   0,   8,  25,   0,   0,
+    7,   0,   0,   1, 214, 154,  25, 255, 255,   1, 239, 255,
+    1, 199, 127,   1, 133, 252,   1,  43, 214,   1,   0,  14,
+   22,   0,   0,   7,   0,   0,   1, 214, 154,  29, 255, 255,
+    1, 223, 223,   1, 166, 254,   1,  92, 250,   1,   2, 115,
+    1,   0,   9,  18,   0,   0,   7,   0,   0,   1, 214, 186,
+   32, 255, 255,   1, 247, 255,   1, 199, 127,   1, 134,  29,
+    1,  43, 215,   1,   0,  15,  15,   0,   0,   7,   0,   0,
+    1, 188, 204,   1, 255,  22,   1, 255, 219,   1, 255, 254,
+   33, 255, 255,   1, 231, 255,   1, 166, 254,   1,  92, 250,
+    1,   2, 115,   1,   0,   9,  11,   0,   0,   9,   0,   0,
+    1, 112,   0,   1, 171,  32,   1, 212, 236,   1, 246, 147,
+    1, 255, 185,   1, 255, 253,  32, 255, 255,   1, 247, 255,
+    1, 207, 159,   1, 142,  29,   1,  44,  23,   1,   0,  15,
+    8,   0,   0,  13,   0,   0,   1,  88,   0,   1, 154,  96,
+    1, 204, 137,   1, 238,  81,   1, 255, 119,   1, 255, 252,
+   32, 255, 255,   1, 231, 255,   1, 175,  30,   1,  92, 250,
+    6,   0,   0,  17,   0,   0,   1,  64,   0,   1, 129,  96,
+    1, 187, 197,   1, 229, 175,   1, 255,  22,   1, 255, 219,
+    1, 255, 254,  30, 255, 255,   6,   0,   0,  22,   0,   0,
+    1, 112,   0,   1, 171,  32,   1, 213,  44,   1, 246, 179,
+    1, 255, 185,   1, 255, 253,  26, 255, 255,   6,   0,   0,
+   26,   0,   0,   1,  88,   0,   1, 154,  96,   1, 204, 137,
+    1, 238,  81,   1, 255, 120,   1, 255, 252,  22, 255, 255,
+    6,   0,   0,  30,   0,   0,   1,  64,   0,   1, 137,  96,
+    1, 187, 200,   1, 229, 175,   1, 246, 180,   1, 255, 185,
+    1, 255, 253,   1, 255, 254,   2, 255, 255,   1, 255, 223,
+   13, 255, 255,   6,   0,   0,  35,   0,   0,   1,  64,   0,
+    1, 128,   9,   1, 172,  19,   1, 222,  89,  15, 255, 255,
+    6,   0,   0,  30,   0,   0,   1,   0,   5,   1,   0,  11,
+    1,   2,  19,   1,  68,  88,   1, 125, 188,   1, 158, 190,
+    1, 207, 159,   1, 231, 255,   1, 247, 255,  15, 255, 255,
+    6,   0,   0,  25,   0,   0,   1,   0,   5,   1,   0,  12,
+    1,   2, 115,   1,  68,  89,   1, 133, 252,   1, 174, 254,
+    1, 215, 191,   1, 247, 255,  21, 255, 255,   6,   0,   0,
+   20,   0,   0,   1,   0,   8,   1,   0,  14,   1,   2, 115,
+    1,  76, 153,   1, 142,  29,   1, 183,  31,   1, 215, 191,
+    1, 247, 255,  26, 255, 255,   6,   0,   0,  15,   0,   0,
+    1,   0,   8,   1,   0,  15,   1,   2, 244,   1,  76, 217,
+    1, 142,  93,   1, 183,  63,   1, 215, 223,   1, 247, 255,
+   31, 255, 255,   6,   0,   0,  10,   0,   0,   1,   0,   8,
+    1,   1, 112,   1,   3,  53,   1,  76, 218,   1, 150, 125,
+    1, 191,  95,   1, 223, 223,   1, 247, 255,  31, 255, 255,
+    1, 255, 254,   1, 255, 219,   1, 255,  54,   1, 238,  17,
+    1, 204, 137,   6,   0,   0,   7,   0,   0,   1,  43,  51,
+    1,  92, 250,   1, 150, 126,   1, 199, 127,   1, 231, 255,
+    1, 247, 255,  31, 255, 255,   1, 255, 254,   1, 255, 252,
+    1, 255,  87,   1, 238,  82,   1, 212, 201,   1, 162, 224,
+    1, 112,   0,   1,  40,   0,   8,   0,   0,   7,   0,   0,
+    1, 206, 186,  32, 255, 255,   1, 255, 252,   1, 255, 120,
+    1, 246, 115,   1, 212, 235,   1, 171,  32,   1, 120,   0,
+    1,  64,   0,  13,   0,   0,   7,   0,   0,   1, 214, 154,
+   27, 255, 255,   1, 255, 253,   1, 255, 153,   1, 246, 147,
+    1, 221,  44,   1, 179, 133,   1, 129,  96,   1,  64,   0,
+   18,   0,   0,   7,   0,   0,   1, 214, 154,  22, 255, 255,
+    1, 255, 253,   1, 255, 185,   1, 246, 180,   1, 229, 142,
+    1, 187, 200,   1, 146,   0,   1,  72,   0,  23,   0,   0,
+    7,   0,   0,   1, 214, 154,  17, 255, 255,   1, 255, 253,
+    1, 255, 186,   1, 254, 245,   1, 229, 175,   1, 196,  72,
+    1, 146,   0,   1,  88,   0,  28,   0,   0,   7,   0,   0,
+    1, 214, 154,  12, 255, 255,   1, 255, 188,   1, 255,  56,
+    1, 246, 113,   1, 213,  43,   1, 188,   5,   1, 154,   0,
+    1,  88,   0,  33,   0,   0,   7,   0,   0,   1, 214, 154,
+   12, 255, 255,   1, 223,  62,   1, 157, 252,   1,  68,  25,
+    1,   2, 115,   1,   0,  16,   1,   0,   9,  34,   0,   0,
+    7,   0,   0,   1, 214, 154,  10, 255, 255,   1, 255, 223,
+    4, 255, 255,   1, 247, 255,   1, 231, 255,   1, 207, 127,
+    1, 158, 158,   1, 101,  58,   1,  43, 150,   1,   1, 113,
+    1,   0,   9,  29,   0,   0,   7,   0,   0,   1, 214, 154,
+   21, 255, 255,   1, 231, 255,   1, 207, 127,   1, 150, 126,
+    1,  92, 250,   1,   3,  53,   1,   0,  15,   1,   0,   8,
+   24,   0,   0,   7,   0,   0,   1, 214, 154,  25, 255, 255,
+    1, 247, 255,   1, 231, 255,   1, 191,  95,   1, 150,  93,
+    1,  76, 218,   1,   2, 244,   1,   0,  14,   1,   0,   5,
+   19,   0,   0,   7,   0,   0,   1, 214, 187,  30, 255, 255,
+    1, 247, 255,   1, 223, 223,   1, 183,  63,   1, 142,  29,
+    1,  76, 153,   1,   2, 115,   1,   0,  12,   1,   0,   5,
+   14,   0,   0,   7,   0,   0,   1, 205,  47,   1, 255, 120,
+    1, 255, 252,   1, 255, 254,  32, 255, 255,   1, 247, 255,
+    1, 215, 191,   1, 183,  31,   1, 133, 252,   1,  68,  89,
+    1,   2,  19,   1,   0,  11,  10,   0,   0,   8,   0,   0,
+    1,  64,   0,   1, 121,  96,   1, 171,  32,   1, 212, 235,
+    1, 246, 147,   1, 255, 121,   1, 255, 252,  33, 255, 255,
+    1, 247, 255,   1, 215, 191,   1, 166, 254,   1, 125, 156,
+    1,  68,  24,   1,   2,  18,   6,   0,   0,  13,   0,   0,
+    1,  64,   0,   1, 137,  96,   1, 179, 197,   1, 221,  76,
+    1, 246, 179,   1, 255, 153,   1, 255, 253,  33, 255, 255,
+    1, 239, 255,   6,   0,   0,  18,   0,   0,   1,  72,   0,
+    1, 146,   0,   1, 188,   8,   1, 229, 143,   1, 246, 244,
+    1, 255, 186,   1, 255, 253,  29, 255, 255,   6,   0,   0,
+   23,   0,   0,   1,  88,   0,   1, 154,  96,   1, 204,  72,
+    1, 229, 240,   1, 255,  22,   1, 255, 218,   1, 255, 254,
+   24, 255, 255,   6,   0,   0,  27,   0,   0,   1,  40,   0,
+    1,  96,   0,   1, 154,  96,   1, 204, 137,   1, 238,  81,
+    1, 255,  54,   1, 255, 219,   1, 255, 254,  19, 255, 255,
+    6,   0,   0,  32,   0,   0,   1,  40,   0,   1, 112,   0,
+    1, 162, 224,   1, 204, 136,   1, 238,  15,   1, 254, 245,
+    1, 255, 122,  15, 255, 255,   6,   0,   0,  34,   0,   0,
+    1,   0,   9,   1,   0,  17,   1,   3,  54,   1, 116, 250,
+    1, 182, 157,  15, 255, 255,   6,   0,   0,  30,   0,   0,
+    1,   0,  14,   1,   2, 244,   1,  92, 250,   1, 158, 158,
+    1, 207, 159,   1, 239, 255,   4, 255, 255,   1, 255, 223,
+   13, 255, 255,   6,   0,   0,  25,   0,   0,   1,   0,   8,
+    1,   1, 112,   1,  43, 214,   1, 117, 156,   1, 175,  30,
+    1, 215, 223,   1, 247, 255,  22, 255, 255,   6,   0,   0,
+   21,   0,   0,   1,   0,   9,   1,   2,  19,   1,  68,  89,
+    1, 142,  29,   1, 191,  95,   1, 231, 255,  27, 255, 255,
+    6,   0,   0,  17,   0,   0,   1,   0,  14,   1,   2, 244,
+    1,  92, 250,   1, 158, 158,   1, 207, 159,   1, 239, 255,
+   30, 255, 255,   1, 255, 186,   6,   0,   0,  12,   0,   0,
+    1,   0,   8,   1,   1, 112,   1,  43, 214,   1, 117, 156,
+    1, 174, 254,   1, 215, 223,   1, 247, 255,  30, 255, 255,
+    1, 255, 253,   1, 255,  87,   1, 229, 175,   1, 179, 133,
+    1,  96,   0,   6,   0,   0,   8,   0,   0,   1,   0,   9,
+    1,   2,  18,   1,  68,  89,   1, 142,  29,   1, 191,  95,
+    1, 231, 255,  31, 255, 255,   1, 255, 254,   1, 255, 186,
+    1, 246, 147,   1, 204, 137,   1, 138,   0,   1,  64,   0,
+    9,   0,   0,   7,   0,   0,   1, 125,  89,   1, 207, 191,
+    1, 239, 255,  32, 255, 255,   1, 255, 252,   1, 255,  54,
+    1, 229, 142,   1, 171,  32,   1,  96,   0,  13,   0,   0,
+    7,   0,   0,   1, 222, 186,  30, 255, 255,   1, 255, 254,
+    1, 255, 185,   1, 246, 114,   1, 204,  72,   1, 137,  96,
+    1,  40,   0,  16,   0,   0,   7,   0,   0,   1, 214, 154,
+   27, 255, 255,   1, 255, 252,   1, 255,  22,   1, 221,  78,
+    1, 162, 224,   1,  88,   0,  20,   0,   0,   7,   0,   0,
+    1, 214, 154,  23, 255, 255,   1, 255, 254,   1, 255, 153,
+    1, 238,  81,   1, 196,   8,   1, 128,   0,  24,   0,   0,
+    7,   0,   0,   1, 214, 154,  20, 255, 255,   1, 255, 252,
+    1, 254, 245,   1, 213,  44,   1, 154,  96,   1,  72,   0,
+   27,   0,   0,   7,   0,   0,   1, 214, 154,  16, 255, 255,
+    1, 255, 253,   1, 255, 120,   1, 238,  16,   1, 187, 197,
+    1, 120,   0,  31,   0,   0,   7,   0,   0,   1, 214, 154,
+   13, 255, 255,   1, 255, 219,   1, 246, 180,   1, 212, 203,
+    1, 154,  96,   1,  64,   0,  34,   0,   0,   7,   0,   0,
+    1, 214, 154,   9, 255, 255,   1, 255, 253,   1, 255,  87,
+    1, 229, 175,   1, 179, 133,   1, 112,   0,  38,   0,   0,
+    7,   0,   0,   1, 214, 154,   5, 255, 255,   1, 255, 254,
+    1, 255, 218,   1, 246, 147,   1, 204, 201,   1, 146,   0,
+    1,  64,   0,  41,   0,   0,   7,   0,   0,   1, 214, 186,
+    2, 255, 255,   1, 255, 253,   1, 255,  86,   1, 229, 143,
+    1, 171,  32,   1,  96,   0,  45,   0,   0,   7,   0,   0,
+    1, 205,  79,   1, 246, 147,   1, 204,  73,   1, 137,  96,
+    1,  40,   0,  48,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,   7,   0,   0,   1,   1, 110,
+    1,   2, 115,  44,   2,  19,   1,   2,  18,   6,   0,   0,
+    7,   0,   0,   1, 190, 154,   1, 247, 255,  43, 239, 255,
+    1, 247, 255,   1, 239, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,  46, 255, 255,   6,   0,   0,   7,   0,   0,
+    1, 214, 154,   8, 255, 255,   1, 255, 218,   1, 255, 153,
+    6, 255, 185,   1, 255, 153,   9, 255, 255,  11, 255, 185,
+    9, 255, 255,   6,   0,   0,   7,   0,   0,   1, 214, 154,
+    8, 255, 255,   1, 113, 101,   6,  72,   0,   1,  88,   0,
+    1,  64,   0,   1, 230, 251,   7, 255, 255,   1, 255, 190,
+    1,  72,   0,   1,  88,   0,   7,  72,   0,   1,  88,   0,
+    1,  64,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 251,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 222, 252,   7, 255, 255,   1, 247, 158,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 231,  25,   7, 255, 254,   1, 255, 188,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 154,   8, 255, 255,   1,  66,   8,
+    8,   0,   0,   1, 130,   0,   7, 154,  96,   1, 146,   0,
+   11,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 214, 184,   8, 255, 254,   1,  66,   5,
+   28,   0,   0,   1, 247, 158,   8, 255, 255,   6,   0,   0,
+    7,   0,   0,   1, 122,   0,   8, 154,  96,  29,   0,   0,
+    1, 247, 222,   8, 255, 255,   6,   0,   0,  45,   0,   0,
+    1, 188,   8,   7, 212, 203,   1, 204, 137,   6,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  13,   0,   0,
+    1,  16,   0,   1,  48,   0,   2,  64,   0,   1,  56,   0,
+    1,  32,   0,  41,   0,   0,  11,   0,   0,   1,  16,   0,
+    1,  64,   0,   1, 120,   0,   1, 168,   0,   1, 200,   0,
+    1, 216,   0,   1, 192,   0,   1, 144,   0,   1,  80,   0,
+    1,  40,   0,   1,   8,   0,  38,   0,   0,  10,   0,   0,
+    1,  64,   0,   1, 144,   0,   1, 200,   0,   1, 232,   0,
+    5, 248,   0,   1, 208,   0,   1, 176,   0,   1, 112,   0,
+    1,  32,   0,  37,   0,   0,   8,   0,   0,   1,  16,   0,
+    1,  88,   0,   1, 184,   0,  10, 248,   0,   1, 240,   0,
+    1, 152,   0,   1,  56,   0,  36,   0,   0,   7,   0,   0,
+    1,  16,   0,   1, 104,   0,   1, 208,   0,  13, 248,   0,
+    1, 176,   0,   1,  64,   0,  35,   0,   0,   6,   0,   0,
+    1,   8,   0,   1, 112,   0,   1, 216,   0,  15, 248,   0,
+    1, 184,   0,   1,  72,   0,   1,   8,   0,  33,   0,   0,
+    6,   0,   0,   1,  88,   0,   1, 208,   0,  17, 248,   0,
+    1, 192,   0,   1,  96,   0,   1,  16,   0,  32,   0,   0,
+    5,   0,   0,   1,  56,   0,   1, 184,   0,  19, 248,   0,
+    1, 208,   0,   1, 104,   0,   1,  24,   0,  31,   0,   0,
+    4,   0,   0,   1,  24,   0,   1, 144,   0,  21, 248,   0,
+    1, 216,   0,   1, 120,   0,   1,  32,   0,  30,   0,   0,
+    4,   0,   0,   1,  72,   0,   1, 216,   0,  22, 248,   0,
+    1, 224,   0,   1, 120,   0,   1,  16,   0,  29,   0,   0,
+    3,   0,   0,   1,  16,   0,   1, 128,   0,  24, 248,   0,
+    1, 192,   0,   1,  72,   0,  29,   0,   0,   3,   0,   0,
+    1,  72,   0,   1, 200,   0,  25, 248,   0,   1, 176,   0,
+    1,  88,   0,   1,  32,   0,  27,   0,   0,   3,   0,   0,
+    1, 120,   0,   4, 248,   0,   1, 248,   3,   1, 249, 137,
+    1, 250, 172,   1, 250, 139,   1, 248,  70,  18, 248,   0,
+    1, 224,   0,   1, 152,   0,   1,  56,   0,  26,   0,   0,
+    2,   0,   0,   1,  24,   0,   1, 152,   0,   3, 248,   0,
+    1, 250,  42,   1, 252,  49,   1, 253,  85,   1, 253, 215,
+    1, 253,  85,   1, 251, 110,   1, 248,   3,  19, 248,   0,
+    1, 160,   0,   1,  48,   0,  25,   0,   0,   2,   0,   0,
+    1,  48,   0,   1, 168,   0,   2, 248,   0,   1, 248, 199,
+    1, 253,  20,   1, 254, 219,   2, 255,  60,   1, 254, 121,
+    1, 252,  81,   1, 248,   5,  20, 248,   0,   1, 136,   0,
+    1,  24,   0,  24,   0,   0,   1,   0,   0,   1,   8,   0,
+    1,  72,   0,   1, 192,   0,   2, 248,   0,   1, 250, 140,
+    1, 254,  57,   1, 255, 125,   1, 255,  60,   1, 254, 219,
+    1, 253, 215,   1, 251, 110,   1, 248,   2,  20, 248,   0,
+    1, 224,   0,   1,  96,   0,  24,   0,   0,   1,   0,   0,
+    1,  16,   0,   1, 104,   0,   1, 216,   0,   2, 248,   0,
+    1, 251,  78,   1, 254,  57,   1, 254, 251,   1, 254, 154,
+    1, 253, 183,   1, 251, 208,   1, 248, 103,  22, 248,   0,
+    1, 176,   0,   1,  56,   0,  23,   0,   0,   1,   0,   0,
+    1,  32,   0,   1, 136,   0,   1, 240,   0,   1, 248,   0,
+    1, 248,   6,   1, 252,  82,   1, 254,  89,   1, 254, 251,
+    1, 254, 122,   1, 252, 179,   1, 249,  72,  24, 248,   0,
+    1, 168,   0,   1,  72,   0,   1,   8,   0,  21,   0,   0,
+    1,   0,   0,   1,  48,   0,   1, 168,   0,   2, 248,   0,
+    1, 250,  75,   1, 253,  53,   1, 254, 154,   1, 254, 251,
+    1, 254, 121,   1, 251, 240,   1, 248,   1,  25, 248,   0,
+    1, 184,   0,   1,  96,   0,   1,   8,   0,  20,   0,   0,
+    1,   0,   0,   1,  64,   0,   1, 184,   0,   2, 248,   0,
+    1, 251,  46,   1, 253, 215,   1, 254, 154,   1, 254, 219,
+    1, 254, 121,   1, 251, 208,  27, 248,   0,   1, 208,   0,
+    1,  96,   0,  20,   0,   0,   1,   0,   0,   1,  72,   0,
+    1, 200,   0,   2, 248,   0,   1, 251, 208,   1, 254,  57,
+    1, 254, 154,   1, 254, 186,   1, 254,  89,   1, 251, 208,
+   28, 248,   0,   1, 208,   0,   1,  88,   0,  19,   0,   0,
+    1,   0,   0,   1,  72,   0,   1, 200,   0,   1, 248,   0,
+    1, 248,   1,   1, 252,  49,   1, 254, 154,   1, 254, 219,
+    1, 254, 154,   1, 253, 248,   1, 251, 110,  29, 248,   0,
+    1, 208,   0,   1,  88,   0,  18,   0,   0,   1,   0,   0,
+    1,  72,   0,   1, 192,   0,   1, 248,   0,   1, 248,   2,
+    1, 252, 114,   1, 255,  28,   1, 255, 158,   1, 254, 251,
+    1, 253, 118,   1, 250,  75,  30, 248,   0,   1, 208,   0,
+    1,  80,   0,  17,   0,   0,   1,   0,   0,   1,  56,   0,
+    1, 176,   0,   2, 248,   0,   1, 251, 240,   1, 254, 251,
+    1, 255, 190,   1, 254, 219,   1, 252,  82,   1, 248,   5,
+   31, 248,   0,   1, 208,   0,   1,  80,   0,  16,   0,   0,
+    1,   0,   0,   1,  48,   0,   1, 152,   0,   2, 248,   0,
+    1, 250, 107,   1, 253,  85,   1, 254,  89,   1, 253,  85,
+    1, 250, 107,  33, 248,   0,   1, 216,   0,   1, 104,   0,
+    1,   8,   0,  14,   0,   0,   1,   0,   0,   1,  24,   0,
+    1, 120,   0,   1, 232,   0,   1, 248,   0,   1, 248,   2,
+    1, 250,  10,   1, 251,  13,   1, 250,  42,   1, 248,   2,
+   34, 248,   0,   1, 232,   0,   1, 112,   0,   1,  16,   0,
+   13,   0,   0,   1,   0,   0,   1,   8,   0,   1,  88,   0,
+    1, 200,   0,  41, 248,   0,   1, 224,   0,   1, 120,   0,
+    1,  32,   0,  12,   0,   0,   2,   0,   0,   1,  48,   0,
+    1, 168,   0,  42, 248,   0,   1, 232,   0,   1, 128,   0,
+    1,  24,   0,  11,   0,   0,   2,   0,   0,   1,  32,   0,
+    1, 160,   0,  43, 248,   0,   1, 224,   0,   1,  96,   0,
+   11,   0,   0,   2,   0,   0,   1,  16,   0,   1, 144,   0,
+   44, 248,   0,   1, 200,   0,   1,  96,   0,   1,  24,   0,
+    9,   0,   0,   3,   0,   0,   1, 104,   0,   1, 232,   0,
+   44, 248,   0,   1, 216,   0,   1, 128,   0,   1,  32,   0,
+    8,   0,   0,   3,   0,   0,   1,  48,   0,   1, 168,   0,
+   45, 248,   0,   1, 240,   0,   1, 136,   0,   1,  24,   0,
+    7,   0,   0,   4,   0,   0,   1,  96,   0,   1, 232,   0,
+   45, 248,   0,   1, 232,   0,   1, 104,   0,   1,   8,   0,
+    6,   0,   0,   4,   0,   0,   1,  40,   0,   1, 176,   0,
+   46, 248,   0,   1, 200,   0,   1,  88,   0,   1,   8,   0,
+    5,   0,   0,   4,   0,   0,   1,   8,   0,   1, 104,   0,
+    1, 224,   0,  46, 248,   0,   1, 192,   0,   1,  88,   0,
+    1,   8,   0,   4,   0,   0,   5,   0,   0,   1,  24,   0,
+    1, 128,   0,   1, 232,   0,  46, 248,   0,   1, 208,   0,
+    1, 112,   0,   1,  40,   0,   1,   8,   0,   2,   0,   0,
+    6,   0,   0,   1,  48,   0,   1, 176,   0,  47, 248,   0,
+    1, 232,   0,   1, 160,   0,   1,  72,   0,   1,   8,   0,
+    1,   0,   0,   6,   0,   0,   1,  32,   0,   1, 160,   0,
+   48, 248,   0,   1, 224,   0,   1, 120,   0,   1,  24,   0,
+    1,   0,   0,   5,   0,   0,   1,   8,   0,   1,  96,   0,
+    1, 216,   0,  47, 248,   0,   1, 232,   0,   1, 160,   0,
+    1,  72,   0,   1,   8,   0,   1,   0,   0,   5,   0,   0,
+    1,  80,   0,   1, 200,   0,  46, 248,   0,   1, 240,   0,
+    1, 184,   0,   1, 104,   0,   1,  48,   0,   1,   8,   0,
+    2,   0,   0,   4,   0,   0,   1,  32,   0,   1, 160,   0,
+   47, 248,   0,   1, 192,   0,   1,  96,   0,   1,  16,   0,
+    4,   0,   0,   4,   0,   0,   1,  72,   0,   1, 224,   0,
+   46, 248,   0,   1, 224,   0,   1, 136,   0,   1,  40,   0,
+    5,   0,   0,   3,   0,   0,   1,  24,   0,   1, 144,   0,
+   46, 248,   0,   1, 240,   0,   1, 160,   0,   1,  72,   0,
+    1,  16,   0,   5,   0,   0,   3,   0,   0,   1,  96,   0,
+    1, 216,   0,  46, 248,   0,   1, 176,   0,   1,  88,   0,
+    1,  24,   0,   6,   0,   0,   2,   0,   0,   1,   8,   0,
+    1, 136,   0,  45, 248,   0,   1, 240,   0,   1, 168,   0,
+    1,  80,   0,   1,  16,   0,   7,   0,   0,   2,   0,   0,
+    1,  16,   0,   1, 144,   0,  45, 248,   0,   1, 160,   0,
+    1,  72,   0,   1,   8,   0,   8,   0,   0,   2,   0,   0,
+    1,  32,   0,   1, 152,   0,  44, 248,   0,   1, 176,   0,
+    1,  72,   0,   1,   8,   0,   9,   0,   0,   2,   0,   0,
+    1,  56,   0,   1, 168,   0,  42, 248,   0,   1, 240,   0,
+    1, 168,   0,   1,  72,   0,  11,   0,   0,   1,   0,   0,
+    1,   8,   0,   1,  96,   0,   1, 208,   0,  41, 248,   0,
+    1, 232,   0,   1, 144,   0,   1,  48,   0,  12,   0,   0,
+    1,   0,   0,   1,  32,   0,   1, 136,   0,   1, 240,   0,
+   40, 248,   0,   1, 240,   0,   1, 152,   0,   1,  48,   0,
+   13,   0,   0,   1,   0,   0,   1,  56,   0,   1, 168,   0,
+   40, 248,   0,   1, 216,   0,   1, 152,   0,   1,  64,   0,
+   14,   0,   0,   1,   0,   0,   1,  64,   0,   1, 192,   0,
+   39, 248,   0,   1, 224,   0,   1, 144,   0,   1,  64,   0,
+   15,   0,   0,   1,   0,   0,   1,  72,   0,   1, 200,   0,
+   38, 248,   0,   1, 240,   0,   1, 160,   0,   1,  72,   0,
+    1,  16,   0,  15,   0,   0,   1,   0,   0,   1,  72,   0,
+    1, 200,   0,  37, 248,   0,   1, 232,   0,   1, 160,   0,
+    1,  80,   0,   1,  16,   0,  16,   0,   0,   1,   0,   0,
+    1,  64,   0,   1, 184,   0,  37, 248,   0,   1, 160,   0,
+    1,  64,   0,   1,   8,   0,  17,   0,   0,   1,   0,   0,
+    1,  48,   0,   1, 152,   0,  36, 248,   0,   1, 168,   0,
+    1,  64,   0,  19,   0,   0,   1,   0,   0,   1,  24,   0,
+    1, 112,   0,   1, 224,   0,  33, 248,   0,   1, 216,   0,
+    1, 144,   0,   1,  64,   0,  20,   0,   0,   2,   0,   0,
+    1,  72,   0,   1, 192,   0,  32, 248,   0,   1, 216,   0,
+    1, 120,   0,   1,  40,   0,  21,   0,   0,   2,   0,   0,
+    1,  48,   0,   1, 168,   0,  32, 248,   0,   1, 160,   0,
+    1,  56,   0,  22,   0,   0,   2,   0,   0,   1,  24,   0,
+    1, 152,   0,  31, 248,   0,   1, 192,   0,   1,  96,   0,
+    1,  24,   0,  22,   0,   0,   2,   0,   0,   1,   8,   0,
+    1, 144,   0,  30, 248,   0,   1, 200,   0,   1, 112,   0,
+    1,  32,   0,  23,   0,   0,   3,   0,   0,   1, 112,   0,
+    1, 240,   0,  28, 248,   0,   1, 184,   0,   1, 112,   0,
+    1,  48,   0,  24,   0,   0,   3,   0,   0,   1,  56,   0,
+    1, 176,   0,  26, 248,   0,   1, 240,   0,   1, 168,   0,
+    1,  88,   0,   1,  24,   0,  25,   0,   0,   4,   0,   0,
+    1, 104,   0,   1, 232,   0,  25, 248,   0,   1, 184,   0,
+    1,  88,   0,   1,  16,   0,  26,   0,   0,   4,   0,   0,
+    1,  64,   0,   1, 208,   0,  24, 248,   0,   1, 192,   0,
+    1, 104,   0,   1,  32,   0,  27,   0,   0,   4,   0,   0,
+    1,  24,   0,   1, 128,   0,  23, 248,   0,   1, 176,   0,
+    1,  88,   0,   1,  24,   0,  28,   0,   0,   5,   0,   0,
+    1,  40,   0,   1, 160,   0,  20, 248,   0,   1, 232,   0,
+    1, 144,   0,   1,  56,   0,   1,   8,   0,  29,   0,   0,
+    6,   0,   0,   1,  64,   0,   1, 184,   0,  18, 248,   0,
+    1, 240,   0,   1, 136,   0,   1,  40,   0,  31,   0,   0,
+    7,   0,   0,   1,  88,   0,   1, 192,   0,  15, 248,   0,
+    1, 216,   0,   1, 184,   0,   1, 136,   0,   1,  48,   0,
+   32,   0,   0,   7,   0,   0,   1,   8,   0,   1,  80,   0,
+    1, 176,   0,  12, 248,   0,   1, 224,   0,   1, 152,   0,
+    1,  96,   0,   1,  56,   0,   1,  32,   0,  33,   0,   0,
+    9,   0,   0,   1,  64,   0,   1, 168,   0,  10, 248,   0,
+    1, 208,   0,   1, 128,   0,   1,  48,   0,   1,   8,   0,
+   35,   0,   0,  10,   0,   0,   1,  48,   0,   1, 120,   0,
+    1, 176,   0,   1, 216,   0,   4, 248,   0,   1, 232,   0,
+    1, 184,   0,   1, 144,   0,   1,  88,   0,   1,  24,   0,
+   37,   0,   0,  11,   0,   0,   1,   8,   0,   1,  40,   0,
+    1,  88,   0,   1, 144,   0,   1, 200,   0,   1, 208,   0,
+    1, 176,   0,   1, 120,   0,   1,  64,   0,   1,  24,   0,
+   39,   0,   0,  14,   0,   0,   1,  32,   0,   1,  56,   0,
+    1,  64,   0,   1,  48,   0,   1,  24,   0,  41,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  28,   0,   0,
+    1,   1, 200,   1,   4, 149,   1,   4, 116,   5,   4,  83,
+    1,   4, 149,   1,   3,  46,   1,   0,  65,  21,   0,   0,
+   28,   0,   0,   1,   2, 172,   8,   4, 214,   1,   4,  18,
+    1,   1,   4,  21,   0,   0,  27,   0,   0,   1,   0,  97,
+    1,   3, 111,   8,   4, 214,   1,   4, 181,   1,   1, 167,
+   21,   0,   0,  27,   0,   0,   1,   0, 195,   1,   4,  50,
+    9,   4, 214,   1,   2,  42,  21,   0,   0,  27,   0,   0,
+    1,   1,  37,  10,   4, 214,   1,   2, 204,  21,   0,   0,
+   27,   0,   0,   1,   1, 167,  10,   4, 214,   1,   3, 111,
+    1,   0,  65,  20,   0,   0,  12,   0,   0,   1,   0,  98,
+    1,   0, 162,  13,   0,   0,   1,   2, 106,  10,   4, 214,
+    1,   3, 242,   1,   0, 195,  12,   0,   0,   1,   0,  32,
+    1,   0, 195,   6,   0,   0,  11,   0,   0,   1,   0,  97,
+    1,   3,  79,   1,   4,  51,   1,   1, 200,  12,   0,   0,
+    1,   3,  46,  10,   4, 214,   1,   4, 148,   1,   1,  37,
+   11,   0,   0,   1,   0, 163,   1,   3,  78,   1,   4,  83,
+    1,   1, 200,   5,   0,   0,  10,   0,   0,   1,   0,  97,
+    1,   3,  79,   3,   4, 214,   1,   2, 237,   1,   0, 130,
+    9,   0,   0,   1,   0, 130,   1,   3, 242,  11,   4, 214,
+    1,   2,  42,  10,   0,   0,   1,   1, 135,   1,   4,  18,
+    2,   4, 214,   1,   4, 148,   1,   1, 167,   4,   0,   0,
+    9,   0,   0,   1,   0,  65,   1,   3,  79,   2,   4, 214,
+    1,   4, 181,   2,   4, 214,   1,   3, 242,   1,   1,  70,
+    6,   0,   0,   1,   0,  32,   1,   1, 102,   1,   3, 144,
+   12,   4, 214,   1,   4, 149,   1,   3,  79,   1,   1, 135,
+    1,   0,  97,   5,   0,   0,   1,   0,  97,   1,   2, 172,
+    1,   4, 181,   2,   4, 214,   1,   4, 181,   1,   4, 214,
+    1,   4, 148,   1,   1, 167,   3,   0,   0,   8,   0,   0,
+    1,   0,  65,   1,   3, 111,   7,   4, 214,   1,   4, 181,
+    1,   2, 139,   1,   0,  65,   2,   0,   0,   1,   0, 163,
+    1,   2,   9,   1,   3, 241,  17,   4, 214,   1,   4,  51,
+    1,   2,  74,   1,   0, 228,   2,   0,   0,   1,   1, 102,
+    1,   3, 242,   7,   4, 214,   1,   4, 181,   1,   1, 168,
+    2,   0,   0,   7,   0,   0,   1,   0,  65,   1,   3,  78,
+   10,   4, 214,   1,   3, 144,   1,   1, 135,   1,   2, 107,
+    1,   4,  83,  21,   4, 214,   1,   4, 148,   1,   2, 237,
+    1,   2, 204,   1,   4, 149,   9,   4, 214,   1,   4, 181,
+    1,   1, 200,   1,   0,   0,   6,   0,   0,   1,   0,  98,
+    1,   3,  46,  50,   4, 214,   1,   4, 116,   1,   1, 200,
+    6,   0,   0,   1,   1,   5,   1,   4, 181,  51,   4, 214,
+    1,   3,  46,   7,   0,   0,   1,   2, 204,  50,   4, 214,
+    1,   4,  83,   1,   1,   5,   7,   0,   0,   1,   0,  97,
+    1,   3, 209,  49,   4, 214,   1,   1, 233,   1,   0,   0,
+    8,   0,   0,   1,   1, 102,  48,   4, 214,   1,   3,  46,
+    2,   0,   0,   9,   0,   0,   1,   2, 172,  46,   4, 214,
+    1,   4,  51,   1,   0, 195,   2,   0,   0,   9,   0,   0,
+    1,   0,  98,   1,   3, 209,  45,   4, 214,   1,   1, 200,
+    3,   0,   0,  10,   0,   0,   1,   1,  69,   1,   4, 149,
+   43,   4, 214,   1,   2, 205,   4,   0,   0,  11,   0,   0,
+    1,   2, 107,  42,   4, 214,   1,   4, 213,   1,   1, 135,
+    4,   0,   0,  11,   0,   0,   1,   2,   9,  43,   4, 214,
+    1,   2, 237,   4,   0,   0,  10,   0,   0,   1,   0,  98,
+    1,   3, 177,  43,   4, 214,   1,   4, 213,   1,   1, 167,
+    3,   0,   0,  10,   0,   0,   1,   1, 135,  45,   4, 214,
+    1,   2, 204,   3,   0,   0,  10,   0,   0,   1,   3,  13,
+   18,   4, 214,   1,   4, 148,   1,   3,  46,   1,   2,  74,
+    1,   1, 232,   1,   1, 200,   1,   2,   9,   1,   2, 172,
+    1,   3, 209,  17,   4, 214,   1,   3, 209,   1,   2, 107,
+    1,   1,   4,   3,   0,   0,   9,   0,   0,   1,   0, 195,
+    1,   4, 148,  17,   4, 214,   1,   3,  13,   1,   1,  37,
+    1,   0,  32,   5,   0,   0,   1,   0, 130,   1,   1, 232,
+    1,   4,  18,  12,   4, 214,   1,   4, 181,   1,   3,  78,
+    1,   1, 200,   1,   0, 130,   5,   0,   0,   9,   0,   0,
+    1,   2,  74,  16,   4, 214,   1,   4, 181,   1,   2,   9,
+   10,   0,   0,   1,   0, 163,   1,   3, 111,   9,   4, 214,
+    1,   4, 116,   1,   2, 204,   1,   1,  37,   1,   0,  32,
+    7,   0,   0,   5,   0,   0,   1,   0,  98,   1,   1,  37,
+    1,   1, 232,   1,   2, 204,   1,   4, 116,  16,   4, 214,
+    1,   1, 232,  12,   0,   0,   1,   0,  65,   1,   3, 144,
+    6,   4, 214,   1,   3, 241,   1,   2,  41,   1,   0, 195,
+   10,   0,   0,   1,   0, 130,   1,   1, 102,   1,   2,  42,
+    1,   2, 237,   1,   3, 209,   1,   4,  83,   1,   4, 116,
+    1,   4, 181,  17,   4, 214,   1,   2, 237,  14,   0,   0,
+    1,   0, 163,   1,   4,  83,   2,   4, 214,   1,   4, 116,
+    1,   3,  78,   1,   1, 102,   1,   0,  65,  12,   0,   0,
+    1,   4,  51,   1,   4, 213,  22,   4, 214,   1,   4,  83,
+    1,   0, 162,  15,   0,   0,   1,   1, 200,   1,   3, 242,
+    1,   2, 172,   1,   0, 195,  15,   0,   0,  24,   4, 214,
+    1,   2, 204,  17,   0,   0,   1,   0,  32,  17,   0,   0,
+    1,   4, 149,  23,   4, 214,   1,   1, 135,  35,   0,   0,
+    1,   4, 148,  22,   4, 214,   1,   4, 213,   1,   0, 228,
+   35,   0,   0,   1,   4, 148,  22,   4, 214,   1,   4, 116,
+    1,   0, 195,  35,   0,   0,   1,   4, 148,  22,   4, 214,
+    1,   4, 181,   1,   0, 195,  35,   0,   0,   1,   4, 148,
+   23,   4, 214,   1,   1,  69,  35,   0,   0,  24,   4, 214,
+    1,   2,  74,  35,   0,   0,   1,   4, 148,  23,   4, 214,
+    1,   3, 242,   1,   0,  65,  15,   0,   0,   1,   1,  37,
+    1,   2, 205,   1,   1, 135,  16,   0,   0,   1,   1, 135,
+    1,   2, 139,   1,   3, 111,   1,   4,  18,   1,   4, 116,
+    1,   4, 148,  19,   4, 214,   1,   2,  42,  14,   0,   0,
+    1,   0,  33,   1,   3, 176,   2,   4, 214,   1,   3, 209,
+    1,   2,   9,   1,   0, 130,  13,   0,   0,   3,   0,   0,
+    1,   0,  32,   1,   0, 195,   1,   1, 135,   1,   2,  74,
+    1,   3,  14,   1,   3, 209,   1,   4, 181,  15,   4, 214,
+    1,   4, 148,   1,   1,  37,  13,   0,   0,   1,   2, 204,
+    5,   4, 214,   1,   4,  83,   1,   2, 172,   1,   1,  37,
+    1,   0,  33,  10,   0,   0,   9,   0,   0,   1,   2, 237,
+   16,   4, 214,   1,   4,  18,   1,   1,  37,  11,   0,   0,
+    1,   2, 139,   2,   4, 214,   1,   4, 213,   5,   4, 214,
+    1,   4, 181,   1,   3,  79,   1,   1, 167,   1,   0, 130,
+    8,   0,   0,   9,   0,   0,   1,   1,  37,  17,   4, 214,
+    1,   4,  83,   1,   2,   9,   1,   0,  97,   7,   0,   0,
+    1,   1,   4,   1,   3,  46,  12,   4, 214,   1,   3, 209,
+    1,   2,  42,   1,   0, 228,   6,   0,   0,   9,   0,   0,
+    1,   0,  65,   1,   3, 144,  18,   4, 214,   1,   3, 176,
+    1,   2,  74,   1,   1, 102,   1,   1,   5,   1,   0, 228,
+    1,   1,  37,   1,   1, 200,   1,   2, 204,   1,   4,  84,
+   15,   4, 214,   1,   4,  83,   1,   2, 204,   1,   1, 102,
+    1,   0,  65,   3,   0,   0,  10,   0,   0,   1,   1, 232,
+   20,   4, 214,   1,   4, 181,   1,   4,  51,   1,   4,  18,
+    1,   4,  83,  21,   4, 214,   1,   2, 107,   3,   0,   0,
+   10,   0,   0,   1,   0, 195,   1,   4,  51,  44,   4, 214,
+    1,   2,  74,   3,   0,   0,  11,   0,   0,   1,   2, 107,
+   43,   4, 214,   1,   3, 144,   1,   0,  65,   3,   0,   0,
+   11,   0,   0,   1,   2,   9,  43,   4, 214,   1,   1, 200,
+    4,   0,   0,  10,   0,   0,   1,   0, 163,   1,   4,  18,
+   43,   4, 214,   1,   2,  74,   4,   0,   0,  10,   0,   0,
+    1,   3,  46,  44,   4, 214,   1,   4, 116,   1,   1,  69,
+    3,   0,   0,   9,   0,   0,   1,   1, 233,  46,   4, 214,
+    1,   3, 176,   1,   0,  65,   2,   0,   0,   8,   0,   0,
+    1,   0, 163,   1,   4,  83,  47,   4, 214,   1,   2, 107,
+    2,   0,   0,   8,   0,   0,   1,   3,  46,  48,   4, 214,
+    1,   4, 181,   1,   1,  70,   1,   0,   0,   7,   0,   0,
+    1,   2,   9,  50,   4, 214,   1,   3, 209,   1,   0,  98,
+    6,   0,   0,   1,   0, 228,   1,   4,  84,  51,   4, 214,
+    1,   2, 204,   6,   0,   0,   1,   0, 163,   1,   4,  18,
+   51,   4, 214,   1,   2, 139,   7,   0,   0,   1,   1,   4,
+    1,   4,  18,  10,   4, 214,   1,   4,  83,   1,   2, 204,
+    1,   3, 144,  23,   4, 214,   1,   4,  18,   1,   3, 241,
+   11,   4, 214,   1,   2, 139,   1,   0,   0,   8,   0,   0,
+    1,   1,   4,   1,   4,  51,   8,   4, 214,   1,   3, 176,
+    1,   1,   4,   1,   0,   0,   1,   0,  65,   1,   1, 134,
+    1,   3,  79,   1,   4, 181,  17,   4, 214,   1,   4, 213,
+    1,   3, 144,   1,   1, 232,   1,   0, 130,   1,   0,  97,
+    1,   2, 107,   1,   4, 149,   8,   4, 214,   1,   2, 140,
+    2,   0,   0,   9,   0,   0,   1,   1,   4,   1,   4,  51,
+    2,   4, 214,   1,   4, 181,   2,   4, 214,   1,   4, 181,
+    1,   2, 106,   6,   0,   0,   1,   0, 228,   1,   2, 172,
+    1,   4,  84,  13,   4, 214,   1,   4,  83,   1,   2, 205,
+    1,   1,  37,   5,   0,   0,   1,   1,  69,   1,   3, 177,
+    3,   4, 214,   1,   4, 213,   2,   4, 214,   1,   2, 139,
+    3,   0,   0,  10,   0,   0,   1,   1,   4,   1,   4,  51,
+    3,   4, 214,   1,   3, 241,   1,   1, 102,   9,   0,   0,
+    1,   1,   4,   1,   4,  83,  11,   4, 214,   1,   2, 237,
+    1,   0,  65,   8,   0,   0,   1,   0,  65,   1,   2, 172,
+    1,   4, 181,   3,   4, 214,   1,   2, 139,   4,   0,   0,
+   11,   0,   0,   1,   1,   5,   1,   4,  51,   1,   4, 214,
+    1,   2, 205,   1,   0,  98,  11,   0,   0,   1,   3,  79,
+   10,   4, 214,   1,   4, 181,   1,   1, 102,  11,   0,   0,
+    1,   1, 167,   1,   4,  18,   1,   4, 214,   1,   2, 140,
+    5,   0,   0,  12,   0,   0,   1,   1,  37,   1,   1, 167,
+   13,   0,   0,   1,   2, 140,  10,   4, 214,   1,   4,  18,
+    1,   0, 228,  12,   0,   0,   1,   0, 195,   1,   1, 200,
+    1,   0,  32,   5,   0,   0,  27,   0,   0,   1,   1, 232,
+   10,   4, 214,   1,   3, 144,   1,   0,  98,  20,   0,   0,
+   27,   0,   0,   1,   1,  69,  10,   4, 214,   1,   3,  13,
+   21,   0,   0,  27,   0,   0,   1,   0, 195,   1,   4,  83,
+    9,   4, 214,   1,   2, 107,  21,   0,   0,  27,   0,   0,
+    1,   0, 130,   1,   3, 176,   9,   4, 214,   1,   1, 200,
+   21,   0,   0,  28,   0,   0,   1,   2, 237,   8,   4, 214,
+    1,   4,  83,   1,   1,  37,  21,   0,   0,  28,   0,   0,
+    1,   2,  42,   8,   4, 214,   1,   3, 209,   1,   0, 130,
+   21,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+   60,   0,   0,  60,   0,   0,  60,   0,   0,  60,   0,   0,
+};
+Animation rle(287,rleData, ENCODING_RGB565_RLE, 60);
@@ -14,15 +14,18 @@
 #include <Adafruit_NeoPixel.h>
 #endif
 
+#include <SerialFrame.h>
 #include "animation.h"
 #include "pov.h"
 
 #define LED_COUNT 60
 #define THRESHOLD 1
 
+// On a board with a USB-serial chip, 1000000 works too
+#define SERIAL_BAUD 115200
+
 Adafruit_NeoPixel strip = Adafruit_NeoPixel(LED_COUNT, 13, NEO_GRB + NEO_KHZ800);
 
-uint8_t pixel_index;
 long last_time;
 
 uint8_t btn_pin = 10;
@@ -37,7 +40,7 @@ uint8_t anim_delay_ms = 10;
 
 void setup()
 { 
-  Serial.begin(57600);
+  Serial.begin(SERIAL_BAUD);
 
   strip.begin();
   strip.show();
@@ -48,30 +51,14 @@ void setup()
 }
 
 void serialLoop() {
+  // Frames from extras/frame_sender.py go straight into the strip's buffer,
+  // which a NEO_GRB strip keeps in green, red, blue order.
+  SerialFrame frame(strip.getPixels(), LED_COUNT, 1, 0, 2);
 
   while(true) {
-
-    if(Serial.available() > 2) {
-
-      uint8_t buffer[3]; // Buffer to store three incoming bytes used to compile a single LED color
-
-      for (uint8_t x=0; x<3; x++) { // Read three incoming bytes
-        uint8_t c = Serial.read();
-
-        if (c < 255) {
-          buffer[x] = c; // Using 255 as a latch semaphore
-        }
-        else {
-          strip.show();
-          pixel_index = 0;
-          break;
-        }
-
-        if (x == 2) {   // If we received three serial bytes
-          strip.setPixelColor(pixel_index, strip.Color(buffer[0], buffer[1], buffer[2]));
-          pixel_index++;
-        }
-      }
+    if(frame.poll(Serial)) {
+      strip.show();
+      frame.ack(Serial);
     }
   }
 }
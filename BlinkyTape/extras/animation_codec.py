@@ -0,0 +1,323 @@
+#!/usr/bin/env python
+# BlinkyTape animation encoder/decoder
+#
+# Builds pov.h data files for the Animation class from an image (one column
+# per frame, one row per LED - needs the Python Imaging Library) or from an
+# existing pov.h, and checks that the result decodes back to the same frames.
+#
+#   animation_codec.py image.png -o pov.h                 (delta encoding)
+#   animation_codec.py image.png -e rle -o pov.h          (16 bit RLE)
+#   animation_codec.py old/pov.h --leds 60 --bench        (compare encodings)
+#
+# --bench prints the size of every encoding and how long this script takes to
+# decode a frame of each; examples/DecodeBenchmark times the real thing.
+
+import argparse
+import re
+import sys
+import time
+
+ENCODING_RGB24 = 0
+ENCODING_RGB565_RLE = 1
+ENCODING_RGB565_DELTA = 2
+
+ENCODING_NAMES = {
+    'rgb24': ENCODING_RGB24,
+    'rle': ENCODING_RGB565_RLE,
+    'delta': ENCODING_RGB565_DELTA,
+}
+
+DELTA_KEYFRAME = 0x01
+DELTA_SKIP = 0x80
+MAX_RUN = 0x7F
+
+# Animation::drawDelta() seeks back to the nearest keyframe and replays from
+# there, so this bounds a seek or a step backwards to replaying 31 frames.
+DEFAULT_KEYFRAME_INTERVAL = 32
+
+
+def to565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def from565(c):
+    # Same expansion as Animation.cpp
+    upper, lower = c >> 8, c & 0xFF
+    return (upper & 0xF8,
+            ((upper & 0x07) << 5) | ((lower & 0xE0) >> 3),
+            (lower & 0x1F) << 3)
+
+
+# Encoders.  Each takes a list of frames, each frame a list of (r,g,b).
+
+def encode_rgb24(frames):
+    out = bytearray()
+    for frame in frames:
+        for r, g, b in frame:
+            out += bytearray((r, g, b))
+    return out
+
+
+def runs(pixels):
+    """Split a frame into (length, rgb565) runs of at most MAX_RUN."""
+    result = []
+    for c in pixels:
+        if result and result[-1][1] == c and result[-1][0] < MAX_RUN:
+            result[-1][0] += 1
+        else:
+            result.append([1, c])
+    return result
+
+
+def encode_rle(frames):
+    out = bytearray()
+    for frame in frames:
+        for length, c in runs([to565(*p) for p in frame]):
+            out += bytearray((length, c >> 8, c & 0xFF))
+    return out
+
+
+def delta_ops(pixels, previous):
+    """Runs for one frame, skipping pixels that are already right.
+
+    A pixel that matches the color run in progress extends it for free, even
+    if it is unchanged, so skips only split runs when they save bytes."""
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        if previous is not None and pixels[i] == previous[i]:
+            n = 1
+            while (i + n < len(pixels) and n < MAX_RUN
+                   and pixels[i + n] == previous[i + n]):
+                n += 1
+            out.append(DELTA_SKIP | n)
+        else:
+            c = pixels[i]
+            n = 1
+            while (i + n < len(pixels) and n < MAX_RUN
+                   and pixels[i + n] == c):
+                n += 1
+            out += bytearray((n, c >> 8, c & 0xFF))
+        i += n
+    return out
+
+
+def encode_delta(frames, keyframe_interval=DEFAULT_KEYFRAME_INTERVAL):
+    if len(frames) * 2 > 0xFFFF:
+        raise ValueError('too many frames for a 16 bit offset table')
+    table = bytearray()
+    body = bytearray()
+    base = len(frames) * 2
+    previous = None
+    for index, frame in enumerate(frames):
+        pixels = [to565(*p) for p in frame]
+        key = bytearray((DELTA_KEYFRAME,)) + delta_ops(pixels, None)
+        frame_bytes = key
+        forced = (keyframe_interval and index % keyframe_interval == 0)
+        if previous is not None and not forced:
+            delta = bytearray((0,)) + delta_ops(pixels, previous)
+            if len(delta) < len(key):
+                frame_bytes = delta
+        offset = base + len(body)
+        if offset > 0xFFFF:
+            raise ValueError('animation too large for a 16 bit offset table')
+        table += bytearray((offset & 0xFF, offset >> 8))
+        body += frame_bytes
+        previous = pixels
+    return table + body
+
+
+# Decoders, written the same way as Animation.cpp so they catch format bugs.
+
+def decode_rgb24(data, frame_count, led_count):
+    frames = []
+    for f in range(frame_count):
+        base = f * led_count * 3
+        frames.append([tuple(data[base + i * 3:base + i * 3 + 3])
+                       for i in range(led_count)])
+    return frames
+
+
+def decode_rle(data, frame_count, led_count):
+    frames = []
+    pos = 0
+    for f in range(frame_count):
+        frame = []
+        while len(frame) < led_count:
+            length = data[pos] & 0x7F
+            frame += [from565((data[pos + 1] << 8) | data[pos + 2])] * length
+            pos += 3
+        frames.append(frame[:led_count])
+    return frames
+
+
+def decode_delta_frame(data, frame, strip):
+    entry = frame * 2
+    pos = (data[entry] | (data[entry + 1] << 8)) + 1
+    count = 0
+    while count < len(strip):
+        run = data[pos]
+        pos += 1
+        if run & DELTA_SKIP:
+            count += run & 0x7F
+            continue
+        color = from565((data[pos] << 8) | data[pos + 1])
+        pos += 2
+        strip[count:count + run] = [color] * run
+        count += run
+
+
+def decode_delta(data, frame_count, led_count):
+    strip = [(0, 0, 0)] * led_count
+    frames = []
+    for f in range(frame_count):
+        decode_delta_frame(data, f, strip)
+        frames.append(list(strip))
+    return frames
+
+
+ENCODERS = {
+    ENCODING_RGB24: encode_rgb24,
+    ENCODING_RGB565_RLE: encode_rle,
+    ENCODING_RGB565_DELTA: encode_delta,
+}
+
+DECODERS = {
+    ENCODING_RGB24: decode_rgb24,
+    ENCODING_RGB565_RLE: decode_rle,
+    ENCODING_RGB565_DELTA: decode_delta,
+}
+
+
+# Input
+
+def read_image(path):
+    from PIL import Image
+    image = Image.open(path).convert('RGB')
+    width, height = image.size
+    pixels = image.load()
+    return [[pixels[x, y] for y in range(height)] for x in range(width)]
+
+
+def read_header(path, led_count):
+    """Decode the data array and Animation/animation declaration in a pov.h."""
+    text = open(path).read()
+    body = re.search(r'\{([^}]*)\}', text).group(1)
+    data = bytearray(int(v, 0) for v in re.findall(r'0x[0-9a-fA-F]+|\d+', body))
+    decl = re.search(r'nimation\s+\w+\s*\(\s*(\d+)\s*,\s*\w+\s*,\s*(\w+)'
+                     r'(?:\s*,\s*(\d+))?', text)
+    frame_count = int(decl.group(1))
+    name = decl.group(2)
+    if decl.group(3):
+        led_count = int(decl.group(3))
+    if led_count is None:
+        raise ValueError('%s does not give an LED count, use --leds' % path)
+    # The per-sketch animation classes number their encodings differently.
+    if name in ('ENCODING_RGB24', 'ENCODING_NONE'):
+        encoding = ENCODING_RGB24
+    elif name in ('ENCODING_RGB565_RLE', 'ENCODING_16RLE'):
+        encoding = ENCODING_RGB565_RLE
+    elif name == 'ENCODING_RGB565_DELTA':
+        encoding = ENCODING_RGB565_DELTA
+    else:
+        raise ValueError('%s: unsupported encoding %s' % (path, name))
+    return DECODERS[encoding](data, frame_count, led_count)
+
+
+# Output
+
+ENCODING_LABELS = {
+    ENCODING_RGB24: ('None', 'ENCODING_RGB24'),
+    ENCODING_RGB565_RLE: ('16 bit RLE', 'ENCODING_RGB565_RLE'),
+    ENCODING_RGB565_DELTA: ('16 bit RLE, delta from previous frame',
+                            'ENCODING_RGB565_DELTA'),
+}
+
+
+def write_header(out, name, frames, encoding, data):
+    label, constant = ENCODING_LABELS[encoding]
+    led_count = len(frames[0])
+    out.write('// Data file for animation %s\n' % name)
+    out.write('// Compression: %s\n' % label)
+    out.write('// Uncompressed size: %d bytes\n' % (len(frames) * led_count * 3))
+    out.write('// Compressed size: %d bytes\n' % len(data))
+    out.write('const PROGMEM prog_uint8_t %sData[]  = {\n' % name)
+    for i in range(0, len(data), 12):
+        out.write('  ' + ', '.join('%3d' % b for b in data[i:i + 12]) + ',\n')
+    out.write('};\n')
+    out.write('Animation %s(%d,%sData, %s, %d);\n'
+              % (name, len(frames), name, constant, led_count))
+
+
+def quantized(frames, encoding):
+    if encoding == ENCODING_RGB24:
+        return frames
+    return [[from565(to565(*p)) for p in frame] for frame in frames]
+
+
+def bench(frames, keyframe_interval):
+    raw = len(frames) * len(frames[0]) * 3
+    print('%d frames of %d LEDs, %d bytes raw'
+          % (len(frames), len(frames[0]), raw))
+    for encoding in (ENCODING_RGB24, ENCODING_RGB565_RLE,
+                     ENCODING_RGB565_DELTA):
+        if encoding == ENCODING_RGB565_DELTA:
+            data = encode_delta(frames, keyframe_interval)
+        else:
+            data = ENCODERS[encoding](frames)
+        start = time.time()
+        decoded = DECODERS[encoding](data, len(frames), len(frames[0]))
+        elapsed = time.time() - start
+        ok = decoded == quantized(frames, encoding)
+        print('%-40s %6d bytes  %5.2f:1  %7.1f us/frame (host)  %s'
+              % (ENCODING_LABELS[encoding][0], len(data),
+                 float(raw) / len(data), elapsed * 1e6 / len(frames),
+                 'ok' if ok else 'MISMATCH'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('input', help='image, or pov.h to re-encode')
+    parser.add_argument('-o', '--output', help='pov.h to write (default stdout)')
+    parser.add_argument('-e', '--encoding', choices=sorted(ENCODING_NAMES),
+                        default='delta')
+    parser.add_argument('-n', '--name', default='pov',
+                        help='animation variable name')
+    parser.add_argument('-k', '--keyframes', type=int,
+                        default=DEFAULT_KEYFRAME_INTERVAL,
+                        help='force a keyframe every N frames, to bound the '
+                             'cost of seeking (default %(default)s; 0 for '
+                             'only when smaller)')
+    parser.add_argument('--leds', type=int,
+                        help='LED count, for pov.h files that do not say')
+    parser.add_argument('--bench', action='store_true',
+                        help='compare encodings instead of writing a file')
+    args = parser.parse_args()
+
+    if args.input.endswith('.h'):
+        frames = read_header(args.input, args.leds)
+    else:
+        frames = read_image(args.input)
+
+    if args.bench:
+        bench(frames, args.keyframes)
+        return
+
+    encoding = ENCODING_NAMES[args.encoding]
+    if encoding == ENCODING_RGB565_DELTA:
+        data = encode_delta(frames, args.keyframes)
+    else:
+        data = ENCODERS[encoding](frames)
+    if DECODERS[encoding](data, len(frames), len(frames[0])) != \
+            quantized(frames, encoding):
+        sys.exit('round trip check failed')
+
+    if args.output:
+        with open(args.output, 'w') as out:
+            write_header(out, args.name, frames, encoding, data)
+    else:
+        write_header(sys.stdout, args.name, frames, encoding, data)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,217 @@
+#!/usr/bin/env python
+# BlinkyTape frame sender
+#
+# Streams frames to a sketch using SerialFrame (e.g. PaintingSource)
+# and reports the frame rate. Frames come from an image (one column per
+# frame, like animation_codec.py), an existing pov.h, or a built in rainbow.
+# Each frame is sent whole or as changes from the last one, whichever is
+# shorter. Needs pyserial.
+#
+#   frame_sender.py /dev/ttyACM0 --bench                 (rainbow, report fps)
+#   frame_sender.py /dev/ttyACM0 -i image.png --loop     (play an image)
+#   frame_sender.py -i pov.h --estimate                  (no board needed)
+#
+# --estimate prints the bytes per frame and the fastest the link could go at
+# each baud rate, counting 10 bits per byte plus the time to show the strip.
+
+import argparse
+import colorsys
+import os
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import animation_codec
+
+FRAME_SYNC = b'\xa5\x5a'
+FRAME_RAW = 0
+FRAME_RUNS = 1
+FRAME_ACK = 0x06
+FRAME_NAK = 0x15
+
+OP_LITERAL = 0x00
+OP_FILL = 0x40
+OP_SKIP = 0x80
+MAX_RUN = 64
+MAX_SKIP = 128
+
+
+def crc_ccitt(data, crc=0xFFFF):
+    # Same as avr-libc's _crc_ccitt_update()
+    for b in bytearray(data):
+        b ^= crc & 0xFF
+        b = (b ^ (b << 4)) & 0xFF
+        crc = ((b << 8) | (crc >> 8)) ^ (b >> 4) ^ (b << 3)
+        crc &= 0xFFFF
+    return crc
+
+
+def encode_runs(pixels, previous):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(OP_LITERAL | (len(chunk) - 1))
+            for p in chunk:
+                out.extend(p)
+
+    i = 0
+    while i < len(pixels):
+        if previous is not None and pixels[i] == previous[i]:
+            n = 1
+            while (i + n < len(pixels) and n < MAX_SKIP
+                   and pixels[i + n] == previous[i + n]):
+                n += 1
+            flush()
+            out.append(OP_SKIP | (n - 1))
+        else:
+            n = 1
+            while (i + n < len(pixels) and n < MAX_RUN
+                   and pixels[i + n] == pixels[i]):
+                n += 1
+            if n == 1:
+                literal.append(pixels[i])
+            else:
+                flush()
+                out.append(OP_FILL | (n - 1))
+                out.extend(pixels[i])
+        i += n
+    flush()
+    return out
+
+
+def encode_frame(pixels, previous, seq):
+    """Returns the whole frame, raw or as runs, whichever is shorter."""
+    raw = bytearray()
+    for p in pixels:
+        raw.extend(p)
+    runs = encode_runs(pixels, previous)
+    if len(runs) < len(raw):
+        kind, payload = FRAME_RUNS, runs
+    else:
+        kind, payload = FRAME_RAW, raw
+    body = struct.pack('<BBH', kind, seq & 0xFF, len(payload)) + bytes(payload)
+    return FRAME_SYNC + body + struct.pack('<H', crc_ccitt(body))
+
+
+def rainbow(led_count, frame_count):
+    frames = []
+    for f in range(frame_count):
+        frame = []
+        for i in range(led_count):
+            r, g, b = colorsys.hsv_to_rgb(((i + f) % led_count)
+                                          / float(led_count), 1, 1)
+            frame.append((int(r * 255), int(g * 255), int(b * 255)))
+        frames.append(frame)
+    return frames
+
+
+class Sender(object):
+    def __init__(self, port, timeout):
+        self.port = port
+        self.timeout = timeout
+        self.seq = 0
+        self.previous = None
+        self.errors = 0
+        self.bytes = 0
+
+    def wait(self, seq):
+        # Skip anything the sketch prints that isn't an answer
+        deadline = time.time() + self.timeout
+        while time.time() < deadline:
+            c = self.port.read(1)
+            if not c or ord(c) not in (FRAME_ACK, FRAME_NAK):
+                continue
+            s = self.port.read(1)
+            if s and ord(s) == seq:
+                return ord(c) == FRAME_ACK
+        return False
+
+    def send(self, pixels):
+        frame = encode_frame(pixels, self.previous, self.seq)
+        self.port.write(frame)
+        self.bytes += len(frame)
+        if self.wait(self.seq):
+            self.previous = pixels
+        else:
+            # The strip may now hold part of a bad frame; send the next one
+            # whole so it doesn't depend on what's there.
+            self.errors += 1
+            self.previous = None
+        self.seq = (self.seq + 1) & 0xFF
+
+
+def estimate(frames, show_time, bauds):
+    sizes = []
+    previous = None
+    for seq, pixels in enumerate(frames):
+        sizes.append(len(encode_frame(pixels, previous, seq)))
+        previous = pixels
+    raw = len(frames[0]) * 3 + 8
+    average = sum(sizes) / float(len(sizes))
+    print('%d frames of %d LEDs: %d bytes/frame sent whole, %.1f average'
+          % (len(frames), len(frames[0]), raw, average))
+    for baud in bauds:
+        for label, size in (('whole', raw), ('encoded', average)):
+            seconds = size * 10.0 / baud + show_time + 2 * 10.0 / baud
+            print('  %7d baud, %-7s: %6.1f fps' % (baud, label, 1 / seconds))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('port', nargs='?', help='serial port of the board')
+    parser.add_argument('-b', '--baud', type=int, default=115200)
+    parser.add_argument('-i', '--input', help='image or pov.h to play')
+    parser.add_argument('--leds', type=int, default=60)
+    parser.add_argument('--loop', action='store_true',
+                        help='play the input until interrupted')
+    parser.add_argument('--bench', action='store_true',
+                        help='send 500 frames as fast as possible, print fps')
+    parser.add_argument('--estimate', action='store_true',
+                        help='print the best possible fps without a board')
+    parser.add_argument('--timeout', type=float, default=0.5,
+                        help='seconds to wait for each answer')
+    args = parser.parse_args()
+
+    if args.input and args.input.endswith('.h'):
+        frames = animation_codec.read_header(args.input, args.leds)
+    elif args.input:
+        frames = animation_codec.read_image(args.input)
+    else:
+        frames = rainbow(args.leds, args.leds)
+
+    # WS2811 pixels take 30us each, plus the 50us latch
+    show_time = (len(frames[0]) * 30 + 50) / 1e6
+
+    if args.estimate:
+        estimate(frames, show_time, (115200, 1000000))
+        return
+    if not args.port:
+        parser.error('a serial port is needed unless using --estimate')
+
+    import serial
+    port = serial.Serial(args.port, args.baud, timeout=args.timeout)
+    time.sleep(2)  # Boards that reset when the port opens
+    port.reset_input_buffer()
+    sender = Sender(port, args.timeout)
+
+    count = 500 if args.bench else len(frames)
+    start = time.time()
+    sent = 0
+    while True:
+        sender.send(frames[sent % len(frames)])
+        sent += 1
+        if sent == count and not args.loop:
+            break
+    elapsed = time.time() - start
+    print('%d frames in %.2fs: %.1f fps, %.1f bytes/frame, %d errors'
+          % (sent, elapsed, sent / elapsed, sender.bytes / float(sent),
+             sender.errors))
+
+
+if __name__ == '__main__':
+    main()
@@ -18,7 +18,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "ERxPachube.h"
 //#include <stdio.h> // for function sprintf
-#include <stdlib.h> // For function dtostrf
+#include <stdlib.h> // For function atoi, atof
+#include <string.h> // For function strncpy
 #include <EthernetClient.h> // EthernetClient
 #include <avr/pgmspace.h>
 
@@ -30,14 +31,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // If exceed this time, we assume we won't get the response anyway.
 #define HTTP_WAITING_TIMEOUT 4000 // milliseconds, 
 
-static String dummyString; // Used to return the dummy string reference.
-
 byte remoteServer[] = { 173,203,98,29 };            // api.pachube.com
 EthernetClient localClient;
 //Client localClient(remoteServer, 80);
 
+#ifdef ENABLE_DEBUG_MESSAGE
 #define bufferSIZE 128
 char pDataBuffer[bufferSIZE];
+#endif
 
 char pHttpBegin[]  = "HTTP/1.1";
 /******************Save the static strings in program memory***********/
@@ -66,8 +67,6 @@ const char debug_success[] PROGMEM = "SUCCESS" ;
 const char debug_fail[] PROGMEM = "FAIL" ;
 const char debug_error_data_stream_length[] PROGMEM = "ERROR data stream length: " ;
 const char debug_data_start[] PROGMEM = "Data start from the empty line above" ;
-const char debug_find_r[] PROGMEM = "Find \\r" ;
-const char debug_find_n[] PROGMEM = "Find \\n" ;
 const char debug_calculate_http_content_length[] PROGMEM = "Calculate http content length:" ;
 
 /*********************Debug util***************************/
@@ -91,30 +90,6 @@ void DEBUG_PRINT_LN(T message)
 #endif
 }
 
-template<>
-void DEBUG_PRINT(const String& message) 
-{
-#ifdef ENABLE_DEBUG_MESSAGE
-	String tmpStr = message;
-
-	tmpStr.toCharArray(pDataBuffer, bufferSIZE);
-
-	Serial.print(pDataBuffer); 
-#endif
-}
-
-template<>
-void DEBUG_PRINT_LN(const String& message) 
-{
-#ifdef ENABLE_DEBUG_MESSAGE
-	String tmpStr = message;
-
-	tmpStr.toCharArray(pDataBuffer, bufferSIZE);
-
-	Serial.println(pDataBuffer); 
-#endif
-}
-
 void DEBUG_PRINT_LN_p(const char* pProgMemAddr) 
 {
 #ifdef ENABLE_DEBUG_MESSAGE
@@ -211,7 +186,7 @@ int waitForRepsonse(Client& client){
 	}
 	DEBUG_PRINT('\n');
 
-	unsigned int bufferSize = 50;
+	const unsigned int bufferSize = 50;
 	char pBuffer[bufferSize];
 
 	int httpStatusCode = 0; // No http status code.
@@ -246,20 +221,11 @@ void sendToServer(T data)
 	DEBUG_PRINT(data);
 }
 
-template<>
-void sendToServer(const String& data)
-{
-	String& tmpData = const_cast<String&>(data);
-	
-	tmpData.toCharArray(pDataBuffer, bufferSIZE);
-	sendToServer(pDataBuffer);
-}
-
 void sendToServer_p(const char* pProgMemAddr)
 {
-	//loadStringFromProgramMemory(pDataBuffer, pStr);
-	loadStringFromProgramMemory(pDataBuffer, pProgMemAddr, bufferSIZE);
-	sendToServer(pDataBuffer); 
+	// Print it straight from the program memory, rather than copy it into a buffer first.
+	localClient.print((const __FlashStringHelper*)pProgMemAddr);
+	DEBUG_PRINT_p(pProgMemAddr);
 }
 
 /*
@@ -305,54 +271,17 @@ int getHttpStatusCodeFromHeader(char* pFirstLineOfHttpHeader)
 	return httpStatusCode;    
 }
 
-/*********************HackedShareString***************************/
-// This class is to avoid the unnecessary string copy and memory reallocation.
-// This string is just a reference to an existing string memory.
-class HackedShareString : public String
-{
-public:
-	HackedShareString();
-	HackedShareString(char* pStr);
-	~HackedShareString();
-
-	void aquire(char* pStr ); // We don't acquire string literal. So the parameter can't be const.
-
-};
-
-HackedShareString::HackedShareString()
-{
-	free(buffer);
-	buffer = NULL;
-}
-
-HackedShareString::HackedShareString(char* pStr)
-{
-	free(buffer); // Free the owned memory.
-	buffer = NULL;
-
-	aquire(pStr);
-}
-
-HackedShareString::~HackedShareString()
-{
-	buffer = NULL; // avoid the base class release it.
-}
-
-void HackedShareString::aquire(char* pStr )
-{
-	// Share the same memory with the input String
-	buffer = pStr;
-	capacity = len = strlen(pStr);
-}
-
-HackedShareString sHackedShareString;
-
 /*********************ERxPachube***************************/
 
+#if DATASTREAM_VALUES_SIZE > 255
+#error "DATASTREAM_VALUES_SIZE must be no more than 255"
+#endif
+
 ERxPachube::ERxPachube(const char* APIKey, unsigned long feedId) 
-: mAPIkey(APIKey), mFeedId(feedId), mDatasteamLength(0)
+: mFeedId(feedId), mDatasteamLength(0)
 {
-
+	strncpy(mAPIkey, APIKey, PACHUBE_API_KEY_SIZE - 1);
+	mAPIkey[PACHUBE_API_KEY_SIZE - 1] = '\0';
 }
 
 unsigned int ERxPachube::countDatastreams() const
@@ -366,57 +295,58 @@ unsigned int ERxPachube::countDatastreams() const
 	return mDatasteamLength;
 }
 
-const String& ERxPachube::getValueString(unsigned int id) const
+String ERxPachube::getValueString(unsigned int id) const
+{
+	return String(getValueChars(id));
+}
+
+const char* ERxPachube::getValueChars(unsigned int id) const
 {
 	int index = getIndex(id);
 
 	if(index != -1)
-		return mDataStreams[index].mValue;
+		return getValueCharsByIndex(index);
 
-	return dummyString;
+	return "";
 }
 
 int ERxPachube::getValueInt(unsigned int id) const
 {
-	const String& tmpConstStr = getValueString(id); 
-	String& tmpStr = const_cast<String&>(tmpConstStr);
-
-	// Library Defect: This function doesn't change the string. This function in the library should be const.
-	// So we won't need the cast above then.
-	tmpStr.toCharArray(pDataBuffer, bufferSIZE);
-	int iValue = atoi(pDataBuffer); 
-	
-	return iValue;
+	return atoi(getValueChars(id));
 }
 
 float ERxPachube::getValueFloat(unsigned int id) const
 {
-	const String& tmpConstStr = getValueString(id); 
-	String& tmpStr = const_cast<String&>(tmpConstStr);
-
-	tmpStr.toCharArray(pDataBuffer, bufferSIZE); 
-	float fValue = atof(pDataBuffer);
-
-	return fValue;
+	return atof(getValueChars(id));
 }
 
 unsigned int ERxPachube::getIdByIndex(unsigned int index) const
 {
 	if(index < countDatastreams())
-		return mDataStreams[index].mId;
+		return mIds[index];
 
 	return INVALID_DATA_STREAM_ID;
 }
 
-const String& ERxPachube::getValueByIndex(unsigned int index) const
+String ERxPachube::getValueByIndex(unsigned int index) const
+{
+	return String(getValueCharsByIndex(index));
+}
+
+const char* ERxPachube::getValueCharsByIndex(unsigned int index) const
 {
 	if(index < countDatastreams())
-		return mDataStreams[index].mValue;
+		return mValues + (index > 0 ? mValueEnds[index - 1] : 0);
 
-	return dummyString;
+	return "";
 }
 
-const String& ERxPachube::getAPIKey() const
+String ERxPachube::getAPIKey() const
+{
+	return String(mAPIkey);
+}
+
+const char* ERxPachube::getAPIKeyChars() const
 {
 	return mAPIkey;
 }
@@ -428,32 +358,45 @@ unsigned long ERxPachube::getFeedId() const
 
 bool ERxPachube::addData(unsigned int id)
 {
-	pDataBuffer[0]='\0';
-	sHackedShareString.aquire(pDataBuffer);
-	return addData(id, sHackedShareString);
+	return addData(id, "");
+}
+
+bool ERxPachube::addData(unsigned int id, const char* value)
+{
+	int index = addIndex(id);
+
+	if(index != -1)
+		return updateData(id, value);
+
+	return false;
 }
 
 bool ERxPachube::addData(unsigned int id, const String& value)
+{
+	int index = addIndex(id);
+
+	if(index != -1)
+		return updateData(id, value);
+
+	return false;
+}
+
+bool ERxPachube::updateData(unsigned int id, const char* value)
 {
 	int index = getIndex(id);
 
-	if(index != -1) // Already exists
-	{
-		mDataStreams[index].mValue = value; 
-		return true;
-	}
-	else
+	if(index != -1)
 	{
-		if(mDatasteamLength < MAX_DATASTREAM_NUM)
-		{
-			mDataStreams[mDatasteamLength].mId = id;
-			mDataStreams[mDatasteamLength].mValue = value; 
-			mDatasteamLength++;
-			return true;
-		}
-		else
+		unsigned int length = strlen(value);
+		char* pValue = resizeValue(index, length);
+		if(NULL == pValue)
 			return false;
+
+		memcpy(pValue, value, length);
+		return true;
 	}
+
+	return false;
 }
 
 bool ERxPachube::updateData(unsigned int id, const String& value)
@@ -462,8 +405,13 @@ bool ERxPachube::updateData(unsigned int id, const String& value)
 
 	if(index != -1)
 	{
-		mDataStreams[index].mValue = value; 
+		unsigned int length = value.length();
+		char* pValue = resizeValue(index, length);
+		if(NULL == pValue)
+			return false;
 
+		for(unsigned int i = 0; i < length; i++)
+			pValue[i] = value.charAt(i);
 		return true;
 	}
 
@@ -472,41 +420,110 @@ bool ERxPachube::updateData(unsigned int id, const String& value)
 
 bool ERxPachube::updateData(unsigned int id, int value)
 { 
-	itoa((signed long)value, pDataBuffer, 10);
+	char pValue[12];
+	FeedWriter::format(pValue, (long)value);
 
-	return updateDataHelper(id, pDataBuffer);
+	return updateData(id, (const char*)pValue);
 }
 
 bool ERxPachube::updateData(unsigned int id, float value)
 {
 	// The sprintf function doesn't work. When value = 11.5, the converted string is 0.
-	//sprintf(pDataBuffer,"%d",value);
-	dtostrf(value, 2, 6, pDataBuffer);
-	return updateDataHelper(id, pDataBuffer);
+	char pValue[24];
+	FeedWriter::format(pValue, value, 6);
+
+	return updateData(id, (const char*)pValue);
 }
 
 int ERxPachube::getIndex(unsigned int id) const
 {
 	for(unsigned int i = 0; i < mDatasteamLength; i++)
 	{
-		if(id == mDataStreams[i].mId)
+		if(id == mIds[i])
 			return i;
 	}
 
 	return -1;
 }
 
+int ERxPachube::addIndex(unsigned int id)
+{
+	int index = getIndex(id);
+
+	if(index != -1) // Already exists
+		return index;
+
+	if(mDatasteamLength >= MAX_DATASTREAM_NUM)
+		return -1;
+
+	index = mDatasteamLength;
+	mIds[index] = id;
+	mValueEnds[index] = (index > 0 ? mValueEnds[index - 1] : 0);
+	mDatasteamLength++;
+
+	// It needs the space for the '\0' at least
+	if(NULL == resizeValue(index, 0))
+	{
+		mDatasteamLength--;
+		return -1;
+	}
+
+	return index;
+}
+
 void ERxPachube::clearData()
 {
 	mDatasteamLength = 0;
 }
 
-bool ERxPachube::updateDataHelper(unsigned int id, char* value)
+void ERxPachube::writeData(FeedWriter& writer) const
+{
+	writer.beginFeed();
+	for(unsigned int i = 0; i < countDatastreams(); i++)
+	{
+		writer.beginDatastream((unsigned long)getIdByIndex(i));
+		writer.value(getValueCharsByIndex(i));
+		writer.endDatastream();
+	}
+	writer.endFeed();
+}
+
+char* ERxPachube::beginLastValue(unsigned int& size)
 {
-	sHackedShareString.aquire(value);
+	unsigned int start = (mDatasteamLength > 1 ? mValueEnds[mDatasteamLength - 2] : 0);
 
-	updateData(id, sHackedShareString);
+	size = DATASTREAM_VALUES_SIZE - start;
+	return mValues + start;
+}
 
+void ERxPachube::endLastValue()
+{
+	unsigned int start = (mDatasteamLength > 1 ? mValueEnds[mDatasteamLength - 2] : 0);
+	unsigned int end = start + strlen(mValues + start) + 1;
+
+	if(end >= DATASTREAM_VALUES_SIZE)
+		mDatasteamLength--; // It filled all the space, so it was probably cut short. Drop it.
+	else
+		mValueEnds[mDatasteamLength - 1] = end;
+}
+
+char* ERxPachube::resizeValue(unsigned int index, unsigned int length)
+{
+	unsigned int start = (index > 0 ? mValueEnds[index - 1] : 0);
+	unsigned int oldEnd = mValueEnds[index];
+	unsigned int newEnd = start + length + 1; // For the '\0'
+	unsigned int used = mValueEnds[mDatasteamLength - 1];
+
+	if(used - oldEnd + newEnd > DATASTREAM_VALUES_SIZE)
+		return NULL; // No space left
+
+	// Move the values after it along, and where they end
+	memmove(mValues + newEnd, mValues + oldEnd, used - oldEnd);
+	for(unsigned int i = index; i < mDatasteamLength; i++)
+		mValueEnds[i] = mValueEnds[i] + newEnd - oldEnd;
+
+	mValues[newEnd - 1] = '\0';
+	return mValues + start;
 }
 
 /*******************ERxPachubeDataOut*****************************/
@@ -554,20 +571,12 @@ int ERxPachubeDataOut::updatePachube() const
 	if(!(localClient.connect(remoteServer, 80) > 0))
 		return 1;
 
+	// A writer without anything to write to just counts the length.
 	DEBUG_PRINT_LN_p(debug_calculate_http_content_length/*"Calculate http content length:"*/);
-	unsigned int httpContentLength = 0;
-	unsigned int dataLength = countDatastreams();
-	for(unsigned int i = 0; i < dataLength; i++)
-	{
-		unsigned int id = getIdByIndex(i);
-		ultoa((unsigned long)id, pDataBuffer, 10);
-		httpContentLength += strlen(pDataBuffer);
-
-		httpContentLength += getValueByIndex(i).length();
-
-		httpContentLength += 2; // for ',' and '\n'
-		DEBUG_PRINT_LN(httpContentLength);
-	}
+	FeedWriter contentLength(NULL, FEED_CSV);
+	writeData(contentLength);
+	unsigned long httpContentLength = contentLength.count();
+	DEBUG_PRINT_LN(httpContentLength);
 
 	// Send PUT request. 
 
@@ -575,7 +584,7 @@ int ERxPachubeDataOut::updatePachube() const
 	sendToServer_p(http_put_header/*"PUT /v2/feeds/"*/);
 	sendToServer(getFeedId());
 	sendToServer_p(http_host_key_header/*".csv HTTP/1.1\nHost: api.pachube.com\nX-PachubeApiKey: "*/);
-	sendToServer(getAPIKey());
+	sendToServer(getAPIKeyChars());
 	//sendToServer(("\nUser-Agent: Arduino (Pachube Out)"));
 	sendToServer_p(http_content_header/*"\nContent-Type: text/csv\nContent-Length: "*/);
 	sendToServer(httpContentLength);
@@ -583,13 +592,12 @@ int ERxPachubeDataOut::updatePachube() const
 
 
 	// Send content
-	for(unsigned int i = 0; i < dataLength; i++)
-	{
-		sendToServer(getIdByIndex(i));
-		sendToServer(',');
-		sendToServer(getValueByIndex(i));
-		sendToServer('\n');
-	}
+	FeedWriter content(&localClient, FEED_CSV);
+	writeData(content);
+#ifdef ENABLE_DEBUG_MESSAGE
+	FeedWriter debugContent(&Serial, FEED_CSV);
+	writeData(debugContent);
+#endif
 
 	// Wait for response.
 	int httpStatusCode = waitForRepsonse(localClient);
@@ -700,82 +708,93 @@ int ERxPachubeDataIn::syncPachube()
 	sendToServer_p(http_get_header/*"GET /v2/feeds/"*/);
 	sendToServer(getFeedId());
 	sendToServer_p(http_host_key_header/*".csv HTTP/1.1\nHost: api.pachube.com\nX-PachubeApiKey: "*/);
-	sendToServer(getAPIKey());
-	sendToServer("\n\n");
+	sendToServer(getAPIKeyChars());
+	sendToServer_p(http_connection_header/*"\nConnection: close\n\n"*/);
 
 	// Wait for response.
 	int httpStatusCode = waitForRepsonse(localClient);
 
 	if(200 == httpStatusCode )
 	{
-		// Parse the received data.
-		unsigned int bufferSize = 128;
-		char pBuffer[bufferSize];
+		// Parse the received data a block at a time.
+		// The http header runs up to the empty line, then each line is "<stream_id>,<retrieved_at>,<value>".
+		// The value of a new data stream is read straight into the space left after the others.
+		char pId[8];
+		char pValue[FEED_VALUE_SIZE];
+		FeedReader reader(FEED_CSV, pId, sizeof(pId), pValue, sizeof(pValue));
+		char pBlock[32];
 		bool bDataBegin = false;
-		while (localClient.available())
+		unsigned int lineLength = 0;
+		int index = -1;
+		unsigned long timeoutStart = millis();
+		while(millis() - timeoutStart < HTTP_WAITING_TIMEOUT)
 		{
-			unsigned int length = getline(localClient, pBuffer, bufferSize);
-			DEBUG_PRINT(pBuffer);
-			
-			if(2 == length && false == bDataBegin)
+			int length = localClient.read((uint8_t*)pBlock, sizeof(pBlock));
+			if(length <= 0)
 			{
-				DEBUG_PRINT_LN_p(debug_data_start/*" Data start from the empty line above"*/);
-				bDataBegin = true;
+				if(!localClient.connected())
+					break; // The server has sent all of it.
+
+				delay(1);
 				continue;
 			}
+			timeoutStart = millis();
 
-			if(bDataBegin)
+			int pos = 0;
+			while(!bDataBegin && pos < length)
 			{
-				HackedShareString strLine;
-				strLine.aquire(pBuffer);
-				int pos = 0;
-				pos = strLine.indexOf(',', pos);
-				if(-1 == pos)
-					continue;
-
-				//String strID = strLine.substring(0, pos);
-				int strIDLength = pos;
-				char strID[strIDLength + 1];
-				for(int i = 0; i < strIDLength; i++)
-					strID[i] = strLine[i];
-				strID[strIDLength] = '\0';
-
-				pos = strLine.indexOf(',', pos + 1);
-				if(-1 == pos)
-					continue;
-
-				//String strValue = strLine.substring(pos + 1, strLine.length());
-
-				int strValueLength = strLine.length() - pos - 1;
-				char strValue[strValueLength + 1];
-				for(int i = 0; i < strValueLength; i++)
-					strValue[i] = strLine[pos + 1 + i];
-				strValue[strValueLength] = '\0';
-
-
-				if('\r' == strValue[strValueLength - 2])
+				char c = pBlock[pos++];
+				if('\n' == c)
 				{
-					DEBUG_PRINT_LN(debug_find_r/*"Find \\r"*/);
-					strValue[strValueLength - 2] = '\0';
+					if(0 == lineLength)
+					{
+						DEBUG_PRINT_LN_p(debug_data_start/*" Data start from the empty line above"*/);
+						bDataBegin = true;
+					}
+					lineLength = 0;
 				}
-				else if('\n' == strValue[strValueLength - 1])
-				{
-					DEBUG_PRINT_LN(debug_find_n/*"Find \\n"*/);
-					strValue[strValueLength - 1] = '\0';
-				}
-				
-				DEBUG_PRINT_LN(strID);
-				DEBUG_PRINT_LN(strValue);
+				else if('\r' != c)
+					lineLength++;
+			}
 
-				//strID.toCharArray(pDataBuffer, bufferSIZE);
-				int id = atoi(strID);
-				strLine.aquire(strValue);
-				addData((unsigned int)id, strLine);
+			while(pos < length)
+			{
+				pos += reader.parse(pBlock + pos, length - pos);
 
-				if(countDatastreams() == MAX_DATASTREAM_NUM) // No more space to save the left data.
-					break;
+				if(FEED_EVENT_ID == reader.event())
+				{
+					DEBUG_PRINT_LN(pId);
+					// If there is no more space to save the data, just skip it.
+					index = addIndex((unsigned int)atoi(pId));
+					if(index != -1 && index == (int)countDatastreams() - 1)
+					{
+						unsigned int size;
+						char* pLastValue = beginLastValue(size);
+						reader.setValueBuffer(pLastValue, size);
+					}
+					else
+						reader.setValueBuffer(pValue, sizeof(pValue));
+				}
+				else if(FEED_EVENT_DATASTREAM == reader.event())
+				{
+					DEBUG_PRINT_LN(reader.value());
+					if(reader.value() != pValue)
+						endLastValue();
+					else if(index != -1)
+						updateData(getIdByIndex(index), (const char*)pValue);
+					index = -1;
+				}
 			}
-		} 
+		}
+
+		if(FEED_EVENT_DATASTREAM == reader.finish() && index != -1)
+		{
+			// The last line doesn't end with '\n'
+			if(reader.value() != pValue)
+				endLastValue();
+			else
+				updateData(getIdByIndex(index), (const char*)pValue);
+		}
 	}	
 
 	localClient.stop();
@@ -23,7 +23,9 @@ Function
  * The supported data format is csv.
 
 Required library
- * WString, Ethernet, SPI
+ * WString, FeedCodec, Ethernet, SPI
+ * ERxPachube.h includes FeedCodec.h, but the Arduino IDE before 1.6.6 only builds the
+   libraries a sketch includes itself, so sketches include <FeedCodec.h> as well.
 
 Project home
  * http://code.google.com/p/pachubelibrary/
@@ -37,25 +39,24 @@ SRG Changes
 #define ERXPACHUBE_H
 
 #include <WString.h> // String
+#include <FeedCodec.h> // FeedWriter, FeedReader
 
 // Define the max number of the data streams. 
 // The value can be changed on demand.
 #define MAX_DATASTREAM_NUM 30
 
-#define INVALID_DATA_STREAM_ID 0xFFFF
+// Define the memory shared by the values of all the data streams.
+// Each value takes its length plus one, for the '\0'.
+// The value can be changed on demand, up to 255.
+#define DATASTREAM_VALUES_SIZE 160
 
-#define PACHUBE_LIB_VER "3.1"
+// Define the space for the API key, including the '\0'.
+// A longer key is cut short. The value can be changed on demand.
+#define PACHUBE_API_KEY_SIZE 65
 
-// Pachube data stream structure
-class ERxDataStream
-{
-public:
-	// Even though the server supports to use any string as the ID.
-	// But considering it is too expensive to process the string in MCU,
-	// so we just support the digital id.
-	unsigned int	mId; 
-	String			mValue;
-};
+#define INVALID_DATA_STREAM_ID 0xFFFF
+
+#define PACHUBE_LIB_VER "3.2"
 
 // Base class
 class ERxPachube
@@ -68,7 +69,11 @@ public: // For data in
 	unsigned int	countDatastreams() const;
 
 	// Return the string value of a particular data stream. Return an empty string if not exist.
-	const String&	getValueString(unsigned int id) const;
+	String			getValueString(unsigned int id) const;
+
+	// The same as getValueString, without copying the value into a String.
+	// It stays valid until the data is changed.
+	const char*		getValueChars(unsigned int id) const;
 
 	// Convert and return an int data for value of a particular data stream. Return 0 if not exist.
 	int				getValueInt(unsigned int id) const;
@@ -80,7 +85,11 @@ public: // For data in
 	unsigned int	getIdByIndex(unsigned int index) const;
 
 	// Return value of a particular data stream. Return an empty string if not exist.
-	const String&	getValueByIndex(unsigned int index) const;
+	String			getValueByIndex(unsigned int index) const;
+
+	// The same as getValueByIndex, without copying the value into a String.
+	// It stays valid until the data is changed.
+	const char*		getValueCharsByIndex(unsigned int index) const;
 
 public: // For data out
 	// Set up a data stream with a particular id.
@@ -93,11 +102,15 @@ public: // For data out
 	// If the id already exists, update its value. Return true.
 	// Otherwise, if the data stream exceed the count limitation, return false.
 	// If not, add a new data stream with the passed in id and value. Return true.
+	// If there isn't the space left for the value, the data stream is left empty. Return false.
+	bool			addData(unsigned int id, const char* value);
 	bool			addData(unsigned int id, const String& value);
 
-	// Update a particular data stream with a String value. 
-	// If success, return true. Otherwise(such as the id doesn't exist), return false.
-	bool			updateData(unsigned int, const String& value);
+	// Update a particular data stream with a string value. 
+	// If success, return true. Otherwise(such as the id doesn't exist, or there isn't the space
+	// left for the value), return false.
+	bool			updateData(unsigned int id, const char* value);
+	bool			updateData(unsigned int id, const String& value);
 
 	// Update a particular data stream with a int value. 
 	// If success, return true. Otherwise(such as the id doesn't exist), return false.
@@ -109,7 +122,10 @@ public: // For data out
 
 public:
 	// Return the API key
-	const String&	getAPIKey() const;
+	String			getAPIKey() const;
+
+	// The same as getAPIKey, without copying the key into a String.
+	const char*		getAPIKeyChars() const;
 
 	// Return the feed Id
 	unsigned long	getFeedId() const;
@@ -118,20 +134,41 @@ protected:
 	// Get the index of a particular data stream in the array. Return -1 if not find. 
 	int				getIndex(unsigned int id) const;
 
+	// Get the index of a particular data stream, adding it with an empty value if it doesn't exist.
+	// Return -1 if there isn't the space to add it.
+	int				addIndex(unsigned int id);
+
 	// Remove all the data.
 	void			clearData();
 
+	// Write all the data streams with the writer.
+	void			writeData(FeedWriter& writer) const;
+
+	// Let the value of the last data stream be read straight into the space left after it.
+	// Return where the value starts, and set size to the space there is for it.
+	char*			beginLastValue(unsigned int& size);
+
+	// Finish the value of the last data stream, once it has been read.
+	// If it used up all the space left it may have been cut short, so the data stream is removed.
+	void			endLastValue();
+
 private:
-	// Update a particular data stream with a String value. 
-	// If success, return true. Otherwise(such as the id doesn't exist), return false.
-	// This function is used for avoid the String construction when update data with a string pointer.
-	bool			updateDataHelper(unsigned int, char* value);
+	// Make the space for a value of the given length for the data stream at index, moving
+	// the values after it along. Return where to write the value, or NULL if there isn't the space.
+	char*			resizeValue(unsigned int index, unsigned int length);
 
 private:
-	String			mAPIkey;
+	char			mAPIkey[PACHUBE_API_KEY_SIZE];
 	unsigned long	mFeedId;
 
-	ERxDataStream	mDataStreams[MAX_DATASTREAM_NUM];
+	// Even though the server supports to use any string as the ID.
+	// But considering it is too expensive to process the string in MCU,
+	// so we just support the digital id.
+	unsigned int	mIds[MAX_DATASTREAM_NUM];
+	// The values are saved one after another in mValues, rather than as Strings on the heap.
+	// mValueEnds is where each one ends, after its '\0'.
+	unsigned char	mValueEnds[MAX_DATASTREAM_NUM];
+	char			mValues[DATASTREAM_VALUES_SIZE];
 	unsigned int	mDatasteamLength; // The actual length
 };
 
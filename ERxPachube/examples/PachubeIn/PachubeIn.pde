@@ -18,6 +18,7 @@ Circuit:
 * http://code.google.com/p/pachubelibrary/
 
 */
+#include "FeedCodec.h"
 #include "ERxPachube.h"
 #include <Ethernet.h>
 #include <SPI.h>
@@ -61,7 +62,7 @@ void PrintDataStream(const ERxPachube& pachube)
 	{
 		Serial.print(pachube.getIdByIndex(i));
 		Serial.print(",");
-		Serial.print(pachube.getValueByIndex(i));
+		Serial.print(pachube.getValueCharsByIndex(i));
 		Serial.println();
 	}
 }
\ No newline at end of file
@@ -21,6 +21,7 @@ Circuit:
 */
 #include <Arduino.h>
 #include <HardwareSerial.h>
+#include <FeedCodec.h>
 #include <ERxPachube.h>
 #include <Ethernet.h>
 #include <SPI.h>
@@ -73,7 +74,7 @@ void PrintDataStream(const ERxPachube& pachube)
 	{
 		Serial.print(pachube.getIdByIndex(i));
 		Serial.print(",");
-		Serial.print(pachube.getValueByIndex(i));
+		Serial.print(pachube.getValueCharsByIndex(i));
 		Serial.println();
 	}
 }
\ No newline at end of file
@@ -14,6 +14,7 @@ It doesn't require connect the Arduino to Ethernet.
 
 #include <Arduino.h>
 #include <HardwareSerial.h>
+#include <FeedCodec.h>
 #include <ERxPachube.h>
 
 #ifdef CONNECT_ETHERNET
@@ -93,12 +94,18 @@ void EqualTest(const char* pCaseName, const String& actualValue, const String& e
 	OutPutCompareMessage(pCaseName, actualValue == expctedValue);
 }
 
+void EqualTest(const char* pCaseName, const char* actualValue, const char* expctedValue)
+{
+	tatalCases++;
+	OutPutCompareMessage(pCaseName, strcmp(actualValue, expctedValue) == 0);
+}
+
 void RunPachubeUnitTest()
 {
 	BegainUnitTest();
 
 	ERxPachubeDataOut dataOut(PACHUBE_API_KEY, PACHUBE_FEED_ID);
-	EqualTest("getAPIKey", String(PACHUBE_API_KEY), dataOut.getAPIKey());
+	EqualTest("getAPIKeyChars", PACHUBE_API_KEY, dataOut.getAPIKeyChars());
 	EqualTest("getFeedId", String(PACHUBE_FEED_ID), String(dataOut.getFeedId()));
 
 	EqualTest("countDatastreams", 0, dataOut.countDatastreams());
@@ -109,7 +116,7 @@ void RunPachubeUnitTest()
 
 	EqualTest("countDatastreams", 1, dataOut.countDatastreams());
 	EqualTest("getValueInt 10", 250, dataOut.getValueInt(10));
-	EqualTest("getValueString 10", String("250"), dataOut.getValueString(10));
+	EqualTest("getValueChars 10", "250", dataOut.getValueChars(10));
 	EqualTest("getValueFloat 10", 250.0, dataOut.getValueFloat(10));
 
 	// Id 0
@@ -124,14 +131,14 @@ void RunPachubeUnitTest()
 
 	dataOut.updateData(0, "123");
 	EqualTest("getValueInt 0", 123, dataOut.getValueInt(0));
-	EqualTest("getValueString 0", String("123"), dataOut.getValueString(0));
+	EqualTest("getValueChars 0", "123", dataOut.getValueChars(0));
 
 	dataOut.updateData(0, "12.3");
 	EqualTest("getValueFloat 0", 12.3, dataOut.getValueFloat(0));
-	EqualTest("getValueString 0", String("12.3"), dataOut.getValueString(0));
+	EqualTest("getValueChars 0", "12.3", dataOut.getValueChars(0));
 
 
-	EqualTest("getValueByIndex 0", String("250"), dataOut.getValueByIndex(0));
+	EqualTest("getValueCharsByIndex 0", "250", dataOut.getValueCharsByIndex(0));
 	EqualTest("getIdByIndex 0", 10, (int)dataOut.getIdByIndex(0));
 
 	// Id 3
@@ -147,7 +154,7 @@ void RunPachubeUnitTest()
 
 	ERxPachubeDataIn datain(PACHUBE_API_KEY, PACHUBE_FEED_ID);
 
-	EqualTest("getAPIKey", String(PACHUBE_API_KEY), datain.getAPIKey());
+	EqualTest("getAPIKeyChars", PACHUBE_API_KEY, datain.getAPIKeyChars());
 	EqualTest("getFeedId", String(PACHUBE_FEED_ID), String(datain.getFeedId()));
 
 #ifdef CONNECT_ETHERNET
@@ -188,7 +195,7 @@ void PrintDataStream(const ERxPachube& pachube)
 	{
 		Serial.print(pachube.getIdByIndex(i));
 		Serial.print(",");
-		Serial.print(pachube.getValueByIndex(i));
+		Serial.print(pachube.getValueCharsByIndex(i));
 		Serial.println();
 	}
 }
@@ -70,7 +70,7 @@ void CFastSPI_LED2::clear(boolean includeLedData) {
 	if(includeLedData) { 
 		for(int i = 0; i < m_nControllers; i++) { 
 			if(m_Controllers[i].pLedData != NULL) { 
-				memset8((void*)m_Controllers[i].pLedData, 0, sizeof(struct CRGB) * m_Controllers[i].nLeds);
+				memset8((void*)m_Controllers[i].pLedData, 0, sizeof(struct CRGB) * m_Controllers[i].nLeds * m_Controllers[i].pLedController->strips());
 			} else {
 				return;
 			}
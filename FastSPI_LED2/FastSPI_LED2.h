@@ -122,6 +122,24 @@ public:
 		}
 	}
 
+	/// Drive NUM_STRIPS strips in parallel, on pins FIRST_PIN .. FIRST_PIN + NUM_STRIPS - 1 (all on the same port).  data holds
+	/// NUM_STRIPS blocks of leds back to back, and the led count is per strip.
+	template<EClocklessChipsets CHIPSET, uint8_t FIRST_PIN, uint8_t NUM_STRIPS, EOrder RGB_ORDER> 
+	CLEDController *addLeds(const struct CRGB *data, int nLedsOrOffset, int nLedsIfOffset = 0) {
+		switch(CHIPSET) { 
+			case TM1804:
+			case TM1809: return addLeds(new TM1809ParallelController800Khz<FIRST_PIN, NUM_STRIPS, RGB_ORDER>(), data, nLedsOrOffset, nLedsIfOffset);
+			case TM1803: return addLeds(new TM1803ParallelController400Khz<FIRST_PIN, NUM_STRIPS, RGB_ORDER>(), data, nLedsOrOffset, nLedsIfOffset);
+			case UCS1903: return addLeds(new UCS1903ParallelController400Khz<FIRST_PIN, NUM_STRIPS, RGB_ORDER>(), data, nLedsOrOffset, nLedsIfOffset);
+			case WS2812: 
+			case WS2812B:
+			case NEOPIXEL:
+			case WS2811: return addLeds(new WS2811ParallelController800Khz<FIRST_PIN, NUM_STRIPS, RGB_ORDER>(), data, nLedsOrOffset, nLedsIfOffset);
+			case WS2811_400: return addLeds(new WS2811ParallelController400Khz<FIRST_PIN, NUM_STRIPS, RGB_ORDER>(), data, nLedsOrOffset, nLedsIfOffset);
+			default: return NULL;
+		}
+	}
+
 	void setBrightness(uint8_t scale) { m_nScale = scale; }
 	uint8_t getBrightness() { return m_nScale; }
 
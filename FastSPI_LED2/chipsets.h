@@ -259,4 +259,25 @@ class TM1803Controller400Khz : public ClocklessController<DATA_PIN, NS(750), NS(
 #warning "No enough clock cycles available for the UCS103"
 #endif
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Parallel clockless template instantiations - NUM_STRIPS strips on consecutive pins starting at FIRST_PIN, same timings as above
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint8_t FIRST_PIN, uint8_t NUM_STRIPS, EOrder RGB_ORDER = RGB>
+class UCS1903ParallelController400Khz : public ClocklessParallelController<FIRST_PIN, NUM_STRIPS, NS(500), NS(1500), NS(500), RGB_ORDER> {};
+
+template <uint8_t FIRST_PIN, uint8_t NUM_STRIPS, EOrder RGB_ORDER = RGB>
+class TM1809ParallelController800Khz : public ClocklessParallelController<FIRST_PIN, NUM_STRIPS, NS(350), NS(350), NS(550), RGB_ORDER> {};
+
+template <uint8_t FIRST_PIN, uint8_t NUM_STRIPS, EOrder RGB_ORDER = RGB>
+class WS2811ParallelController800Khz : public ClocklessParallelController<FIRST_PIN, NUM_STRIPS, NS(400), NS(400), NS(450), RGB_ORDER> {};
+
+template <uint8_t FIRST_PIN, uint8_t NUM_STRIPS, EOrder RGB_ORDER = RGB>
+class WS2811ParallelController400Khz : public ClocklessParallelController<FIRST_PIN, NUM_STRIPS, NS(800), NS(800), NS(900), RGB_ORDER> {};
+
+template <uint8_t FIRST_PIN, uint8_t NUM_STRIPS, EOrder RGB_ORDER = RGB>
+class TM1803ParallelController400Khz : public ClocklessParallelController<FIRST_PIN, NUM_STRIPS, NS(750), NS(750), NS(750), RGB_ORDER> {};
+
 #endif
@@ -315,4 +315,178 @@ public:
 #endif
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Parallel clockless controller.  Drives NUM_STRIPS strips (up to 8, or up to 32 on ARM) at once, one per consecutive pin starting
+// at FIRST_PIN.  All of those pins must live on the same port (e.g. pins 0-7 on PORTD of an uno, 22-29 on PORTA of a mega), since
+// every bit is written to all of the strips with a single port store.  The led data passed to show is NUM_STRIPS blocks of nLeds
+// CRGB values back to back - strip 0 first.
+//
+// The led data is transposed ahead of time into bit-planes - one port value per bit of the output stream, with the bits for strips
+// that should see a 1 set - so that the timing critical loop is nothing but a load and three port writes per bit.  That costs
+// nLeds * 24 port values of ram, allocated once on the first show, but means writing out eight strips takes the same time as writing
+// out one.  If the plane buffer can't be allocated (likely on a 2k avr), that's remembered, and the port values are built from the
+// led data as they're written instead.  That stretches the low part of each bit by the time taken to build the next one, which the
+// chipsets don't mind, and never leaves a gap anywhere near as long as a latch.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Only defined for two identical port types, so naming a parallel pin that's on a different port from FIRST_PIN fails to compile.
+// Pins without compile time port info (the generic FastPin) can't be checked.
+template<typename A, typename B> struct _ParallelSamePort;
+template<typename A> struct _ParallelSamePort<A, A> {};
+
+template<uint8_t FIRST_PIN, uint8_t PIN, int N, typename T> struct _ParallelPins {
+	static void init(T *masks) {
+		(void)sizeof(_ParallelSamePort<typename FastPin<FIRST_PIN>::port_reg_t, typename FastPin<PIN>::port_reg_t>);
+		FastPin<PIN>::setOutput();
+		masks[0] = FastPin<PIN>::mask();
+		_ParallelPins<FIRST_PIN, PIN + 1, N - 1, T>::init(masks + 1);
+	}
+};
+
+template<uint8_t FIRST_PIN, uint8_t PIN, typename T> struct _ParallelPins<FIRST_PIN, PIN, 0, T> {
+	static void init(T *masks) {}
+};
+
+template <uint8_t FIRST_PIN, uint8_t NUM_STRIPS, int T1, int T2, int T3, EOrder RGB_ORDER = RGB, int WAIT_TIME = 50>
+class ClocklessParallelController : public CLEDController {
+	typedef typename FastPin<FIRST_PIN>::port_ptr_t data_ptr_t;
+	typedef typename FastPin<FIRST_PIN>::port_t data_t;
+
+	data_t mMasks[NUM_STRIPS];
+	data_t mPinMask;
+	data_t *mPlanes;
+	int mPlaneLeds;				// leds mPlanes has room for, -1 once allocating it has failed
+	CMinWait<WAIT_TIME> mWait;
+
+	// The port value for one bit of the output, with lo (the port with all of our pins low) or'd in
+	inline data_t portBits(register const uint8_t *v, register uint8_t bit, register data_t lo) __attribute__ ((always_inline)) {
+		register data_t p = lo;
+		for(uint8_t s = 0; s < NUM_STRIPS; s++) {
+			if(v[s] & bit) { p |= mMasks[s]; }
+		}
+		return p;
+	}
+
+	// Fetch the scaled color byte at ofs for each strip.  ADVANCE false means every strip shows the same color from rgbdata.
+	template<bool ADVANCE> __attribute__ ((always_inline)) inline void loadBytes(register uint8_t *v, register const byte *rgbdata, int stride, uint8_t ofs, uint8_t scale) {
+		for(uint8_t s = 0; s < NUM_STRIPS; s++) {
+			v[s] = scale8(rgbdata[(ADVANCE ? (s * stride) : 0) + ofs], scale);
+		}
+	}
+
+	// Build the 24 port values for one led row
+	void transposeRow(register data_t *out, register const byte *rgbdata, int stride, uint8_t scale, data_t lo) {
+		uint8_t v[NUM_STRIPS];
+		for(uint8_t c = 0; c < 3; c++) {
+			loadBytes<true>(v, rgbdata, stride, (c == 0) ? RGB_BYTE0(RGB_ORDER) : ((c == 1) ? RGB_BYTE1(RGB_ORDER) : RGB_BYTE2(RGB_ORDER)), scale);
+			for(uint8_t bit = 0x80; bit; bit >>= 1) {
+				*out++ = portBits(v, bit, lo);
+			}
+		}
+	}
+
+	// Clock out one bit.  Same three control points as ClocklessController: all lines hi, then drop the lines sending a zero, then
+	// drop the rest.
+	static inline void writeBit(register data_ptr_t port, register data_t hi, register data_t lo, register data_t b) __attribute__ ((always_inline)) {
+		FastPin<FIRST_PIN>::fastset(port, hi);
+		delaycycles<T1 - _CYCLES(FIRST_PIN)>();					// 1st cycle length minus out
+		FastPin<FIRST_PIN>::fastset(port, b);
+		delaycycles<T2 - _CYCLES(FIRST_PIN)>();					// 2nd cycle length minus out
+		FastPin<FIRST_PIN>::fastset(port, lo);
+		delaycycles<T3 - (_CYCLES(FIRST_PIN) + 6)>();				// 3rd cycle length minus out, 2 clocks for the load, 4 for compare and loop
+	}
+
+	static void writePlanes(register data_ptr_t port, register data_t hi, register data_t lo, register const data_t *planes, register const data_t *end) {
+		while(planes != end) {
+			writeBit(port, hi, lo, *planes++);
+		}
+	}
+
+	void adjustTimer(int nLeds) {
+		long microsTaken = CLKS_TO_MICROS(nLeds * 24 * (T1 + T2 + T3));
+		MS_COUNTER += (microsTaken / 1000);
+	}
+
+	// Write straight from the led data, building each port value while the lines are low
+	template<bool ADVANCE> void showRows(const byte *rgbdata, int nLeds, uint8_t scale) {
+		uint8_t v[NUM_STRIPS];
+		register data_ptr_t port = FastPin<FIRST_PIN>::port();
+		data_t lo = *port & ~mPinMask;
+		data_t hi = lo | mPinMask;
+		int stride = nLeds * 3;
+		mWait.wait();
+		cli();
+		for(int i = 0; i < nLeds; i++) {
+			for(uint8_t c = 0; c < 3; c++) {
+				loadBytes<ADVANCE>(v, rgbdata, stride, (c == 0) ? RGB_BYTE0(RGB_ORDER) : ((c == 1) ? RGB_BYTE1(RGB_ORDER) : RGB_BYTE2(RGB_ORDER)), scale);
+				for(uint8_t bit = 0x80; bit; bit >>= 1) {
+					writeBit(port, hi, lo, portBits(v, bit, lo));
+				}
+			}
+			if(ADVANCE) { rgbdata += 3; }
+		}
+		*port = lo;
+		adjustTimer(nLeds);
+		sei();
+		mWait.mark();
+	}
+
+public:
+	ClocklessParallelController() : mPlanes(NULL), mPlaneLeds(0) {}
+
+	virtual void init() {
+		_ParallelPins<FIRST_PIN, FIRST_PIN, NUM_STRIPS, data_t>::init(mMasks);
+		mPinMask = 0;
+		for(uint8_t s = 0; s < NUM_STRIPS; s++) { mPinMask |= mMasks[s]; }
+	}
+
+	virtual int strips() { return NUM_STRIPS; }
+
+	virtual void clearLeds(int nLeds) {
+		showColor(CRGB(0, 0, 0), nLeds, 0);
+	}
+
+	// set all the leds on all the strips to a given color
+	virtual void showColor(const struct CRGB & data, int nLeds, uint8_t scale = 255) {
+		showRows<false>((const byte*)&data, nLeds, scale);
+	}
+
+	virtual void show(const struct CRGB *rgbdata, int nLeds, uint8_t scale = 255) {
+		// Only ever try to allocate once - the led count doesn't change, and retrying a failed malloc every frame just fragments the heap
+		if(mPlaneLeds == 0) {
+			mPlanes = (data_t*)malloc(nLeds * 24 * sizeof(data_t));
+			mPlaneLeds = mPlanes ? nLeds : -1;
+		}
+		if(nLeds > mPlaneLeds) {
+			showRows<true>((const byte*)rgbdata, nLeds, scale);
+			return;
+		}
+
+		// Transpose with interrupts still enabled - only the write out needs to be cli'd
+		register data_ptr_t port = FastPin<FIRST_PIN>::port();
+		data_t lo = *port & ~mPinMask;
+		data_t hi = lo | mPinMask;
+		const byte *data = (const byte*)rgbdata;
+		for(int i = 0; i < nLeds; i++) {
+			transposeRow(mPlanes + (i * 24), data + (i * 3), nLeds * 3, scale, lo);
+		}
+
+		mWait.wait();
+		cli();
+		writePlanes(port, hi, lo, mPlanes, mPlanes + (nLeds * 24));
+		*port = lo;
+		adjustTimer(nLeds);
+		sei();
+		mWait.mark();
+	}
+
+#ifdef SUPPORT_ARGB
+	virtual void show(const struct CARGB *rgbdata, int nLeds, uint8_t scale = 255) {
+		// TODO: IMPLEMENTME
+	}
+#endif
+};
+
 #endif
\ No newline at end of file
@@ -45,6 +45,9 @@ public:
 	virtual void show(const struct CARGB *data, int nLeds, uint8_t scale = 255) = 0;
 #endif
 	
+	// number of strips the controller drives - show reads this many blocks of nLeds leds from its data pointer
+	virtual int strips() { return 1; }
+
 	// is the controller ready to write data out
 	virtual bool ready() { return true; }
 
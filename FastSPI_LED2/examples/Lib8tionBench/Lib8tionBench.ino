@@ -0,0 +1,77 @@
+#include "FastSPI_LED2.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Times the lib8tion array functions and batched hsv2rgb against calling the per-pixel
+// versions in a loop.  No leds need to be attached - open the serial monitor at 9600 baud.
+// On AVR the two should be about even (the array versions save a little loop overhead); on
+// 32-bit ARM the array versions work on several bytes at a time.
+//
+
+// Three arrays of NUM_LEDS take 9 bytes per led, so use fewer on 2k avrs like the uno
+#if defined(__AVR__) && (RAMEND < 0x1000)
+#define NUM_LEDS 100
+#else
+#define NUM_LEDS 300
+#endif
+#define RUNS 20
+
+CRGB leds[NUM_LEDS];
+CRGB overlay[NUM_LEDS];
+CHSV hsvs[NUM_LEDS];
+
+void report(const char *name, unsigned long loopMicros, unsigned long arrayMicros) {
+	Serial.print(name);
+	Serial.print(": loop ");
+	Serial.print(loopMicros / RUNS);
+	Serial.print("us, array ");
+	Serial.print(arrayMicros / RUNS);
+	Serial.println("us");
+}
+
+void setup() {
+	Serial.begin(9600);
+	for(int i = 0; i < NUM_LEDS; i++) {
+		hsvs[i] = CHSV(random8(), random8(), random8());
+		overlay[i] = CRGB(random8(), random8(), random8());
+	}
+}
+
+void loop() {
+	uint8_t *p = (uint8_t*)leds;
+	const uint8_t *q = (const uint8_t*)overlay;
+	unsigned long start, loopTime, arrayTime;
+
+	fill_rainbow(leds, NUM_LEDS, 0, 3);
+	start = micros();
+	for(int r = 0; r < RUNS; r++) {
+		for(int i = 0; i < NUM_LEDS * 3; i++) { p[i] = scale8(p[i], 250); }
+	}
+	loopTime = micros() - start;
+	start = micros();
+	for(int r = 0; r < RUNS; r++) { nscale8_array(p, NUM_LEDS * 3, 250); }
+	arrayTime = micros() - start;
+	report("nscale8", loopTime, arrayTime);
+
+	start = micros();
+	for(int r = 0; r < RUNS; r++) {
+		for(int i = 0; i < NUM_LEDS * 3; i++) { p[i] = qadd8(p[i], q[i]); }
+	}
+	loopTime = micros() - start;
+	start = micros();
+	for(int r = 0; r < RUNS; r++) { qadd8_array(p, q, NUM_LEDS * 3); }
+	arrayTime = micros() - start;
+	report("qadd8", loopTime, arrayTime);
+
+	start = micros();
+	for(int r = 0; r < RUNS; r++) {
+		for(int i = 0; i < NUM_LEDS; i++) { hsv2rgb_rainbow(hsvs[i], leds[i]); }
+	}
+	loopTime = micros() - start;
+	start = micros();
+	for(int r = 0; r < RUNS; r++) { hsv2rgb_rainbow(hsvs, leds, NUM_LEDS); }
+	arrayTime = micros() - start;
+	report("hsv2rgb_rainbow", loopTime, arrayTime);
+
+	delay(5000);
+}
@@ -0,0 +1,44 @@
+#include "FastSPI_LED2.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Drive eight strips at once from a single port.  Each strip gets its own block of leds in
+// the array, and a dot chases down all of them together.  Writing out all eight strips takes
+// the same time as writing out one.
+//
+
+// How many leds are in each strip?
+#define NUM_LEDS_PER_STRIP 30
+
+// How many strips?  Up to 8 on an avr.
+#define NUM_STRIPS 8
+
+// First data pin - strip N is on FIRST_PIN + N, and all of them must be on the same port.
+// Pins 22-29 are PORTA on a mega; on an uno pins 0-7 are PORTD (but 0 and 1 are serial too).
+#define FIRST_PIN 22
+
+// Strip 0 is leds[0 .. NUM_LEDS_PER_STRIP-1], strip 1 follows it, and so on.
+CRGB leds[NUM_STRIPS * NUM_LEDS_PER_STRIP];
+
+void setup() {
+	// sanity check delay - allows reprogramming if accidently blowing power w/leds
+   	delay(2000);
+
+	// Note the led count is per strip
+	FastLED.addLeds<WS2811, FIRST_PIN, NUM_STRIPS, GRB>(leds, NUM_LEDS_PER_STRIP);
+}
+
+void loop() {
+	for(int i = 0; i < NUM_LEDS_PER_STRIP; i++) {
+		for(int s = 0; s < NUM_STRIPS; s++) {
+			leds[(s * NUM_LEDS_PER_STRIP) + i] = CRGB(0, 0, 64);
+		}
+
+		FastLED.show();
+
+		for(int s = 0; s < NUM_STRIPS; s++) {
+			leds[(s * NUM_LEDS_PER_STRIP) + i] = CRGB::Black;
+		}
+		delay(50);
+	}
+}
@@ -117,6 +117,7 @@ template<uint8_t PIN> class FastPin {
 public:
 	typedef volatile uint8_t * port_ptr_t;
 	typedef uint8_t port_t;
+	typedef void port_reg_t;		// port isn't known until runtime
 
 	inline static void setOutput() { _init(); pinMode(PIN, OUTPUT); }
 	inline static void setInput() { _init(); pinMode(PIN, INPUT); }
@@ -147,6 +148,7 @@ template<uint8_t PIN, uint8_t _MASK, typename _PORT, typename _DDR, typename _PI
 public:
 	typedef volatile uint8_t * port_ptr_t;
 	typedef uint8_t port_t;
+	typedef _PORT port_reg_t;			// identifies the port at compile time, see ClocklessParallelController
 	 
 	inline static void setOutput() { _DDR::r() |= _MASK; }
 	inline static void setInput() { _DDR::r() &= ~_MASK; }
@@ -174,6 +176,7 @@ template<uint8_t PIN, uint32_t _MASK, typename _PDOR, typename _PSOR, typename _
 public:
 	typedef volatile uint32_t * port_ptr_t;
 	typedef uint32_t port_t;
+	typedef _PDOR port_reg_t;
 
 	inline static void setOutput() { pinMode(PIN, OUTPUT); } // TODO: perform MUX config { _PDDR::r() |= _MASK; }
 	inline static void setInput() { pinMode(PIN, INPUT); } // TODO: preform MUX config { _PDDR::r() &= ~_MASK; }
@@ -202,6 +205,7 @@ template<uint8_t PIN, int _BIT, typename _PDOR, typename _PSOR, typename _PCOR,
 public:
 	typedef volatile uint32_t * port_ptr_t;
 	typedef uint32_t port_t;
+	typedef _PDOR port_reg_t;
 
 	inline static void setOutput() { pinMode(PIN, OUTPUT); } // TODO: perform MUX config { _PDDR::r() |= _MASK; }
 	inline static void setInput() { pinMode(PIN, INPUT); } // TODO: preform MUX config { _PDDR::r() &= ~_MASK; }
@@ -272,6 +272,35 @@ void hsv2rgb_spectrum( const CHSV& hsv, CRGB& rgb)
 #define K171 171
 #define K85  85
 
+// The part of hsv2rgb_rainbow after the hue has been turned into
+// fully saturated, full brightness r, g, b.  Shared with the batched
+// conversion below, which gets that starting point from a table.
+static inline __attribute__((always_inline))
+void rainbow_sat_val( uint8_t& r, uint8_t& g, uint8_t& b, uint8_t sat, uint8_t val)
+{
+    // Scale down colors if we're desaturated at all
+    // and add the brightness_floor to r, g, and b.
+    if( sat != 255 ) {
+
+        nscale8x3_video( r, g, b, sat);
+
+        uint8_t desat = 255 - sat;
+        desat = scale8( desat, desat);
+        
+        uint8_t brightness_floor = desat;
+        r += brightness_floor;
+        g += brightness_floor;
+        b += brightness_floor;
+    }
+
+    // Now scale everything down if we're at value < 255.
+    if( val != 255 ) {
+        
+        val = scale8_video_LEAVING_R1_DIRTY( val, val);
+        nscale8x3_video( r, g, b, val);
+    }
+}
+
 void hsv2rgb_rainbow( const CHSV& hsv, CRGB& rgb)
 {
     // Yellow has a higher inherent brightness than
@@ -420,27 +449,7 @@ void hsv2rgb_rainbow( const CHSV& hsv, CRGB& rgb)
     if( G2 ) g = g >> 1;
     if( Gscale ) g = scale8_video_LEAVING_R1_DIRTY( g, Gscale);
     
-    // Scale down colors if we're desaturated at all
-    // and add the brightness_floor to r, g, and b.
-    if( sat != 255 ) {
-
-        nscale8x3_video( r, g, b, sat);
-
-        uint8_t desat = 255 - sat;
-        desat = scale8( desat, desat);
-        
-        uint8_t brightness_floor = desat;
-        r += brightness_floor;
-        g += brightness_floor;
-        b += brightness_floor;
-    }
-
-    // Now scale everything down if we're at value < 255.
-    if( val != 255 ) {
-        
-        val = scale8_video_LEAVING_R1_DIRTY( val, val);
-        nscale8x3_video( r, g, b, val);
-    }
+    rainbow_sat_val( r, g, b, sat, val);
     
     // Here we have the old AVR "missing std X+n" problem again
     // It turns out that fixing it winds up costing more than
@@ -460,10 +469,50 @@ void hsv2rgb_raw(const struct CHSV * phsv, struct CRGB * prgb, int numLeds) {
     }
 }
 
+// On everything but AVR, the batched rainbow conversions look the hue
+// up in a table of fully saturated, full brightness colors (built on
+// first use, 768 bytes of RAM) and only do the saturation and value
+// math per pixel.  That skips the hue decision tree and its poorly
+// predicted branches, and gives exactly the same results.  On AVR the
+// RAM is worth more than the cycles.
+#if !defined(__AVR__)
+#define RAINBOW_TABLE 1
+
+static CRGB rainbow_table[256];
+static bool rainbow_table_built = false;
+
+static const CRGB * get_rainbow_table()
+{
+    if( !rainbow_table_built) {
+        CHSV hsv;
+        hsv.sat = 255;
+        hsv.val = 255;
+        for( int hue = 0; hue < 256; hue++) {
+            hsv.hue = hue;
+            hsv2rgb_rainbow( hsv, rainbow_table[hue]);
+        }
+        rainbow_table_built = true;
+    }
+    return rainbow_table;
+}
+#endif
+
 void hsv2rgb_rainbow( const struct CHSV* phsv, struct CRGB * prgb, int numLeds) {
+#if RAINBOW_TABLE == 1
+    const CRGB * table = get_rainbow_table();
+    for(int i = 0; i < numLeds; i++) {
+        const CRGB & c = table[phsv[i].hue];
+        uint8_t r = c.r, g = c.g, b = c.b;
+        rainbow_sat_val( r, g, b, phsv[i].sat, phsv[i].val);
+        prgb[i].r = r;
+        prgb[i].g = g;
+        prgb[i].b = b;
+    }
+#else
     for(int i = 0; i < numLeds; i++) {
         hsv2rgb_rainbow(phsv[i], prgb[i]);
     }
+#endif
 }
 
 void hsv2rgb_spectrum( const struct CHSV* phsv, struct CRGB * prgb, int numLeds) {
@@ -484,6 +533,14 @@ void fill_rainbow( struct CRGB * pFirstLED, int numToFill,
                   uint8_t initialhue,
                   uint8_t deltahue )
 {
+#if RAINBOW_TABLE == 1
+    const CRGB * table = get_rainbow_table();
+    uint8_t hue = initialhue;
+    for( int i = 0; i < numToFill; i++) {
+        pFirstLED[i] = table[hue];
+        hue += deltahue;
+    }
+#else
     CHSV hsv;
     hsv.hue = initialhue;
     hsv.val = 255;
@@ -492,4 +549,5 @@ void fill_rainbow( struct CRGB * pFirstLED, int numToFill,
         hsv2rgb_rainbow( hsv, pFirstLED[i]);
         hsv.hue += deltahue;
     }
+#endif
 }
@@ -1,4 +1,7 @@
 #include <stdint.h>
+#include <string.h>
+
+#include "lib8tion.h"
 
 #define RAND16_SEED  1337
 uint16_t rand16seed = RAND16_SEED;
@@ -52,7 +55,7 @@ void * memset8 ( void * ptr, uint8_t val, uint16_t num )
 
 
 //__attribute__ ((noinline))
-void * memcpy8 ( void * dst, void* src, uint16_t num )
+void * memcpy8 ( void * dst, const void* src, uint16_t num )
 {
     asm volatile(
          "  movw r30, %[src]        \n\t"
@@ -80,7 +83,7 @@ void * memcpy8 ( void * dst, void* src, uint16_t num )
 }
 
 //__attribute__ ((noinline))
-void * memmove8 ( void * dst, void* src, uint16_t num )
+void * memmove8 ( void * dst, const void* src, uint16_t num )
 {
     if( src < dst) {
         // if src < dst then we can use the forward-stepping memcpy8
@@ -88,7 +91,7 @@ void * memmove8 ( void * dst, void* src, uint16_t num )
     } else {
         // if src > dst then we have to step backward:
         dst = (char*)dst + num;
-        src = (char*)src + num;
+        src = (const char*)src + num;
         asm volatile(
              "  movw r30, %[src]        \n\t"
              "  movw r26, %[dst]        \n\t"
@@ -120,6 +123,224 @@ void * memmove8 ( void * dst, void* src, uint16_t num )
 
 #endif /* AVR */
 
+
+// Array versions of nscale8, nscale8_video, qadd8 and qsub8.
+//
+// On AVR these are just tight loops around the single-byte asm,
+// leaving R1 dirty until the end.  Elsewhere they work on several
+// bytes per step, then finish any leftovers a byte at a time:
+//  - 16 bytes with SSE2 or NEON, for host builds (e.g. previews)
+//  - 4 bytes with the Cortex-M4 DSP 'uqadd8' / 'uqsub8' on teensy 3
+//  - 4 bytes with plain 32-bit arithmetic ('SWAR') everywhere else.
+//    The scaling splits a word into two pairs of 16-bit lanes; since
+//    255 * 255 still fits in 16 bits, one 32-bit multiply scales two
+//    bytes without the lanes interfering.
+
+#if !defined(__AVR__)
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define LIB8_ARRAY_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define LIB8_ARRAY_NEON 1
+#endif
+
+#define LIB8_LO7 0x7F7F7F7FUL
+#define LIB8_HI1 0x80808080UL
+
+// memcpy to and from a local compiles down to a single (unaligned) load
+// or store, without upsetting strict aliasing
+static inline uint32_t load32( const uint8_t * p)
+{
+    uint32_t v;
+    memcpy( &v, p, 4);
+    return v;
+}
+
+static inline void store32( uint8_t * p, uint32_t v)
+{
+    memcpy( p, &v, 4);
+}
+
+static inline uint32_t scale8x4( uint32_t v, fract8 scale)
+{
+    uint32_t lo = (((v & 0x00FF00FFUL) * scale) >> 8) & 0x00FF00FFUL;
+    uint32_t hi = (((v >> 8) & 0x00FF00FFUL) * scale) & 0xFF00FF00UL;
+    return lo | hi;
+}
+
+// 0x01 in each byte of v that is non-zero
+static inline uint32_t nonzero8x4( uint32_t v)
+{
+    return ((((v & LIB8_LO7) + LIB8_LO7) | v) >> 7) & 0x01010101UL;
+}
+
+static inline uint32_t qadd8x4( uint32_t a, uint32_t b)
+{
+#if QADD8_ARM_DSP_ASM == 1
+    asm volatile( "uqadd8 %0, %0, %1" : "+r" (a) : "r" (b));
+    return a;
+#else
+    uint32_t sum = ((a & LIB8_LO7) + (b & LIB8_LO7)) ^ ((a ^ b) & LIB8_HI1);
+    uint32_t carry = ((a & b) | ((a | b) & ~sum)) & LIB8_HI1;
+    return sum | ((carry >> 7) * 0xFF);
+#endif
+}
+
+static inline uint32_t qsub8x4( uint32_t a, uint32_t b)
+{
+#if QADD8_ARM_DSP_ASM == 1
+    asm volatile( "uqsub8 %0, %0, %1" : "+r" (a) : "r" (b));
+    return a;
+#else
+    uint32_t diff = ((a | LIB8_HI1) - (b & LIB8_LO7)) ^ ((a ^ ~b) & LIB8_HI1);
+    uint32_t borrow = ((~a & b) | ((~a | b) & diff)) & LIB8_HI1;
+    return diff & ~((borrow >> 7) * 0xFF);
+#endif
+}
+
+#endif /* !AVR */
+
+void nscale8_array( uint8_t * p, uint16_t count, fract8 scale)
+{
+#if defined(__AVR__)
+    while( count--) {
+        nscale8_LEAVING_R1_DIRTY( *p, scale);
+        p++;
+    }
+    cleanup_R1();
+#else
+#if LIB8_ARRAY_SSE2 == 1
+    __m128i zero = _mm_setzero_si128();
+    __m128i sc = _mm_set1_epi16( scale);
+    for( ; count >= 16; count -= 16, p += 16) {
+        __m128i v = _mm_loadu_si128( (const __m128i*)p);
+        __m128i lo = _mm_srli_epi16( _mm_mullo_epi16( _mm_unpacklo_epi8( v, zero), sc), 8);
+        __m128i hi = _mm_srli_epi16( _mm_mullo_epi16( _mm_unpackhi_epi8( v, zero), sc), 8);
+        _mm_storeu_si128( (__m128i*)p, _mm_packus_epi16( lo, hi));
+    }
+#elif LIB8_ARRAY_NEON == 1
+    uint8x8_t sc = vdup_n_u8( scale);
+    for( ; count >= 16; count -= 16, p += 16) {
+        uint8x16_t v = vld1q_u8( p);
+        uint8x8_t lo = vshrn_n_u16( vmull_u8( vget_low_u8( v), sc), 8);
+        uint8x8_t hi = vshrn_n_u16( vmull_u8( vget_high_u8( v), sc), 8);
+        vst1q_u8( p, vcombine_u8( lo, hi));
+    }
+#endif
+    for( ; count >= 4; count -= 4, p += 4) {
+        store32( p, scale8x4( load32( p), scale));
+    }
+    while( count--) {
+        *p = scale8( *p, scale);
+        p++;
+    }
+#endif
+}
+
+void nscale8_video_array( uint8_t * p, uint16_t count, fract8 scale)
+{
+#if defined(__AVR__)
+    while( count--) {
+        *p = scale8_video_LEAVING_R1_DIRTY( *p, scale);
+        p++;
+    }
+    cleanup_R1();
+#else
+    uint8_t nonzeroscale = (scale != 0) ? 1 : 0;
+#if LIB8_ARRAY_SSE2 == 1
+    __m128i zero = _mm_setzero_si128();
+    __m128i sc = _mm_set1_epi16( scale);
+    __m128i nzs = _mm_set1_epi8( nonzeroscale);
+    for( ; count >= 16; count -= 16, p += 16) {
+        __m128i v = _mm_loadu_si128( (const __m128i*)p);
+        __m128i lo = _mm_srli_epi16( _mm_mullo_epi16( _mm_unpacklo_epi8( v, zero), sc), 8);
+        __m128i hi = _mm_srli_epi16( _mm_mullo_epi16( _mm_unpackhi_epi8( v, zero), sc), 8);
+        __m128i bump = _mm_andnot_si128( _mm_cmpeq_epi8( v, zero), nzs);
+        _mm_storeu_si128( (__m128i*)p, _mm_add_epi8( _mm_packus_epi16( lo, hi), bump));
+    }
+#elif LIB8_ARRAY_NEON == 1
+    uint8x8_t sc = vdup_n_u8( scale);
+    uint8x16_t nzs = vdupq_n_u8( nonzeroscale);
+    for( ; count >= 16; count -= 16, p += 16) {
+        uint8x16_t v = vld1q_u8( p);
+        uint8x8_t lo = vshrn_n_u16( vmull_u8( vget_low_u8( v), sc), 8);
+        uint8x8_t hi = vshrn_n_u16( vmull_u8( vget_high_u8( v), sc), 8);
+        uint8x16_t bump = vandq_u8( vtstq_u8( v, v), nzs);
+        vst1q_u8( p, vaddq_u8( vcombine_u8( lo, hi), bump));
+    }
+#endif
+    for( ; count >= 4; count -= 4, p += 4) {
+        uint32_t v = load32( p);
+        // scaled bytes are at most 254, so adding 1 can't carry
+        store32( p, scale8x4( v, scale) + (nonzeroscale ? nonzero8x4( v) : 0));
+    }
+    while( count--) {
+        *p = scale8_video( *p, scale);
+        p++;
+    }
+#endif
+}
+
+void qadd8_array( uint8_t * dst, const uint8_t * src, uint16_t count)
+{
+#if defined(__AVR__)
+    while( count--) {
+        *dst = qadd8( *dst, *src++);
+        dst++;
+    }
+#else
+#if LIB8_ARRAY_SSE2 == 1
+    for( ; count >= 16; count -= 16, dst += 16, src += 16) {
+        __m128i a = _mm_loadu_si128( (const __m128i*)dst);
+        __m128i b = _mm_loadu_si128( (const __m128i*)src);
+        _mm_storeu_si128( (__m128i*)dst, _mm_adds_epu8( a, b));
+    }
+#elif LIB8_ARRAY_NEON == 1
+    for( ; count >= 16; count -= 16, dst += 16, src += 16) {
+        vst1q_u8( dst, vqaddq_u8( vld1q_u8( dst), vld1q_u8( src)));
+    }
+#endif
+    for( ; count >= 4; count -= 4, dst += 4, src += 4) {
+        store32( dst, qadd8x4( load32( dst), load32( src)));
+    }
+    while( count--) {
+        *dst = qadd8( *dst, *src++);
+        dst++;
+    }
+#endif
+}
+
+void qsub8_array( uint8_t * dst, const uint8_t * src, uint16_t count)
+{
+#if defined(__AVR__)
+    while( count--) {
+        *dst = qsub8( *dst, *src++);
+        dst++;
+    }
+#else
+#if LIB8_ARRAY_SSE2 == 1
+    for( ; count >= 16; count -= 16, dst += 16, src += 16) {
+        __m128i a = _mm_loadu_si128( (const __m128i*)dst);
+        __m128i b = _mm_loadu_si128( (const __m128i*)src);
+        _mm_storeu_si128( (__m128i*)dst, _mm_subs_epu8( a, b));
+    }
+#elif LIB8_ARRAY_NEON == 1
+    for( ; count >= 16; count -= 16, dst += 16, src += 16) {
+        vst1q_u8( dst, vqsubq_u8( vld1q_u8( dst), vld1q_u8( src)));
+    }
+#endif
+    for( ; count >= 4; count -= 4, dst += 4, src += 4) {
+        store32( dst, qsub8x4( load32( dst), load32( src)));
+    }
+    while( count--) {
+        *dst = qsub8( *dst, *src++);
+        dst++;
+    }
+#endif
+}
+
 #if 0
 // TEST / VERIFICATION CODE ONLY BELOW THIS POINT
 #include <Arduino.h>
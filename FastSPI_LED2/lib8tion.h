@@ -109,6 +109,15 @@
      lerp16by16( fromU16, toU16, fract16 )
        == from + (( to - from ) * fract16) / 65536)
  
+ - Array versions of the scaling and saturating math,
+   for fading or blending whole buffers of LED data at
+   once.  On 32-bit ARM and host builds these process
+   4 or 16 bytes per step.
+      nscale8_array( p, n, sc)       == p[i] = scale8( p[i], sc)
+      nscale8_video_array( p, n, sc) == p[i] = scale8_video( p[i], sc)
+      qadd8_array( dst, src, n)      == dst[i] = qadd8( dst[i], src[i])
+      qsub8_array( dst, src, n)      == dst[i] = qsub8( dst[i], src[i])
+
  - Optimized memmove, memcpy, and memset, that are
    faster than standard avr-libc 1.8.
       memmove8( dest, src,  bytecount)
@@ -220,6 +229,7 @@ Lib8tion is pronounced like 'libation': lie-BAY-shun
 #define SCALE16_C 1
 #define ABS8_C 1
 #define MUL8_C 1
+#define QMUL8_C 1
 #define ADD8_C 1
 #define SUB8_C 1
 #define EASE8_C 1
@@ -1085,6 +1095,19 @@ LIB8STATIC int16_t cos16( uint16_t theta)
 }
 
 
+///////////////////////////////////////////////////////////////////////
+//
+// nscale8_array, nscale8_video_array, qadd8_array, qsub8_array:
+//   the per-byte functions above applied across a whole buffer,
+//   e.g. nscale8_array( (uint8_t*)leds, NUM_LEDS * 3, 192) to fade.
+//   See lib8tion.cpp for the per-platform implementations.
+
+void nscale8_array( uint8_t * p, uint16_t count, fract8 scale);
+void nscale8_video_array( uint8_t * p, uint16_t count, fract8 scale);
+void qadd8_array( uint8_t * dst, const uint8_t * src, uint16_t count);
+void qsub8_array( uint8_t * dst, const uint8_t * src, uint16_t count);
+
+
 ///////////////////////////////////////////////////////////////////////
 //
 // memmove8, memcpy8, and memset8:
@@ -0,0 +1,603 @@
+// JSON and CSV formats for Xively, Cosm and Pachube feeds
+// Released under Apache License, version 2.0
+
+#include "FeedCodec.h"
+
+// FeedReader JSON states
+#define JSON_BETWEEN 0   // between tokens
+#define JSON_STRING  1
+#define JSON_ESCAPE  2   // after a backslash in a string
+#define JSON_UNICODE 3   // in the hex digits of a \u escape
+#define JSON_LITERAL 4   // in a number, true, false or null
+
+// The keys FeedReader looks for in JSON, and where their values go
+#define KEY_ID    1
+#define KEY_VALUE 2
+static const char kIdKey[] = "id";
+static const char kValueKey[] = "current_value";
+
+// Write aValue's digits into aBuffer, returning how many
+static int formatUnsigned(char* aBuffer, unsigned long aValue)
+{
+    char digits[10];
+    int n = 0;
+    do
+    {
+        digits[n++] = '0' + aValue % 10;
+        aValue /= 10;
+    } while (aValue);
+    for (int i = 0; i < n; i++)
+    {
+        aBuffer[i] = digits[n-1-i];
+    }
+    aBuffer[n] = '\0';
+    return n;
+}
+
+FeedWriter::FeedWriter(Print* aOut, int aFormat)
+  : _out(aOut), _format(aFormat), _first(true), _count(0)
+{
+}
+
+void FeedWriter::beginFeed()
+{
+    if (_format == FEED_JSON)
+    {
+        const char kStart[] = "{\"version\":\"1.0.0\",\"datastreams\":[";
+        write(kStart, sizeof(kStart)-1);
+    }
+    _first = true;
+}
+
+void FeedWriter::beginDatastream(const char* aId)
+{
+    if (_format == FEED_JSON)
+    {
+        if (!_first)
+        {
+            write(",", 1);
+        }
+        write("{\"id\":\"", 7);
+        writeEscaped(aId, strlen(aId));
+        const char kValue[] = "\",\"current_value\":\"";
+        write(kValue, sizeof(kValue)-1);
+    }
+    else
+    {
+        write(aId, strlen(aId));
+        write(",", 1);
+    }
+    _first = false;
+}
+
+void FeedWriter::beginDatastream(unsigned long aId)
+{
+    char id[11];
+    formatUnsigned(id, aId);
+    beginDatastream(id);
+}
+
+void FeedWriter::beginDatastream(const String& aId)
+{
+    if (_format == FEED_JSON)
+    {
+        if (!_first)
+        {
+            write(",", 1);
+        }
+        write("{\"id\":\"", 7);
+        writeEscaped(aId);
+        const char kValue[] = "\",\"current_value\":\"";
+        write(kValue, sizeof(kValue)-1);
+    }
+    else
+    {
+        writeEscaped(aId);
+        write(",", 1);
+    }
+    _first = false;
+}
+
+void FeedWriter::value(const char* aValue)
+{
+    writeEscaped(aValue, strlen(aValue));
+}
+
+void FeedWriter::value(const String& aValue)
+{
+    writeEscaped(aValue);
+}
+
+void FeedWriter::value(long aValue)
+{
+    char number[12];
+    write(number, format(number, aValue));
+}
+
+void FeedWriter::value(double aValue, int aDigits)
+{
+    char number[24];
+    if (aDigits > 10)
+    {
+        aDigits = 10;
+    }
+    write(number, format(number, aValue, aDigits));
+}
+
+void FeedWriter::endDatastream()
+{
+    if (_format == FEED_JSON)
+    {
+        write("\"}", 2);
+    }
+    else
+    {
+        write("\n", 1);
+    }
+}
+
+void FeedWriter::endFeed()
+{
+    if (_format == FEED_JSON)
+    {
+        write("]}", 2);
+    }
+}
+
+int FeedWriter::format(char* aBuffer, long aValue)
+{
+    if (aValue < 0)
+    {
+        aBuffer[0] = '-';
+        return 1 + formatUnsigned(aBuffer+1, -(unsigned long)aValue);
+    }
+    return formatUnsigned(aBuffer, aValue);
+}
+
+int FeedWriter::format(char* aBuffer, double aValue, int aDigits)
+{
+    int len = 0;
+    if (isnan(aValue))
+    {
+        strcpy(aBuffer, "nan");
+        return 3;
+    }
+    if (isinf(aValue))
+    {
+        strcpy(aBuffer, "inf");
+        return 3;
+    }
+    if ((aValue > 4294967040.0) || (aValue < -4294967040.0))
+    {
+        // Too big for the unsigned long the whole part goes in
+        strcpy(aBuffer, "ovf");
+        return 3;
+    }
+    if (aValue < 0.0)
+    {
+        aBuffer[len++] = '-';
+        aValue = -aValue;
+    }
+    // Round to the number of digits wanted
+    double rounding = 0.5;
+    for (int i = 0; i < aDigits; i++)
+    {
+        rounding /= 10.0;
+    }
+    aValue += rounding;
+
+    unsigned long whole = (unsigned long)aValue;
+    double remainder = aValue - (double)whole;
+    len += formatUnsigned(aBuffer+len, whole);
+    if (aDigits > 0)
+    {
+        aBuffer[len++] = '.';
+        while (aDigits-- > 0)
+        {
+            remainder *= 10.0;
+            int digit = (int)remainder;
+            aBuffer[len++] = '0' + digit;
+            remainder -= digit;
+        }
+    }
+    aBuffer[len] = '\0';
+    return len;
+}
+
+void FeedWriter::write(const char* aData, size_t aLength)
+{
+    if (_out)
+    {
+        _out->write((const uint8_t*)aData, aLength);
+    }
+    _count += aLength;
+}
+
+void FeedWriter::writeEscaped(const char* aData, size_t aLength)
+{
+    if (_format != FEED_JSON)
+    {
+        write(aData, aLength);
+        return;
+    }
+    // Write the characters that don't need escaping in runs, rather than
+    // one at a time
+    size_t start = 0;
+    for (size_t i = 0; i < aLength; i++)
+    {
+        char c = aData[i];
+        if ((c == '"') || (c == '\\') || ((uint8_t)c < ' '))
+        {
+            write(aData+start, i-start);
+            start = i+1;
+            char escape[2] = { '\\', c };
+            switch (c)
+            {
+            case '\n':
+                escape[1] = 'n';
+                break;
+            case '\r':
+                escape[1] = 'r';
+                break;
+            case '\t':
+                escape[1] = 't';
+                break;
+            case '"':
+            case '\\':
+                break;
+            default:
+                // Other control characters are just left out
+                continue;
+            };
+            write(escape, 2);
+        }
+    }
+    write(aData+start, aLength-start);
+}
+
+void FeedWriter::writeEscaped(const String& aString)
+{
+    // Copied out a few characters at a time, so it works with any version
+    // of String
+    char chunk[16];
+    unsigned int len = aString.length();
+    for (unsigned int i = 0; i < len; )
+    {
+        int n = 0;
+        while ((n < (int)sizeof(chunk)) && (i < len))
+        {
+            chunk[n++] = aString.charAt(i++);
+        }
+        writeEscaped(chunk, n);
+    }
+}
+
+FeedReader::FeedReader(int aFormat, char* aIdBuffer, int aIdSize, char* aValueBuffer, int aValueSize)
+  : _format(aFormat), _id(aIdBuffer), _idSize(aIdSize), _value(aValueBuffer), _valueSize(aValueSize)
+{
+    reset();
+}
+
+void FeedReader::reset()
+{
+    _idLength = 0;
+    _id[0] = '\0';
+    _valueLength = 0;
+    _value[0] = '\0';
+    _event = FEED_EVENT_NONE;
+    _field = 0;
+    _state = JSON_BETWEEN;
+    _depth = 0;
+    _key = 0;
+    _keyIndex = 0;
+    _target = 0;
+    _idDepth = 0;
+    _valueDepth = 0;
+}
+
+void FeedReader::setValueBuffer(char* aValueBuffer, int aValueSize)
+{
+    _value = aValueBuffer;
+    _valueSize = aValueSize;
+    _valueLength = 0;
+    _value[0] = '\0';
+}
+
+int FeedReader::parse(const char* aData, int aLength)
+{
+    _event = FEED_EVENT_NONE;
+    if (_format == FEED_CSV)
+    {
+        return parseCsv(aData, aLength);
+    }
+    return parseJson(aData, aLength);
+}
+
+int FeedReader::finish()
+{
+    _event = FEED_EVENT_NONE;
+    if ((_format == FEED_CSV) && (_field > 0))
+    {
+        // The last line didn't end with a newline
+        _value[_valueLength] = '\0';
+        _event = FEED_EVENT_DATASTREAM;
+    }
+    _field = 0;
+    _idLength = 0;
+    return _event;
+}
+
+void FeedReader::append(char* aBuffer, int aSize, int& aLength, char aChar)
+{
+    if (aLength < aSize-1)
+    {
+        aBuffer[aLength++] = aChar;
+        aBuffer[aLength] = '\0';
+    }
+}
+
+int FeedReader::parseCsv(const char* aData, int aLength)
+{
+    for (int i = 0; i < aLength; i++)
+    {
+        char c = aData[i];
+        if (c == '\n')
+        {
+            bool complete = (_field > 0);
+            _field = 0;
+            _idLength = 0;
+            if (complete)
+            {
+                // In case the value was empty
+                _value[_valueLength] = '\0';
+                _event = FEED_EVENT_DATASTREAM;
+                return i+1;
+            }
+        }
+        else if (c == '\r')
+        {
+            // Ignore it, the '\n' ends the line
+        }
+        else if ((c == ',') && (_field < 2))
+        {
+            // The value is the field after the ID, or if there's a
+            // timestamp between them, the rest of the line after that.
+            // The value buffer is left alone until there's something to
+            // put in it, as it may still hold the last datastream's value
+            _field++;
+            _valueLength = 0;
+            if (_field == 1)
+            {
+                _id[_idLength] = '\0';
+                _event = FEED_EVENT_ID;
+                return i+1;
+            }
+        }
+        else if (_field == 0)
+        {
+            append(_id, _idSize, _idLength, c);
+        }
+        else
+        {
+            append(_value, _valueSize, _valueLength, c);
+        }
+    }
+    return aLength;
+}
+
+void FeedReader::startToken()
+{
+    if (_target == KEY_ID)
+    {
+        _idLength = 0;
+        _id[0] = '\0';
+    }
+    else if (_target == KEY_VALUE)
+    {
+        _valueLength = 0;
+        _value[0] = '\0';
+    }
+    else
+    {
+        // It could be a key, see if it's one of ours
+        _key = KEY_ID | KEY_VALUE;
+        _keyIndex = 0;
+    }
+}
+
+void FeedReader::tokenChar(char aChar)
+{
+    if (_target == KEY_ID)
+    {
+        append(_id, _idSize, _idLength, aChar);
+    }
+    else if (_target == KEY_VALUE)
+    {
+        append(_value, _valueSize, _valueLength, aChar);
+    }
+    else if (_key)
+    {
+        // Drop the keys it doesn't match
+        if ((_key & KEY_ID) && (kIdKey[_keyIndex] != aChar))
+        {
+            _key &= ~KEY_ID;
+        }
+        if ((_key & KEY_VALUE) && (kValueKey[_keyIndex] != aChar))
+        {
+            _key &= ~KEY_VALUE;
+        }
+        _keyIndex++;
+    }
+}
+
+void FeedReader::endToken()
+{
+    if (_target == KEY_ID)
+    {
+        _idDepth = _depth;
+        _event = FEED_EVENT_ID;
+    }
+    else if (_target == KEY_VALUE)
+    {
+        _valueDepth = _depth;
+    }
+    else
+    {
+        // Only a key if all of it matched
+        if ((_key & KEY_ID) && (kIdKey[_keyIndex] != '\0'))
+        {
+            _key &= ~KEY_ID;
+        }
+        if ((_key & KEY_VALUE) && (kValueKey[_keyIndex] != '\0'))
+        {
+            _key &= ~KEY_VALUE;
+        }
+    }
+    _target = 0;
+}
+
+int FeedReader::parseJson(const char* aData, int aLength)
+{
+    int i = 0;
+    while (i < aLength)
+    {
+        char c = aData[i++];
+        switch (_state)
+        {
+        case JSON_STRING:
+            if (c == '"')
+            {
+                _state = JSON_BETWEEN;
+                endToken();
+                if (_event)
+                {
+                    return i;
+                }
+            }
+            else if (c == '\\')
+            {
+                _state = JSON_ESCAPE;
+            }
+            else
+            {
+                tokenChar(c);
+            }
+            break;
+        case JSON_ESCAPE:
+            _state = JSON_STRING;
+            switch (c)
+            {
+            case 'n':
+                c = '\n';
+                break;
+            case 'r':
+                c = '\r';
+                break;
+            case 't':
+                c = '\t';
+                break;
+            case 'b':
+                c = '\b';
+                break;
+            case 'f':
+                c = '\f';
+                break;
+            case 'u':
+                // A '?' stands in for the character, we skip its hex digits
+                _state = JSON_UNICODE;
+                _field = 4;
+                c = '?';
+                break;
+            };
+            tokenChar(c);
+            break;
+        case JSON_UNICODE:
+            if (--_field == 0)
+            {
+                _state = JSON_STRING;
+            }
+            break;
+        case JSON_LITERAL:
+            if ((c == ',') || (c == '}') || (c == ']') || (c == ' ') ||
+                (c == '\t') || (c == '\r') || (c == '\n'))
+            {
+                _state = JSON_BETWEEN;
+                endToken();
+                // Look at the character that ended it again
+                i--;
+                if (_event)
+                {
+                    return i;
+                }
+            }
+            else
+            {
+                tokenChar(c);
+            }
+            break;
+        default:
+            // JSON_BETWEEN
+            switch (c)
+            {
+            case '"':
+                startToken();
+                _state = JSON_STRING;
+                break;
+            case ':':
+                // The value that follows belongs to the key just read
+                _target = _key;
+                _key = 0;
+                break;
+            case '{':
+            case '[':
+                _depth++;
+                _key = 0;
+                _target = 0;
+                break;
+            case '}':
+                // A datastream is an object with both an ID and a value
+                if (_depth && (_idDepth == _depth) && (_valueDepth == _depth))
+                {
+                    _event = FEED_EVENT_DATASTREAM;
+                }
+                if (_idDepth >= _depth)
+                {
+                    _idDepth = 0;
+                }
+                if (_valueDepth >= _depth)
+                {
+                    _valueDepth = 0;
+                }
+                // fall through
+            case ']':
+                if (_depth)
+                {
+                    _depth--;
+                }
+                _key = 0;
+                _target = 0;
+                if (_event)
+                {
+                    return i;
+                }
+                break;
+            case ',':
+                _key = 0;
+                _target = 0;
+                break;
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                break;
+            default:
+                startToken();
+                _state = JSON_LITERAL;
+                tokenChar(c);
+                break;
+            };
+            break;
+        };
+    }
+    return i;
+}
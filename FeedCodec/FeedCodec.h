@@ -0,0 +1,159 @@
+// JSON and CSV formats for Xively, Cosm and Pachube feeds
+// Released under Apache License, version 2.0
+//
+// The same feed formats are used by the Xively, Cosm and ERxPachube
+// libraries, so they share this code to write and read them.  Neither
+// FeedWriter nor FeedReader uses the heap: feeds are written straight to a
+// Print as they're formatted, and read a block at a time into buffers you
+// provide.
+
+#ifndef FeedCodec_h
+#define FeedCodec_h
+
+#include <Arduino.h>
+
+#define FEED_JSON 0
+#define FEED_CSV  1
+
+// Events returned by FeedReader::parse()
+#define FEED_EVENT_NONE       0   // nothing new yet, give it more of the feed
+#define FEED_EVENT_ID         1   // a datastream's ID is in the ID buffer
+#define FEED_EVENT_DATASTREAM 2   // a datastream's ID and value are in the buffers
+
+// Sizes of the buffers the libraries use when reading a feed
+#ifndef FEED_ID_SIZE
+#define FEED_ID_SIZE    32
+#endif
+#ifndef FEED_VALUE_SIZE
+#define FEED_VALUE_SIZE 24
+#endif
+
+/** Writes a feed, as JSON or CSV, to a Print.
+  Call beginFeed(), then for each datastream beginDatastream(), value() and
+  endDatastream(), then endFeed().  Output goes straight to the Print, so
+  nothing is buffered here; give it a NULL Print to just count how many
+  bytes the feed takes (e.g. for a Content-Length header).
+*/
+class FeedWriter
+{
+public:
+  FeedWriter(Print* aOut, int aFormat);
+
+  void beginFeed();
+  void beginDatastream(const char* aId);
+  void beginDatastream(unsigned long aId);
+  void beginDatastream(const String& aId);
+  void value(const char* aValue);
+  void value(const String& aValue);
+  void value(long aValue);
+  void value(double aValue, int aDigits =2);
+  void endDatastream();
+  void endFeed();
+
+  /** Number of bytes written so far */
+  size_t count() { return _count; };
+
+  /** Format a number into aBuffer, null-terminated, without sprintf,
+    dtostrf or the heap.  aBuffer must hold at least 12 characters for a
+    long, or 13 plus aDigits for a double (larger values are written as
+    "ovf", like Print does)
+    @return length of the string written
+  */
+  static int format(char* aBuffer, long aValue);
+  static int format(char* aBuffer, double aValue, int aDigits);
+
+protected:
+  void write(const char* aData, size_t aLength);
+  void writeEscaped(const char* aData, size_t aLength);
+  void writeEscaped(const String& aString);
+
+  Print* _out;
+  int _format;
+  bool _first;
+  size_t _count;
+};
+
+/** A Print that throws away whatever is printed, so print() just returns
+  its length.  FeedWriter with a NULL Print does this for feeds without
+  the Print calls; this is for anything else
+*/
+class CountingStream : public Print
+{
+public:
+  virtual size_t write(uint8_t) { return 1; };
+  virtual size_t write(const uint8_t *buffer, size_t size) { return size; };
+};
+
+/** Reads a feed, as JSON or CSV, a block at a time.
+  Pass whatever has arrived of the feed to parse(); it stops as soon as it
+  has something to report, and says how much of the block it used, so
+  call it again with the rest.  The CSV can be either "id,value" or
+  "id,timestamp,value" lines; in the JSON, each object with an "id" and a
+  "current_value" is a datastream.  IDs and values too long for their
+  buffers are cut short.
+*/
+class FeedReader
+{
+public:
+  FeedReader(int aFormat, char* aIdBuffer, int aIdSize, char* aValueBuffer, int aValueSize);
+
+  /** Start again at the beginning of a feed */
+  void reset();
+  /** Read part of the feed
+    @param aData the next part of the feed
+    @param aLength number of bytes in aData
+    @return number of bytes of aData used; see event() for why it stopped
+  */
+  int parse(const char* aData, int aLength);
+  /** Read the next character of the feed
+    @return the event it completed, FEED_EVENT_NONE if none
+  */
+  int parse(char aChar) { parse(&aChar, 1); return _event; };
+  /** What the last parse() stopped for: FEED_EVENT_NONE if it used up all its
+    data, FEED_EVENT_ID once a datastream's ID has been read (in CSV that's
+    before its value, so setValueBuffer() can choose where the value goes),
+    or FEED_EVENT_DATASTREAM once its value has been read too
+  */
+  int event() { return _event; };
+  /** The buffers the ID and value are read into */
+  char* id() { return _id; };
+  char* value() { return _value; };
+  /** Read values into a different buffer from now on */
+  void setValueBuffer(char* aValueBuffer, int aValueSize);
+  /** Call at the end of the feed, in case the last CSV line didn't end
+    with a newline
+    @return FEED_EVENT_DATASTREAM if that left a datastream to report
+  */
+  int finish();
+
+protected:
+  int parseCsv(const char* aData, int aLength);
+  int parseJson(const char* aData, int aLength);
+  void append(char* aBuffer, int aSize, int& aLength, char aChar);
+  // Reading JSON strings and literals
+  void startToken();
+  void tokenChar(char aChar);
+  void endToken();
+
+  int _format;
+  char* _id;
+  int _idSize;
+  int _idLength;
+  char* _value;
+  int _valueSize;
+  int _valueLength;
+  int _event;
+  // CSV state: field of the line we're in, 0 = ID, 2 = past the timestamp.
+  // In JSON, the hex digits left to skip in a \u escape
+  uint8_t _field;
+  // JSON state
+  uint8_t _state;
+  uint8_t _depth;
+  uint8_t _key;        // which of our keys the current key is, as it's matched
+  uint8_t _keyIndex;   // characters of it matched
+  uint8_t _target;     // where the value being read goes
+  uint8_t _idDepth;    // object depth the ID and value were found at
+  uint8_t _valueDepth;
+};
+
+#endif
@@ -0,0 +1,213 @@
+// Released under Apache License, version 2.0
+//
+// Times FeedWriter and FeedReader on a feed of eight datastreams, so no
+// network is needed.  Writing is compared with printing the same JSON a
+// piece at a time, the way the Xively and Cosm libraries used to, and the
+// number of write() calls each makes is counted too, as each one can be a
+// separate transfer to the network chip.  Reading takes a copy of a real
+// CSV and JSON feed from program memory, 32 bytes at a time as a sketch
+// would get them from a Client.  Results go to the serial port.
+
+#include <FeedCodec.h>
+#include <avr/pgmspace.h>
+
+// How many times to repeat each test
+const int kRuns = 50;
+// How many bytes to give FeedReader at a time
+const int kBlockSize = 32;
+
+// A Print that throws away what it's given, counting it and the calls
+class CountingPrint : public Print
+{
+public:
+  CountingPrint() : bytes(0), calls(0) {};
+  size_t write(uint8_t) { bytes++; calls++; return 1; };
+  size_t write(const uint8_t*, size_t aSize) { bytes += aSize; calls++; return aSize; };
+  unsigned long bytes;
+  unsigned long calls;
+};
+
+const int kDatastreams = 8;
+const char* kIds[kDatastreams] = { "humidity", "light", "temperature", "pressure",
+                                   "door", "battery", "status", "rssi" };
+float floatValues[kDatastreams] = { 48.2, 412, 21.56, 1013.25, 0, 3.71, 0, -67 };
+const char kStatus[] = "All \"OK\"";
+
+const char csvFeed[] PROGMEM =
+  "humidity,2013-06-10T09:37:51.006000Z,48.2\r\n"
+  "light,2013-06-10T09:37:51.006000Z,412\r\n"
+  "temperature,2013-06-10T09:37:51.006000Z,21.56\r\n"
+  "pressure,2013-06-10T09:37:51.006000Z,1013.25\r\n"
+  "door,2013-06-10T09:37:51.006000Z,0\r\n"
+  "battery,2013-06-10T09:37:51.006000Z,3.71\r\n"
+  "status,2013-06-10T09:37:51.006000Z,All OK\r\n"
+  "rssi,2013-06-10T09:37:51.006000Z,-67\r\n";
+
+const char jsonFeed[] PROGMEM =
+  "{\"id\":15552,\"title\":\"Office environment\",\"private\":\"false\","
+  "\"feed\":\"https://api.xively.com/v2/feeds/15552.json\",\"status\":\"live\","
+  "\"updated\":\"2013-06-10T09:37:51.112000Z\",\"version\":\"1.0.0\",\"datastreams\":["
+  "{\"id\":\"humidity\",\"current_value\":\"48.2\",\"at\":\"2013-06-10T09:37:51.006000Z\","
+  "\"max_value\":\"71.0\",\"min_value\":\"22.9\",\"unit\":{\"symbol\":\"%\",\"label\":\"percent\"}},"
+  "{\"id\":\"light\",\"current_value\":\"412\",\"at\":\"2013-06-10T09:37:51.006000Z\"},"
+  "{\"id\":\"temperature\",\"current_value\":\"21.56\",\"at\":\"2013-06-10T09:37:51.006000Z\","
+  "\"unit\":{\"symbol\":\"\\u00b0C\",\"label\":\"Celsius\"}},"
+  "{\"id\":\"pressure\",\"current_value\":\"1013.25\",\"at\":\"2013-06-10T09:37:51.006000Z\"},"
+  "{\"id\":\"door\",\"current_value\":\"0\",\"at\":\"2013-06-10T09:37:51.006000Z\"},"
+  "{\"id\":\"battery\",\"current_value\":\"3.71\",\"at\":\"2013-06-10T09:37:51.006000Z\"},"
+  "{\"id\":\"status\",\"current_value\":\"All \\\"OK\\\"\",\"at\":\"2013-06-10T09:37:51.006000Z\"},"
+  "{\"id\":\"rssi\",\"current_value\":\"-67\",\"at\":\"2013-06-10T09:37:51.006000Z\"}],"
+  "\"location\":{\"disposition\":\"fixed\",\"name\":\"Office\",\"exposure\":\"indoor\"}}";
+
+// Print the feed a piece at a time, as XivelyFeed::printTo used to
+void printFeed(Print& aPrint)
+{
+  aPrint.println("{");
+  aPrint.println("\"version\":\"1.0.0\",");
+  aPrint.println("\"datastreams\" : [");
+  for (int i = 0; i < kDatastreams; i++)
+  {
+    aPrint.print("{ \"id\" : \"");
+    aPrint.print(kIds[i]);
+    aPrint.print("\", \"current_value\" : \"");
+    if (i == 6)
+    {
+      aPrint.print(kStatus);
+    }
+    else
+    {
+      aPrint.print(floatValues[i]);
+    }
+    aPrint.print("\" }");
+    if (i == kDatastreams-1)
+    {
+      aPrint.println();
+    }
+    else
+    {
+      aPrint.println(",");
+    }
+  }
+  aPrint.println("]");
+  aPrint.println("}");
+}
+
+void writeFeed(Print* aPrint, int aFormat)
+{
+  FeedWriter writer(aPrint, aFormat);
+  writer.beginFeed();
+  for (int i = 0; i < kDatastreams; i++)
+  {
+    writer.beginDatastream(kIds[i]);
+    if (i == 6)
+    {
+      writer.value(kStatus);
+    }
+    else
+    {
+      writer.value(floatValues[i]);
+    }
+    writer.endDatastream();
+  }
+  writer.endFeed();
+}
+
+void report(const char* aName, unsigned long aBytes, unsigned long aCalls, unsigned long aMicros)
+{
+  Serial.print(aName);
+  Serial.print(": ");
+  Serial.print(aBytes);
+  Serial.print(" bytes, ");
+  if (aCalls)
+  {
+    Serial.print(aCalls);
+    Serial.print(" writes, ");
+  }
+  Serial.print(aMicros / kRuns);
+  Serial.print(" us, ");
+  // Bytes per second, kept in range of an unsigned long
+  Serial.print((aBytes * kRuns * 1000UL) / (aMicros / 1000UL + 1));
+  Serial.println(" bytes/s");
+}
+
+void timeWriting()
+{
+  CountingPrint out;
+  unsigned long start = micros();
+  for (int i = 0; i < kRuns; i++)
+  {
+    printFeed(out);
+  }
+  unsigned long elapsed = micros() - start;
+  report("print() JSON", out.bytes / kRuns, out.calls / kRuns, elapsed);
+
+  for (int format = FEED_JSON; format <= FEED_CSV; format++)
+  {
+    CountingPrint out;
+    start = micros();
+    for (int i = 0; i < kRuns; i++)
+    {
+      writeFeed(&out, format);
+    }
+    elapsed = micros() - start;
+    report(format == FEED_JSON ? "FeedWriter JSON" : "FeedWriter CSV", out.bytes / kRuns, out.calls / kRuns, elapsed);
+  }
+}
+
+void timeReading(const char* aName, const char* aFeed, int aFormat)
+{
+  char id[FEED_ID_SIZE];
+  char value[FEED_VALUE_SIZE];
+  char block[kBlockSize];
+  int length = strlen_P(aFeed);
+  int found = 0;
+  unsigned long start = micros();
+  for (int i = 0; i < kRuns; i++)
+  {
+    FeedReader reader(aFormat, id, sizeof(id), value, sizeof(value));
+    found = 0;
+    for (int pos = 0; pos < length; pos += kBlockSize)
+    {
+      int n = (length - pos < kBlockSize) ? length - pos : kBlockSize;
+      memcpy_P(block, aFeed + pos, n);
+      for (int used = 0; used < n; )
+      {
+        used += reader.parse(block + used, n - used);
+        if (reader.event() == FEED_EVENT_DATASTREAM)
+        {
+          found++;
+        }
+      }
+    }
+    if (reader.finish() == FEED_EVENT_DATASTREAM)
+    {
+      found++;
+    }
+  }
+  unsigned long elapsed = micros() - start;
+  report(aName, length, 0, elapsed);
+  if (found != kDatastreams)
+  {
+    Serial.print("  expected ");
+    Serial.print(kDatastreams);
+    Serial.print(" datastreams, found ");
+    Serial.println(found);
+  }
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  Serial.println("FeedCodec benchmark");
+  timeWriting();
+  timeReading("FeedReader CSV", csvFeed, FEED_CSV);
+  timeReading("FeedReader JSON", jsonFeed, FEED_JSON);
+  Serial.print("sizeof(FeedWriter) ");
+  Serial.print(sizeof(FeedWriter));
+  Serial.print(", sizeof(FeedReader) ");
+  Serial.println(sizeof(FeedReader));
+}
+
+void loop()
+{
+}
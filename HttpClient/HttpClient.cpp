@@ -10,11 +10,15 @@
 
 // Initialize constants
 const char* HttpClient::kUserAgent = "Arduino/2.1";
-const char* HttpClient::kContentLengthPrefix = HTTP_HEADER_CONTENT_LENGTH ": ";
+const char* HttpClient::kWatchedHeaders[kWatchedHeaderCount] = {
+    "content-length: ",
+    "transfer-encoding: chunked",
+    "connection: close"
+};
 
 #ifdef PROXY_ENABLED // currently disabled as introduces dependency on Dns.h in Ethernet
 HttpClient::HttpClient(Client& aClient, const char* aProxy, uint16_t aProxyPort)
- : iClient(&aClient), iProxyPort(aProxyPort)
+ : iClient(&aClient), iKeepAlive(false), iProxyPort(aProxyPort), iHttpResponseTimeout(kHttpResponseTimeout)
 {
   resetState();
   if (aProxy)
@@ -29,7 +33,7 @@ HttpClient::HttpClient(Client& aClient, const char* aProxy, uint16_t aProxyPort)
 }
 #else
 HttpClient::HttpClient(Client& aClient)
- : iClient(&aClient), iProxyPort(0)
+ : iClient(&aClient), iKeepAlive(false), iProxyPort(0), iHttpResponseTimeout(kHttpResponseTimeout)
 {
   resetState();
 }
@@ -38,11 +42,28 @@ HttpClient::HttpClient(Client& aClient)
 void HttpClient::resetState()
 {
   iState = eIdle;
+  iRxPos = 0;
+  iRxLen = 0;
+  iChunkedBody = false;
+  iTxLen = 0;
+  iHeadRequest = false;
+  iRequestsPending = 0;
+  iServerId = 0;
+  iServerPort = 0;
+  resetResponseState();
+}
+
+void HttpClient::resetResponseState()
+{
   iStatusCode = 0;
-  iContentLength = 0;
+  iContentLength = kNoContentLengthHeader;
   iBodyLengthConsumed = 0;
-  iContentLengthPtr = 0;
-  iHttpResponseTimeout = kHttpResponseTimeout;
+  iHeaderMatches = (1 << kWatchedHeaderCount) - 1;
+  iHeaderMatchIdx = 0;
+  iIsChunked = false;
+  iChunkState = eChunkSize;
+  iChunkLength = 0;
+  iConnectionClose = !iKeepAlive;
 }
 
 void HttpClient::stop()
@@ -53,15 +74,51 @@ void HttpClient::stop()
 
 void HttpClient::beginRequest()
 {
+  if (iKeepAlive && (iState > eRequestSent))
+  {
+    // Finish off the previous response first
+    endResponse();
+  }
   iState = eRequestStarted;
 }
 
-int HttpClient::startRequest(const char* aServerName, uint16_t aServerPort, const char* aURLPath, const char* aHttpMethod, const char* aUserAgent)
+bool HttpClient::connectTo(const char* aServerName, const IPAddress& aServerAddress, uint16_t aServerPort)
 {
-    tHttpState initialState = iState;
-    if ((eIdle != iState) && (eRequestStarted != iState))
+    // Work out a hash of where we're going, a quick check of whether an open
+    // connection goes to the same place.  Never 0, which means "not connected"
+    uint16_t id = aServerPort;
+    if (aServerName)
     {
-        return HTTP_ERROR_API;
+        for (const char* p = aServerName; *p; p++)
+        {
+            id = (id << 5) + id + *p;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            id = (id << 5) + id + aServerAddress[i];
+        }
+    }
+    id |= 1;
+
+    if (iServerId)
+    {
+        if (iKeepAlive && !iConnectionClose && (id == iServerId) &&
+            isConnectedTo(aServerName, aServerAddress, aServerPort) &&
+            iClient->connected())
+        {
+            // We can carry on using this connection
+            return true;
+        }
+        // Otherwise the old connection has to go, and with it any responses
+        // we were still expecting
+        iClient->stop();
+        iRequestsPending = 0;
+        iServerId = 0;
+        iRxPos = 0;
+        iRxLen = 0;
     }
 
 #ifdef PROXY_ENABLED
@@ -72,24 +129,98 @@ int HttpClient::startRequest(const char* aServerName, uint16_t aServerPort, cons
 #ifdef LOGGING
             Serial.println("Proxy connection failed");
 #endif
-            return HTTP_ERROR_CONNECTION_FAILED;
+            return false;
         }
     }
     else
 #endif
     {
-        if (!iClient->connect(aServerName, aServerPort) > 0)
+        if (aServerName)
+        {
+            if (!iClient->connect(aServerName, aServerPort) > 0)
+            {
+#ifdef LOGGING
+                Serial.println("Connection failed");
+#endif
+                return false;
+            }
+        }
+        else if (!iClient->connect(aServerAddress, aServerPort) > 0)
         {
 #ifdef LOGGING
             Serial.println("Connection failed");
 #endif
-            return HTTP_ERROR_CONNECTION_FAILED;
+            return false;
+        }
+    }
+    iServerId = id;
+    iServerPort = aServerPort;
+    iServerAddress = aServerAddress;
+    iServerName[0] = '\0';
+    if (aServerName)
+    {
+        if (strlen(aServerName) < sizeof(iServerName))
+        {
+            strcpy(iServerName, aServerName);
+        }
+        else
+        {
+            // Too long to check next time, so don't reuse the connection
+            iServerPort = 0;
+        }
+    }
+    iConnectionClose = !iKeepAlive;
+    return true;
+}
+
+bool HttpClient::isConnectedTo(const char* aServerName, const IPAddress& aServerAddress, uint16_t aServerPort)
+{
+    if ((iServerPort == 0) || (aServerPort != iServerPort))
+    {
+        return false;
+    }
+    if (aServerName)
+    {
+        return strcmp(aServerName, iServerName) == 0;
+    }
+    if (iServerName[0])
+    {
+        return false;
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        if (aServerAddress[i] != iServerAddress[i])
+        {
+            return false;
         }
     }
+    return true;
+}
+
+int HttpClient::startRequest(const char* aServerName, uint16_t aServerPort, const char* aURLPath, const char* aHttpMethod, const char* aUserAgent)
+{
+    if (iKeepAlive && (iState > eRequestSent))
+    {
+        // Finish off the previous response, so the connection is free
+        endResponse();
+    }
+    tHttpState initialState = iState;
+    // In keep-alive mode we can also send this while still waiting for the
+    // responses to earlier requests
+    if ((eIdle != iState) && (eRequestStarted != iState) &&
+        !(iKeepAlive && (eRequestSent == iState)))
+    {
+        return HTTP_ERROR_API;
+    }
+
+    if (!connectTo(aServerName, IPAddress(0,0,0,0), aServerPort))
+    {
+        return HTTP_ERROR_CONNECTION_FAILED;
+    }
 
     // Now we're connected, send the first part of the request
     int ret = sendInitialHeaders(aServerName, IPAddress(0,0,0,0), aServerPort, aURLPath, aHttpMethod, aUserAgent);
-    if ((initialState == eIdle) && (HTTP_SUCCESS == ret))
+    if ((initialState != eRequestStarted) && (HTTP_SUCCESS == ret))
     {
         // This was a simple version of the API, so terminate the headers now
         finishHeaders();
@@ -101,38 +232,28 @@ int HttpClient::startRequest(const char* aServerName, uint16_t aServerPort, cons
 
 int HttpClient::startRequest(const IPAddress& aServerAddress, const char* aServerName, uint16_t aServerPort, const char* aURLPath, const char* aHttpMethod, const char* aUserAgent)
 {
+    if (iKeepAlive && (iState > eRequestSent))
+    {
+        // Finish off the previous response, so the connection is free
+        endResponse();
+    }
     tHttpState initialState = iState;
-    if ((eIdle != iState) && (eRequestStarted != iState))
+    // In keep-alive mode we can also send this while still waiting for the
+    // responses to earlier requests
+    if ((eIdle != iState) && (eRequestStarted != iState) &&
+        !(iKeepAlive && (eRequestSent == iState)))
     {
         return HTTP_ERROR_API;
     }
 
-#ifdef PROXY_ENABLED
-    if (iProxyPort)
+    if (!connectTo(NULL, aServerAddress, aServerPort))
     {
-        if (!iClient->connect(iProxyAddress, iProxyPort) > 0)
-        {
-#ifdef LOGGING
-            Serial.println("Proxy connection failed");
-#endif
-            return HTTP_ERROR_CONNECTION_FAILED;
-        }
-    }
-    else
-#endif
-    {
-        if (!iClient->connect(aServerAddress, aServerPort) > 0)
-        {
-#ifdef LOGGING
-            Serial.println("Connection failed");
-#endif
-            return HTTP_ERROR_CONNECTION_FAILED;
-        }
+        return HTTP_ERROR_CONNECTION_FAILED;
     }
 
     // Now we're connected, send the first part of the request
     int ret = sendInitialHeaders(aServerName, aServerAddress, aServerPort, aURLPath, aHttpMethod, aUserAgent);
-    if ((initialState == eIdle) && (HTTP_SUCCESS == ret))
+    if ((initialState != eRequestStarted) && (HTTP_SUCCESS == ret))
     {
         // This was a simple version of the API, so terminate the headers now
         finishHeaders();
@@ -195,9 +316,14 @@ int HttpClient::sendInitialHeaders(const char* aServerName, IPAddress aServerIP,
     {
         sendHeader(HTTP_HEADER_USER_AGENT, kUserAgent);
     }
-    // We don't support persistent connections, so tell the server to
-    // close this connection after we're done
-    sendHeader(HTTP_HEADER_CONNECTION, "close");
+    // Unless we're keeping the connection open, tell the server to close
+    // it after we're done.  HTTP/1.1 connections are persistent by default
+    if (!iKeepAlive)
+    {
+        sendHeader(HTTP_HEADER_CONNECTION, "close");
+    }
+    // The response to a HEAD request has headers but no body
+    iHeadRequest = (strcmp(aHttpMethod, HTTP_METHOD_HEAD) == 0);
 
     // Everything has gone well
     iState = eRequestStarted;
@@ -276,6 +402,7 @@ void HttpClient::finishHeaders()
 {
     iClient->println();
     iState = eRequestSent;
+    iRequestsPending++;
 }
 
 void HttpClient::endRequest()
@@ -285,15 +412,110 @@ void HttpClient::endRequest()
         // We still need to finish off the headers
         finishHeaders();
     }
+    else if (iChunkedBody)
+    {
+        // Send the last of the body, then the zero-length chunk to end it
+        sendChunk();
+        iClient->print("0\r\n\r\n");
+        iChunkedBody = false;
+    }
     // else the end of headers has already been sent, so nothing to do here
 }
 
+void HttpClient::beginChunkedBody()
+{
+    if (iState != eRequestStarted)
+    {
+        return;
+    }
+    sendHeader(HTTP_HEADER_TRANSFER_ENCODING, "chunked");
+    finishHeaders();
+    iChunkedBody = true;
+    iTxLen = 0;
+}
+
+void HttpClient::sendChunk()
+{
+    if (iTxLen == 0)
+    {
+        // A zero-length chunk would end the body
+        return;
+    }
+    // The size line is always two hex digits, so it fits in front of the
+    // data and the whole chunk goes out in a single write
+    static const char kHexDigits[] = "0123456789abcdef";
+    iTxBuffer[0] = kHexDigits[iTxLen >> 4];
+    iTxBuffer[1] = kHexDigits[iTxLen & 0x0f];
+    iTxBuffer[2] = '\r';
+    iTxBuffer[3] = '\n';
+    iTxBuffer[4 + iTxLen] = '\r';
+    iTxBuffer[5 + iTxLen] = '\n';
+    iClient->write(iTxBuffer, iTxLen + 6);
+    iTxLen = 0;
+}
+
+size_t HttpClient::write(uint8_t aByte)
+{
+    return write(&aByte, 1);
+}
+
+size_t HttpClient::write(const uint8_t *aBuffer, size_t aSize)
+{
+    if (iState < eRequestSent)
+    {
+        finishHeaders();
+    }
+    if (!iChunkedBody)
+    {
+        return iClient->write(aBuffer, aSize);
+    }
+    size_t left = aSize;
+    while (left)
+    {
+        size_t n = HTTP_TX_BUFFER_SIZE - iTxLen;
+        if (n > left)
+        {
+            n = left;
+        }
+        memcpy(iTxBuffer + 4 + iTxLen, aBuffer, n);
+        iTxLen += n;
+        aBuffer += n;
+        left -= n;
+        if (iTxLen == HTTP_TX_BUFFER_SIZE)
+        {
+            sendChunk();
+        }
+    }
+    return aSize;
+}
+
 int HttpClient::responseStatusCode()
 {
     if (iState < eRequestSent)
     {
         return HTTP_ERROR_API;
     }
+    if (iState > eRequestSent)
+    {
+        // We're still part way through the previous response.  That's fine
+        // if there's another pipelined response behind it
+        if (!iRequestsPending)
+        {
+            return HTTP_ERROR_API;
+        }
+        int ret = endResponse();
+        if (ret != HTTP_SUCCESS)
+        {
+            return ret;
+        }
+        if (iState != eRequestSent)
+        {
+            // The connection was closed, the response will never come
+            return HTTP_ERROR_CONNECTION_FAILED;
+        }
+    }
+    resetResponseState();
+    iRequestsPending--;
     // The first line will be of the form Status-Line:
     //   HTTP-Version SP Status-Code SP Reason-Phrase CRLF
     // Where HTTP-Version is of the form:
@@ -316,17 +538,24 @@ int HttpClient::responseStatusCode()
         while ((c != '\n') && 
                ( (millis() - timeoutStart) < iHttpResponseTimeout ))
         {
-            if (available())
+            if (fillRxBuffer())
             {
-                c = read();
-                if (c != -1)
+                // Work through whatever's buffered, up to the end of the line
+                while ((c != '\n') && (iRxPos < iRxLen))
                 {
+                    c = iRxBuffer[iRxPos++];
                     switch(iState)
                     {
                     case eRequestSent:
                         // We haven't reached the status code yet
                         if ( (*statusPtr == '*') || (*statusPtr == c) )
                         {
+                            if ((statusPtr == statusPrefix + 7) && (c == '0'))
+                            {
+                                // An HTTP/1.0 server, which will close the
+                                // connection after the response
+                                iConnectionClose = true;
+                            }
                             // This character matches, just move along
                             statusPtr++;
                             if (*statusPtr == '\0')
@@ -359,9 +588,9 @@ int HttpClient::responseStatusCode()
                         // We're just waiting for the end of the line now
                         break;
                     };
-                    // We read something, reset the timeout counter
-                    timeoutStart = millis();
                 }
+                // We read something, reset the timeout counter
+                timeoutStart = millis();
             }
             else
             {
@@ -406,9 +635,9 @@ int HttpClient::skipResponseHeaders()
     while ((!endOfHeadersReached()) && 
            ( (millis() - timeoutStart) < iHttpResponseTimeout ))
     {
-        if (available())
+        if (fillRxBuffer())
         {
-            (void)readHeader();
+            parseHeaders();
             // We read something, reset the timeout counter
             timeoutStart = millis();
         }
@@ -431,9 +660,110 @@ int HttpClient::skipResponseHeaders()
     }
 }
 
+int HttpClient::skipResponseBody()
+{
+    if (!endOfHeadersReached())
+    {
+        return HTTP_ERROR_API;
+    }
+    unsigned long timeoutStart = millis();
+    // Whilst we haven't timed out & haven't reached the end of the body
+    while ((!endOfBodyReached()) && 
+           ( (millis() - timeoutStart) < iHttpResponseTimeout ))
+    {
+        const uint8_t* data;
+        if (readInPlace(data) > 0)
+        {
+            // We read something, reset the timeout counter
+            timeoutStart = millis();
+        }
+        else if (!iClient->connected())
+        {
+            // The server has closed the connection, which is as much of the
+            // body as we're going to get
+            return HTTP_SUCCESS;
+        }
+        else
+        {
+            // We haven't got any data, so let's pause to allow some to
+            // arrive
+            delay(kHttpWaitForDataDelay);
+        }
+    }
+    if (endOfBodyReached())
+    {
+        return HTTP_SUCCESS;
+    }
+    else
+    {
+        // We must've timed out
+        return HTTP_ERROR_TIMED_OUT;
+    }
+}
+
+int HttpClient::endResponse()
+{
+    if (!iKeepAlive)
+    {
+        stop();
+        return HTTP_SUCCESS;
+    }
+    if (iState < eRequestSent)
+    {
+        // There isn't a response to finish
+        return HTTP_SUCCESS;
+    }
+
+    int ret = HTTP_SUCCESS;
+    if (iState == eRequestSent)
+    {
+        // We haven't even started on this response yet
+        ret = responseStatusCode();
+        if (ret >= 0)
+        {
+            ret = HTTP_SUCCESS;
+        }
+    }
+    if (ret == HTTP_SUCCESS)
+    {
+        ret = skipResponseHeaders();
+    }
+    if (ret == HTTP_SUCCESS)
+    {
+        ret = skipResponseBody();
+    }
+
+    if ((ret != HTTP_SUCCESS) || iConnectionClose || !endOfBodyReached())
+    {
+        // We can't tell where the next response would start, or the server
+        // isn't going to send one, so this connection is no more use
+        stop();
+    }
+    else
+    {
+        iState = iRequestsPending ? eRequestSent : eIdle;
+    }
+    return ret;
+}
+
 bool HttpClient::endOfBodyReached()
 {
-    if (endOfHeadersReached() && (contentLength() != kNoContentLengthHeader))
+    if (!endOfHeadersReached())
+    {
+        return false;
+    }
+    if (iHeadRequest || (iStatusCode == 204) || (iStatusCode == 304))
+    {
+        // These never have a body, whatever the headers say
+        return true;
+    }
+    if (iIsChunked)
+    {
+        // The end is the zero-length chunk and the trailer after it
+        chunkAvailable();
+        return (iChunkState == eChunkDone);
+    }
+    if (contentLength() != kNoContentLengthHeader)
     {
         // We've got to the body and we know how long it will be
         return (iBodyLengthConsumed >= contentLength());
@@ -441,91 +771,351 @@ bool HttpClient::endOfBodyReached()
     return false;
 }
 
-int HttpClient::read()
+bool HttpClient::chunkAvailable()
 {
-#if 0 // Fails on WiFi because multi-byte read seems to be broken
-    uint8_t b[1];
-    int ret = read(b, 1);
-    if (ret == 1)
+    while (iChunkState != eChunkData)
     {
-        return b[0];
+        if (iChunkState == eChunkDone)
+        {
+            return false;
+        }
+        if (!fillRxBuffer())
+        {
+            // We'll have to wait for more data to find out
+            return false;
+        }
+        char c = iRxBuffer[iRxPos++];
+        switch(iChunkState)
+        {
+        case eChunkSize:
+            // chunk-size [ chunk-extension ] CRLF, with the size in hex
+            if (isxdigit(c))
+            {
+                iChunkLength = iChunkLength*16 + (isdigit(c) ? (c - '0') : (tolower(c) - 'a' + 10));
+            }
+            else if (c == '\n')
+            {
+                // A zero-length chunk is the last one, and the trailer follows
+                iChunkState = iChunkLength ? eChunkData : eChunkTrailer;
+            }
+            else if (c != '\r')
+            {
+                iChunkState = eChunkExtension;
+            }
+            break;
+        case eChunkExtension:
+            // We don't use chunk extensions, just skip to the end of the line
+            if (c == '\n')
+            {
+                iChunkState = iChunkLength ? eChunkData : eChunkTrailer;
+            }
+            break;
+        case eChunkDataEnd:
+            // The CRLF after the chunk data
+            if (c == '\n')
+            {
+                iChunkState = eChunkSize;
+                iChunkLength = 0;
+            }
+            break;
+        case eChunkTrailer:
+            // At the start of a trailer line; an empty one ends the body
+            if (c == '\n')
+            {
+                iChunkState = eChunkDone;
+            }
+            else if (c != '\r')
+            {
+                iChunkState = eChunkTrailerLine;
+            }
+            break;
+        case eChunkTrailerLine:
+            if (c == '\n')
+            {
+                iChunkState = eChunkTrailer;
+            }
+            break;
+        default:
+            break;
+        };
     }
-    else
+    return true;
+}
+
+int HttpClient::fillRxBuffer()
+{
+    if (iRxPos < iRxLen)
     {
-        return -1;
+        return iRxLen - iRxPos;
     }
+    iRxPos = 0;
+    iRxLen = 0;
+    int n = iClient->available();
+    if (n > 0)
+    {
+        if (n > HTTP_RX_BUFFER_SIZE)
+        {
+            n = HTTP_RX_BUFFER_SIZE;
+        }
+#ifdef HTTP_SINGLE_BYTE_READS
+        int c;
+        while ((iRxLen < n) && ((c = iClient->read()) >= 0))
+        {
+            iRxBuffer[iRxLen++] = c;
+        }
 #else
-    int ret = iClient->read();
-    if (ret >= 0)
+        n = iClient->read(iRxBuffer, n);
+        if (n > 0)
+        {
+            iRxLen = n;
+        }
+#endif
+    }
+    return iRxLen;
+}
+
+int HttpClient::bodyWindow()
+{
+    if (endOfBodyReached())
+    {
+        return -1;
+    }
+    if (iIsChunked && !chunkAvailable())
+    {
+        return 0;
+    }
+    long n = fillRxBuffer();
+    // Don't go beyond this chunk, or the end of the body
+    if (iIsChunked && (n > iChunkLength))
+    {
+        n = iChunkLength;
+    }
+    else if (!iIsChunked && (iContentLength != kNoContentLengthHeader) &&
+             (n > iContentLength - iBodyLengthConsumed))
     {
-        if (endOfHeadersReached() && iContentLength > 0)
-	{
-            // We're outputting the body now and we've seen a Content-Length header
-            // So keep track of how many bytes are left
-            iBodyLengthConsumed++;
-	}
+        n = iContentLength - iBodyLengthConsumed;
+    }
+    return n;
+}
+
+void HttpClient::consumeBody(int aLength)
+{
+    iRxPos += aLength;
+    iBodyLengthConsumed += aLength;
+    if (iIsChunked && ((iChunkLength -= aLength) == 0))
+    {
+        iChunkState = eChunkDataEnd;
+    }
+}
+
+int HttpClient::available()
+{
+    if (!endOfHeadersReached())
+    {
+        return (iRxLen - iRxPos) + iClient->available();
+    }
+    if (bodyWindow() <= 0)
+    {
+        return 0;
+    }
+    long ret = (iRxLen - iRxPos) + iClient->available();
+    // Don't count anything beyond this chunk, or the end of the body
+    if (iIsChunked && (ret > iChunkLength))
+    {
+        ret = iChunkLength;
+    }
+    else if (!iIsChunked && (iContentLength != kNoContentLengthHeader) &&
+             (ret > iContentLength - iBodyLengthConsumed))
+    {
+        ret = iContentLength - iBodyLengthConsumed;
     }
     return ret;
-#endif
+}
+
+int HttpClient::peek()
+{
+    if (endOfHeadersReached() ? (bodyWindow() <= 0) : !fillRxBuffer())
+    {
+        return -1;
+    }
+    return iRxBuffer[iRxPos];
+}
+
+int HttpClient::read()
+{
+    if (!endOfHeadersReached())
+    {
+        return fillRxBuffer() ? iRxBuffer[iRxPos++] : -1;
+    }
+    if (bodyWindow() <= 0)
+    {
+        // Nothing yet, or we've reached the end of the body.  Don't read on
+        // into whatever follows it
+        return -1;
+    }
+    int ret = iRxBuffer[iRxPos];
+    consumeBody(1);
+    return ret;
 }
 
 int HttpClient::read(uint8_t *buf, size_t size)
 {
-    int ret =iClient->read(buf, size);
-    if (endOfHeadersReached() && iContentLength > 0)
+    if (!endOfHeadersReached())
     {
-        // We're outputting the body now and we've seen a Content-Length header
-        // So keep track of how many bytes are left
-        if (ret >= 0)
-	{
+        int n = fillRxBuffer();
+        if (n == 0)
+        {
+            return -1;
+        }
+        if ((size_t)n > size)
+        {
+            n = size;
+        }
+        memcpy(buf, iRxBuffer + iRxPos, n);
+        iRxPos += n;
+        return n;
+    }
+    if ((iRxPos == iRxLen) && (size >= HTTP_RX_BUFFER_SIZE) && !iIsChunked &&
+        !endOfBodyReached())
+    {
+        // Nothing buffered and a big read, so go straight into the caller's
+        // buffer rather than copying through ours
+        if ((iContentLength != kNoContentLengthHeader) &&
+            ((long)size > iContentLength - iBodyLengthConsumed))
+        {
+            size = iContentLength - iBodyLengthConsumed;
+        }
+        int ret = iClient->read(buf, size);
+        if (ret > 0)
+        {
             iBodyLengthConsumed += ret;
-	}
+        }
+        return ret;
+    }
+    int n = bodyWindow();
+    if (n <= 0)
+    {
+        return -1;
+    }
+    if ((size_t)n > size)
+    {
+        n = size;
+    }
+    memcpy(buf, iRxBuffer + iRxPos, n);
+    consumeBody(n);
+    return n;
+}
+
+int HttpClient::readInPlace(const uint8_t*& aData)
+{
+    if (!endOfHeadersReached())
+    {
+        return HTTP_ERROR_API;
+    }
+    int n = bodyWindow();
+    if (n > 0)
+    {
+        aData = iRxBuffer + iRxPos;
+        consumeBody(n);
+    }
+    return n;
+}
+
+uint8_t HttpClient::connected()
+{
+    // Whatever's in our buffer can still be read, even if the server has
+    // closed the connection
+    return (iRxPos < iRxLen) || iClient->connected();
+}
+
+void HttpClient::parseHeaders()
+{
+    while ((iRxPos < iRxLen) && !endOfHeadersReached())
+    {
+        if (iState == eSkipToEndOfHeader)
+        {
+            // Nothing more of interest on this line, jump to the end of it
+            const uint8_t* eol = (const uint8_t*)memchr(iRxBuffer + iRxPos, '\n', iRxLen - iRxPos);
+            if (!eol)
+            {
+                iRxPos = iRxLen;
+                break;
+            }
+            iRxPos = eol - iRxBuffer;
+        }
+        processHeaderChar(iRxBuffer[iRxPos++]);
     }
-    return ret;
 }
 
 int HttpClient::readHeader()
 {
-    char c = read();
+    int c = read();
 
-    if (endOfHeadersReached())
+    if (endOfHeadersReached() || (c < 0))
     {
         // We've passed the headers, but rather than return an error, we'll just
         // act as a slightly less efficient version of read()
         return c;
     }
 
+    processHeaderChar(c);
+    // And return the character read to whoever wants it
+    return c;
+}
+
+void HttpClient::processHeaderChar(char c)
+{
     // Whilst reading out the headers to whoever wants them, we'll keep an
-    // eye out for the "Content-Length" header
+    // eye out for the ones that tell us how to read the body, and whether the
+    // connection can be reused
     switch(iState)
     {
     case eStatusCodeRead:
         // We're at the start of a line, or somewhere in the middle of reading
-        // the Content-Length prefix
-        if (*iContentLengthPtr == c)
+        // the start of one of the headers in kWatchedHeaders
+        if ((iHeaderMatchIdx == 0) && (c == '\r'))
+        {
+            // We've found a '\r' at the start of a line, so this is probably
+            // the end of the headers
+            iState = eLineStartingCRFound;
+            break;
+        }
+        // Unless this character keeps one of them matching, skip to the end
+        // of the line
+        iState = eSkipToEndOfHeader;
+        for (int i = 0; i < kWatchedHeaderCount; i++)
         {
-            // This character matches, just move along
-            iContentLengthPtr++;
-            if (*iContentLengthPtr == '\0')
+            if (!(iHeaderMatches & (1 << i)))
+            {
+                continue;
+            }
+            if (kWatchedHeaders[i][iHeaderMatchIdx] != tolower(c))
+            {
+                iHeaderMatches &= ~(1 << i);
+            }
+            else if (kWatchedHeaders[i][iHeaderMatchIdx+1] != '\0')
             {
-                // We've reached the end of the prefix
+                // This character matches, just move along
+                iState = eStatusCodeRead;
+            }
+            else if (i == 0)
+            {
+                // We've reached the end of the Content-Length prefix
                 iState = eReadingContentLength;
                 // Just in case we get multiple Content-Length headers, this
                 // will ensure we just get the value of the last one
                 iContentLength = 0;
             }
+            else if (i == 1)
+            {
+                iIsChunked = true;
+            }
+            else
+            {
+                iConnectionClose = true;
+            }
         }
-        else if ((iContentLengthPtr == kContentLengthPrefix) && (c == '\r'))
-        {
-            // We've found a '\r' at the start of a line, so this is probably
-            // the end of the headers
-            iState = eLineStartingCRFound;
-        }
-        else
-        {
-            // This isn't the Content-Length header, skip to the end of the line
-            iState = eSkipToEndOfHeader;
-        }
+        iHeaderMatchIdx++;
         break;
     case eReadingContentLength:
         if (isdigit(c))
@@ -555,11 +1145,7 @@ int HttpClient::readHeader()
     {
         // We've got to the end of this line, start processing again
         iState = eStatusCodeRead;
-        iContentLengthPtr = kContentLengthPrefix;
+        iHeaderMatches = (1 << kWatchedHeaderCount) - 1;
+        iHeaderMatchIdx = 0;
     }
-    // And return the character read to whoever wants it
-    return c;
 }
-
-
-
@@ -30,9 +30,36 @@ static const int HTTP_ERROR_INVALID_RESPONSE =-4;
 #define HTTP_METHOD_POST   "POST"
 #define HTTP_METHOD_PUT    "PUT"
 #define HTTP_METHOD_DELETE "DELETE"
+#define HTTP_METHOD_HEAD   "HEAD"
 #define HTTP_HEADER_CONTENT_LENGTH "Content-Length"
 #define HTTP_HEADER_CONNECTION     "Connection"
 #define HTTP_HEADER_USER_AGENT     "User-Agent"
+#define HTTP_HEADER_TRANSFER_ENCODING "Transfer-Encoding"
+
+// Size of the buffer that the response is read into.  Data is pulled from
+// the client a block at a time rather than a byte at a time, which saves a
+// transaction with the network hardware for every byte.  Make it smaller to
+// save RAM, or larger for fewer, bigger reads
+#ifndef HTTP_RX_BUFFER_SIZE
+#define HTTP_RX_BUFFER_SIZE 64
+#endif
+// Uncomment this if the client's read(buf, size) is unreliable (the WiFi
+// library's was, in early versions) to fill the buffer a byte at a time
+//#define HTTP_SINGLE_BYTE_READS
+// Size of the buffer that a chunked request body is gathered into, and so
+// the largest chunk sent.  At most 255
+#ifndef HTTP_TX_BUFFER_SIZE
+#define HTTP_TX_BUFFER_SIZE 64
+#endif
+#if HTTP_TX_BUFFER_SIZE > 255
+#error HTTP_TX_BUFFER_SIZE must be 255 or less
+#endif
+// Longest server name (plus its terminating 0) that is remembered to
+// reuse a keep-alive connection.  Connections to longer names still
+// work, but aren't reused
+#ifndef HTTP_SERVER_NAME_SIZE
+#define HTTP_SERVER_NAME_SIZE 32
+#endif
 
 class HttpClient : public Client
 {
@@ -53,12 +80,15 @@ public:
     /** Start a more complex request.
         Use this when you need to send additional headers in the request,
         but you will also need to call endRequest() when you are finished.
+        In keep-alive mode, whatever is left of the previous response is
+        read past first.
     */
     void beginRequest();
 
     /** End a more complex request.
         Use this when you need to have sent additional headers in the request,
-        but you will also need to call beginRequest() at the start.
+        but you will also need to call beginRequest() at the start.  This
+        also ends a body started with beginChunkedBody().
     */
     void endRequest();
 
@@ -311,6 +341,15 @@ public:
     */
     void sendBasicAuth(const char* aUser, const char* aPassword);
 
+    /** Finish the headers and start a body whose length isn't known up
+      front, so there's no need to work out the Content-Length by
+      formatting it twice.  Whatever is then written or printed is gathered
+      into chunks of up to HTTP_TX_BUFFER_SIZE bytes and sent with chunked
+      transfer-encoding.  Call endRequest() once the body has been sent.
+      The server must understand HTTP/1.1, as chunked bodies are new there.
+    */
+    void beginChunkedBody();
+
     /** Finish sending the HTTP request.  This basically just sends the blank
       line to signify the end of the request
     */
@@ -339,13 +378,29 @@ public:
     */
     int skipResponseHeaders();
 
+    /** Read past whatever is left of the response body.
+      @return HTTP_SUCCESS if successful, else an error code
+    */
+    int skipResponseBody();
+
+    /** Finish with the current response.
+      In keep-alive mode this reads past whatever is left of the response, so
+      the connection is ready for the next request.  The connection is closed
+      instead if it can't be reused: the server asked for that, or the body
+      had neither a Content-Length nor chunked encoding so it only ends when
+      the server closes.  Without keep-alive this is the same as stop().
+      @return HTTP_SUCCESS if successful, else an error code
+    */
+    int endResponse();
+
     /** Test whether all of the response headers have been consumed.
       @return true if we are now processing the response body, else false
     */
     bool endOfHeadersReached() { return (iState == eReadingBody); };
 
     /** Test whether the end of the body has been reached.
-      Only works if the Content-Length header was returned by the server
+      Only works if the Content-Length header was returned by the server, or
+      the body is chunked
       @return true if we are now at the end of the body, else false
     */
     bool endOfBodyReached();
@@ -358,26 +413,51 @@ public:
     */
     int contentLength() { return iContentLength; };
 
+    /** Keep the connection open between requests.
+      With keep-alive on, the next request to the same server and port
+      reuses the open connection rather than connecting again; the previous
+      response is read past first if need be (see endResponse()).  Server
+      names longer than HTTP_SERVER_NAME_SIZE - 1 always reconnect.  Requests
+      can also be pipelined: start several, then read the responses in the
+      same order, calling responseStatusCode() for each.  Call stop() to
+      close the connection.
+      @param aKeepAlive true to keep connections open, false (the default)
+                        to close them after each response
+    */
+    void setKeepAlive(bool aKeepAlive) { iKeepAlive = aKeepAlive; };
+    bool keepAlive() { return iKeepAlive; };
+
     // Inherited from Print
     // Note: 1st call to these indicates the user is sending the body, so if need
-    // Note: be we should finish the header first
-    virtual size_t write(uint8_t aByte) { if (iState < eRequestSent) { finishHeaders(); }; return iClient-> write(aByte); };
-    virtual size_t write(const uint8_t *aBuffer, size_t aSize) { if (iState < eRequestSent) { finishHeaders(); }; return iClient->write(aBuffer, aSize); };
+    // Note: be we should finish the header first.  After beginChunkedBody()
+    // they're gathered into chunks rather than sent straight away
+    virtual size_t write(uint8_t aByte);
+    virtual size_t write(const uint8_t *aBuffer, size_t aSize);
     // Inherited from Stream
-    virtual int available() { return iClient->available(); };
+    // Once the headers have been read these only see the body of the
+    // current response, so they never run on into the next one
+    virtual int available();
     /** Read the next byte from the server.
       @return Byte read or -1 if there are no bytes available.
     */
     virtual int read();
     virtual int read(uint8_t *buf, size_t size);
-    virtual int peek() { return iClient->peek(); };
+    virtual int peek();
+    /** Read whatever body data is buffered without copying it.
+      aData is pointed at the data inside HttpClient's own buffer, which
+      stays valid until the next call that reads from the response.
+      @param aData Set to point to the data read, if any
+      @return Number of bytes read, 0 if there's none yet, -1 at the end of
+              the body, or HTTP_ERROR_API if the headers haven't been read
+    */
+    int readInPlace(const uint8_t*& aData);
     virtual void flush() { return iClient->flush(); };
 
     // Inherited from Client
     virtual int connect(IPAddress ip, uint16_t port) { return iClient->connect(ip, port); };
     virtual int connect(const char *host, uint16_t port) { return iClient->connect(host, port); };
     virtual void stop();
-    virtual uint8_t connected() { return iClient->connected(); };
+    virtual uint8_t connected();
     virtual operator bool() { return bool(iClient); };
     virtual uint32_t httpResponseTimeout() { return iHttpResponseTimeout; };
     virtual void setHttpResponseTimeout(uint32_t timeout) { iHttpResponseTimeout = timeout; };
@@ -386,6 +466,57 @@ protected:
     */
     void resetState();
 
+    /** Reset the per-response state, ready to read the next status line
+    */
+    void resetResponseState();
+
+    /** Connect to the server, or reuse the open connection if keep-alive is
+      on and it's to the same place
+      @param aServerName Name of the server to connect to, or NULL to connect
+                         to aServerAddress
+      @return true if we're connected, else false
+    */
+    bool connectTo(const char* aServerName, const IPAddress& aServerAddress, uint16_t aServerPort);
+
+    /** Check that the open connection is to the given server, not just one
+      with the same hash.  Parameters as for connectTo()
+      @return true if it's the same server name (or address) and port
+    */
+    bool isConnectedTo(const char* aServerName, const IPAddress& aServerAddress, uint16_t aServerPort);
+
+    /** Consume chunked-encoding framing until there's chunk data to read.
+      Never waits for data to arrive.
+      @return true if there's chunk data ready, false if the body has ended
+              or we need more data to find out
+    */
+    bool chunkAvailable();
+
+    /** Make sure there's something in the receive buffer, with one block
+      read from the client if it's empty.  Never waits for data to arrive.
+      @return Number of bytes in the buffer
+    */
+    int fillRxBuffer();
+
+    /** Work out how much of the buffer can be read as body data now,
+      stopping at the end of the current chunk or of the body.
+      @return Number of bytes, 0 if there's none yet, or -1 at the end of
+              the body
+    */
+    int bodyWindow();
+
+    /** Mark aLength bytes of the buffer as read by the user
+    */
+    void consumeBody(int aLength);
+
+    /** Run the header state machine over everything in the buffer, up to
+      the end of the headers
+    */
+    void parseHeaders();
+
+    /** Run the header state machine over one character of the headers
+    */
+    void processHeaderChar(char c);
+
     /** Send the first part of the request and the initial headers.
       @param aServerName Name of the server being connected to.  If NULL, the
                          "Host" header line won't be sent
@@ -409,14 +540,20 @@ protected:
     */
     void finishHeaders();
 
+    /* Send whatever is gathered in iTxBuffer as one chunk of the body
+    */
+    void sendChunk();
+
     // Number of milliseconds that we wait each time there isn't any data
     // available to be read (during status code and header processing)
-    static const int kHttpWaitForDataDelay = 1000;
+    static const int kHttpWaitForDataDelay = 10;
     // Number of milliseconds that we'll wait in total without receiveing any
     // data before returning HTTP_ERROR_TIMED_OUT (during status code and header
     // processing)
     static const int kHttpResponseTimeout = 30*1000;
-    static const char* kContentLengthPrefix;
+    // Response headers that readHeader() watches for, in lower case
+    static const char* kWatchedHeaders[];
+    static const int kWatchedHeaderCount = 3;
     typedef enum {
         eIdle,
         eRequestStarted,
@@ -428,6 +565,15 @@ protected:
         eLineStartingCRFound,
         eReadingBody
     } tHttpState;
+    typedef enum {
+        eChunkSize,
+        eChunkExtension,
+        eChunkData,
+        eChunkDataEnd,
+        eChunkTrailer,
+        eChunkTrailerLine,
+        eChunkDone
+    } tChunkState;
     // Ethernet client we're using
     Client* iClient;
     // Current state of the finite-state-machine
@@ -438,8 +584,43 @@ protected:
     int iContentLength;
     // How many bytes of the response body have been read by the user
     int iBodyLengthConsumed;
-    // How far through a Content-Length header prefix we are
-    const char* iContentLengthPtr;
+    // Which of kWatchedHeaders the current header line still matches (one
+    // bit each), and how far through them we are
+    uint8_t iHeaderMatches;
+    uint8_t iHeaderMatchIdx;
+    // Set if the response body uses chunked transfer-encoding
+    bool iIsChunked;
+    tChunkState iChunkState;
+    // Bytes left in the current chunk, or the chunk size being read
+    long iChunkLength;
+    // Set if the connection is to be kept open between requests
+    bool iKeepAlive;
+    // Set if the connection can't be used for another request once this
+    // response is done
+    bool iConnectionClose;
+    // Set if the last request was a HEAD, whose response has no body
+    bool iHeadRequest;
+    // Requests that have been sent but whose responses haven't been started
+    uint8_t iRequestsPending;
+    // Where the connection is open to, so we can tell whether it can be
+    // reused: the server name (empty if we connected by address) or
+    // address, and port.  iServerId is a hash of them, compared first, and
+    // 0 when not connected.  iServerPort is 0 if the name didn't fit
+    uint16_t iServerId;
+    char iServerName[HTTP_SERVER_NAME_SIZE];
+    IPAddress iServerAddress;
+    uint16_t iServerPort;
+    // Data read from the client but not yet consumed, which is
+    // iRxBuffer[iRxPos] up to iRxBuffer[iRxLen]
+    uint8_t iRxBuffer[HTTP_RX_BUFFER_SIZE];
+    uint16_t iRxPos;
+    uint16_t iRxLen;
+    // Set while sending a chunked request body
+    bool iChunkedBody;
+    // The chunk of the request body being gathered, with room in front for
+    // its size line and after it for the CRLF that ends it
+    uint8_t iTxBuffer[4 + HTTP_TX_BUFFER_SIZE + 2];
+    uint8_t iTxLen;
     // Address of the proxy to use, if we're using one
     IPAddress iProxyAddress;
     uint16_t iProxyPort;
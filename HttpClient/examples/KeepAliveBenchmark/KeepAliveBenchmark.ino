@@ -0,0 +1,104 @@
+// Released under Apache License, version 2.0
+//
+// Measures how many requests per second HttpClient manages against a server
+// on the local network: with a new connection for every request, with one
+// kept-alive connection, and with requests pipelined four at a time on it.
+// Run tests/server.py on a computer on the same network and set kServer to
+// its address.  Results go to the serial port.
+
+#include <SPI.h>
+#include <HttpClient.h>
+#include <Ethernet.h>
+#include <EthernetClient.h>
+
+// Address and port of the machine running tests/server.py
+IPAddress kServer(192, 168, 1, 10);
+const uint16_t kPort = 8000;
+const char kPath[] = "/v2/feeds/15552.csv";
+
+// How many requests to time in each mode
+const int kRequests = 40;
+// How many requests to send before reading the responses, when pipelining
+const int kPipelineDepth = 4;
+
+byte mac[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED };
+
+EthernetClient c;
+HttpClient http(c);
+
+// Read the status, headers and body of the next response
+// Returns true if it was a 200 response
+bool readResponse()
+{
+  if (http.responseStatusCode() != 200)
+  {
+    return false;
+  }
+  if (http.skipResponseHeaders() != HTTP_SUCCESS)
+  {
+    return false;
+  }
+  return (http.skipResponseBody() == HTTP_SUCCESS);
+}
+
+void runTest(const char* aName, bool aKeepAlive, int aDepth)
+{
+  int errors = 0;
+  http.setKeepAlive(aKeepAlive);
+
+  unsigned long start = millis();
+  for (int i = 0; i < kRequests; i += aDepth)
+  {
+    for (int j = 0; j < aDepth; j++)
+    {
+      if (http.get(kServer, NULL, kPort, kPath) != HTTP_SUCCESS)
+      {
+        errors++;
+      }
+    }
+    for (int j = 0; j < aDepth; j++)
+    {
+      if (!readResponse())
+      {
+        errors++;
+      }
+    }
+    // Closes the connection, unless it's being kept alive
+    http.endResponse();
+  }
+  unsigned long elapsed = millis() - start;
+  http.stop();
+
+  Serial.print(aName);
+  Serial.print(": ");
+  Serial.print(kRequests);
+  Serial.print(" requests in ");
+  Serial.print(elapsed);
+  Serial.print(" ms, ");
+  Serial.print(kRequests * 1000.0 / elapsed);
+  Serial.print(" requests/s, ");
+  Serial.print(errors);
+  Serial.println(" errors");
+}
+
+void setup()
+{
+  // initialize serial communications at 9600 bps:
+  Serial.begin(9600);
+
+  while (Ethernet.begin(mac) != 1)
+  {
+    Serial.println("Error getting IP address via DHCP, trying again...");
+    delay(15000);
+  }
+}
+
+void loop()
+{
+  runTest("New connection each time", false, 1);
+  runTest("Keep-alive", true, 1);
+  runTest("Keep-alive, pipelined", true, kPipelineDepth);
+  Serial.println();
+
+  delay(10000);
+}
@@ -0,0 +1,96 @@
+# HttpClient test server
+# Released under Apache License, version 2.0
+#
+# A small HTTP/1.1 server to point the HttpClient tests and benchmarks at.
+# It listens by default on port 8000 (or the port given as the first command
+# line parameter), answers every GET, PUT or POST with a short text body and
+# keeps connections open unless the client asks it not to, so it handles
+# keep-alive and pipelined requests, and request bodies either with a
+# Content-Length or chunked.  Each connection's request count is
+# printed when it closes.  Add "chunked" after the port to send the response
+# bodies with chunked transfer-encoding rather than a Content-Length.  A
+# "lines=N" query parameter makes the body N lines long rather than four.
+# Must be terminated by hitting ctrl-c to kill the process!
+
+import socket
+import socketserver
+import sys
+
+SERVER_PORT = 8000
+if len(sys.argv) > 1:
+    SERVER_PORT = int(sys.argv[1])
+CHUNKED = 'chunked' in sys.argv[2:]
+
+LINE = b'sensor_reading,2013-01-01T00:00:00.000000Z,123.45\r\n'
+
+
+class Handler(socketserver.StreamRequestHandler):
+    def setup(self):
+        socketserver.StreamRequestHandler.setup(self)
+        # Send each response straight away, even with earlier ones unacked
+        self.connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def read_chunked_body(self):
+        while True:
+            size = int(self.rfile.readline().split(b';')[0], 16)
+            if size == 0:
+                break
+            self.rfile.read(size + 2)
+        # Skip any trailer, up to the blank line that ends it
+        while self.rfile.readline() not in (b'\r\n', b'\n', b''):
+            pass
+
+    def handle(self):
+        requests = 0
+        while True:
+            request_line = self.rfile.readline()
+            if not request_line:
+                break
+            headers = {}
+            while True:
+                line = self.rfile.readline()
+                if line in (b'\r\n', b'\n', b''):
+                    break
+                name, _, value = line.decode('latin-1').partition(':')
+                headers[name.strip().lower()] = value.strip()
+            if headers.get('transfer-encoding', '').lower() == 'chunked':
+                self.read_chunked_body()
+            else:
+                length = int(headers.get('content-length', 0))
+                if length:
+                    self.rfile.read(length)
+            requests += 1
+            query = request_line.split()[1].partition(b'?')[2] if b' ' in request_line else b''
+            lines = 4
+            for param in query.split(b'&'):
+                if param.startswith(b'lines='):
+                    lines = int(param[6:])
+            body = LINE * lines
+
+            close = headers.get('connection', '').lower() == 'close'
+            out = [b'HTTP/1.1 200 OK\r\n', b'Content-Type: text/plain\r\n']
+            if close:
+                out.append(b'Connection: close\r\n')
+            if CHUNKED:
+                out.append(b'Transfer-Encoding: chunked\r\n\r\n')
+                half = len(body) // 2
+                for part in (body[:half], body[half:]):
+                    out.append(b'%x\r\n' % len(part) + part + b'\r\n')
+                out.append(b'0\r\n\r\n')
+            else:
+                out.append(b'Content-Length: %d\r\n\r\n' % len(body))
+                out.append(body)
+            self.wfile.write(b''.join(out))
+            self.wfile.flush()
+            if close:
+                break
+        print('%s:%d %d requests' % (self.client_address[0], self.client_address[1], requests))
+        sys.stdout.flush()
+
+
+class Server(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+Server(('', SERVER_PORT), Handler).serve_forever()
@@ -0,0 +1,108 @@
+/*
+  Copyright (c) 2012 Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+  Example: Asynchronous Logger
+ 
+  This code module samples analog pin 0 every 10 milliseconds and stores
+  the average every 10 seconds, without missing samples while the server
+  answers. The connect and the INSERTs are asynchronous: they are sent
+  and then carried on by calling poll() from the loop, which never waits,
+  and the callback is told how they went. If the connection is lost it
+  connects again.
+ 
+  You will need to create a table on your MySQL server as follows:
+ 
+  CREATE TABLE `test`.`readings` (
+    `id` int(11) NOT NULL AUTO_INCREMENT,
+    `pin` int(11) DEFAULT NULL,
+    `value` float DEFAULT NULL,
+    PRIMARY KEY (`id`)
+  )
+ 
+  Other changes needed:
+    - change the server_addr below to the address of your MySQL server
+    - change user, password to the user and password for your MySQL server
+*/
+#include <SPI.h>
+#include <Ethernet.h>
+#include <sha1.h>
+#include <avr/pgmspace.h>
+#include "mysql.h"
+
+byte mac_addr[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED };
+IPAddress server_addr(192, 168, 0, 7); 
+char user[] = "root";
+char password[] = "root";
+
+#define sample_delay 10       // milliseconds between samples
+#define store_delay  10000    // milliseconds between stored averages
+
+Connector my_conn;        // The Connector/Arduino reference
+
+boolean connected = false;
+unsigned long last_sample;
+unsigned long last_store;
+long sum = 0;
+int samples = 0;
+
+// Called from poll() when a connect or INSERT is done
+void done(Connector *conn, int status) {
+  if (status == ASYNC_OK) {
+    connected = true;
+    return;
+  }
+  Serial.print("Failed, status ");
+  Serial.println(status);
+  if (!conn->is_connected())
+    connected = false;
+}
+
+void setup() {  
+  Ethernet.begin(mac_addr);
+  Serial.begin(115200);
+  delay(1000);
+  last_sample = last_store = millis();
+}
+
+void loop() {  
+  // Carry on with whatever the connector is doing
+  my_conn.poll();
+
+  if (millis() - last_sample >= sample_delay) {
+    last_sample += sample_delay;
+    sum += analogRead(0);
+    samples++;
+  }
+
+  if (my_conn.is_busy())
+    return;
+  if (!connected) {
+    Serial.println("Connecting...");
+    if (!my_conn.mysql_connect_async(server_addr, 3306, user, password,
+                                     done))
+      delay(1000);  // try again in a bit
+  } else if (millis() - last_store >= store_delay) {
+    char query[64];
+    char num[10];
+    last_store += store_delay;
+    dtostrf(sum * 5.0 / 1023 / samples, 1, 3, num);
+    sprintf(query, "INSERT INTO test.readings VALUES (NULL, 0, %s)", num);
+    sum = 0;
+    samples = 0;
+    if (!my_conn.cmd_query_async(query, done))
+      connected = false;
+  }
+}
@@ -0,0 +1,104 @@
+/*
+  Copyright (c) 2012 Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+  Example: Batch Logger
+ 
+  This code module logs a reading from analog pin 0 every second, without
+  a round trip to the server for every reading. Readings are batched up
+  into multi-row INSERT statements, sent when the batch buffer is full or
+  the oldest reading has waited a minute.
+
+  Change USE_PREPARED to 1 to use a prepared statement instead: the
+  server parses the INSERT once, and each reading is then sent in binary
+  with no formatting or parsing.
+ 
+  You will need to create a table on your MySQL server as follows:
+ 
+  CREATE TABLE `test`.`readings` (
+    `id` int(11) NOT NULL AUTO_INCREMENT,
+    `pin` int(11) DEFAULT NULL,
+    `value` float DEFAULT NULL,
+    PRIMARY KEY (`id`)
+  )
+ 
+  Other changes needed:
+    - change the server_addr below to the address of your MySQL server
+    - change user, password to the user and password for your MySQL server
+*/
+#include <SPI.h>
+#include <Ethernet.h>
+#include <sha1.h>
+#include <avr/pgmspace.h>
+#include "mysql.h"
+
+#define USE_PREPARED 0
+
+byte mac_addr[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED };
+IPAddress server_addr(192, 168, 0, 7); 
+char user[] = "root";
+char password[] = "root";
+
+#define read_delay 1000       // 1 second between readings
+#define max_age    60000UL    // longest a reading waits to be sent
+
+Connector my_conn;        // The Connector/Arduino reference
+
+#if USE_PREPARED
+stmt_struct insert_stmt;
+#else
+char batch_buffer[200];
+#endif
+
+void setup() {  
+  Ethernet.begin(mac_addr);
+  Serial.begin(115200);
+  delay(1000);
+  Serial.println("Connecting...");
+  if (!my_conn.mysql_connect(server_addr, 3306, user, password)) {
+    Serial.println("Connection failed.");
+    return;
+  }
+#if USE_PREPARED
+  if (!my_conn.stmt_prepare("INSERT INTO test.readings VALUES (NULL, ?, ?)",
+                            &insert_stmt))
+    Serial.println("Prepare failed.");
+#else
+  my_conn.batch_begin(batch_buffer, sizeof(batch_buffer),
+                      "INSERT INTO test.readings VALUES ", max_age);
+#endif
+}
+
+void loop() {  
+  float value = analogRead(0) * 5.0 / 1023;
+#if USE_PREPARED
+  param_struct params[2];
+  params[0].type = MYSQL_TYPE_LONG;
+  params[0].l = 0;
+  params[1].type = MYSQL_TYPE_FLOAT;
+  params[1].f = value;
+  my_conn.stmt_execute(&insert_stmt, params);
+#else
+  char row[24];
+  char num[10];
+  dtostrf(value, 1, 3, num);
+  sprintf(row, "(NULL, 0, %s)", num);
+  // If the rows couldn't be sent they're kept and tried again later, but
+  // once the batch buffer fills up new readings are lost
+  if (!my_conn.batch_add(row))
+    Serial.println("Batch insert failed.");
+#endif
+  delay(read_delay);
+}
@@ -0,0 +1,94 @@
+/*
+  Copyright (c) 2012 Oracle and/or its affiliates. All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; version 2 of the License.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+  Example: Result Set Benchmark
+ 
+  This code module times reading a result set: the rows per second, and
+  the most heap used while reading it. Point it at the stand-in server in
+  the tests folder (python tests/server.py) which answers the query
+  below with as many rows as the LIMIT asks for, or at a real server with
+  a table of your own.
+ 
+  Other changes needed:
+    - change the server_addr below to the address of the server
+    - change user, password to the user and password for your MySQL server
+*/
+#include <SPI.h>
+#include <Ethernet.h>
+#include <sha1.h>
+#include <avr/pgmspace.h>
+#include "mysql.h"
+
+byte mac_addr[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED };
+IPAddress server_addr(192, 168, 0, 7); 
+char user[] = "root";
+char password[] = "root";
+
+const char query[] = "SELECT * FROM test.bench LIMIT 200";
+
+Connector my_conn;        // The Connector/Arduino reference
+
+extern char *__brkval;
+extern char __heap_start;
+
+// Bytes of heap in use: from the start of the heap to its current top
+int heap_used() {
+  return __brkval ? __brkval - &__heap_start : 0;
+}
+
+void setup() {  
+  Ethernet.begin(mac_addr);
+  Serial.begin(115200);
+  delay(1000);
+  Serial.println("Connecting...");
+  if (!my_conn.mysql_connect(server_addr, 3306, user, password))
+    Serial.println("Connection failed.");
+}
+
+void loop() {  
+  field_struct field;
+  char *value;
+  int rows = 0;
+  int heap_start = heap_used();
+  int heap_peak = heap_start;
+
+  unsigned long start = millis();
+  if (my_conn.cmd_query(query)) {
+    // The field and column strings are read in place from the packet
+    // buffer, so there's nothing to free(). get_field() would copy the
+    // field strings to the heap, for you to free().
+    while (my_conn.get_field_inplace(&field) != EOF_PACKET)
+      ;
+    while (my_conn.get_row() != EOF_PACKET) {
+      while (my_conn.get_next_column(&value))
+        ;
+      rows++;
+      if (heap_used() > heap_peak)
+        heap_peak = heap_used();
+    }
+  }
+  unsigned long elapsed = millis() - start;
+
+  Serial.print(rows);
+  Serial.print(" rows in ");
+  Serial.print(elapsed);
+  Serial.print(" ms, ");
+  Serial.print(rows * 1000.0 / elapsed);
+  Serial.print(" rows/s, peak heap +");
+  Serial.print(heap_peak - heap_start);
+  Serial.println(" bytes");
+  delay(5000);
+}
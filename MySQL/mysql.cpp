@@ -32,7 +32,16 @@
 #include <sha1.h>
 
 #define MAX_CONNECT_ATTEMPTS 3
-#define MAX_TIMEOUT          10
+#define MAX_TIMEOUT          5000  // milliseconds
+#define WAIT_DELAY           2     // milliseconds between checks for data
+
+// States of an asynchronous connect or query (see poll())
+#define ASYNC_IDLE           0
+#define ASYNC_HANDSHAKE      1     // waiting for the server's handshake
+#define ASYNC_AUTH           2     // waiting for the Ok to our authentication
+#define ASYNC_QUERY          3     // waiting for the response to a query
+#define ASYNC_FIELDS         4     // skipping the field packets
+#define ASYNC_ROWS           5     // reading the rows of a result set
 
 // Begin public methods
 
@@ -57,7 +66,7 @@ boolean Connector::mysql_connect(IPAddress server, int port,
 {
   int connected = 0;
   int i = -1;
-  ok_packet *packet;
+  ok_packet packet;
   
   // Retry up to MAX_CONNECT_ATTEMPTS times 1 second apart.
   do {
@@ -67,17 +76,16 @@ boolean Connector::mysql_connect(IPAddress server, int port,
   } while (i < MAX_CONNECT_ATTEMPTS && !connected);
 
   if (connected) {
-    read_packet();
+    if (!read_packet())
+      return false;
     parse_handshake_packet();
     send_authentication_packet(user, password);
-    read_packet();
-    packet = (ok_packet *)malloc(sizeof(ok_packet));
-    if (parse_ok_packet(packet) != 0) {
-      free(packet);
-      parse_error_packet();
+    if (!read_packet() || parse_ok_packet(&packet) != 0) {
+      free(server_version);
+      if (buffer[4] == ERROR_PACKET)
+        parse_error_packet();
       return false;
     }
-    free(packet);
     Serial.print("Connected to server version ");
     Serial.print(server_version);
     Serial.println(".");
@@ -92,8 +100,8 @@ boolean Connector::mysql_connect(IPAddress server, int port,
  * cmd_query - Execute a SQL statement
  *
  * This method executes the query specified as a character array that is
- * located in data memory. It copies the query to the local buffer then
- * calls the run_query() method to execute the query.
+ * located in data memory. It calls the run_query() method to send the
+ * query straight from where it is and execute it.
  * 
  * If a result set is available after the query executes, the field
  * packets and rows can be read separately using the get_field() and
@@ -107,16 +115,8 @@ boolean Connector::cmd_query(const char *query)
 {
   int query_len = (int)strlen(query);
   
-  if (buffer != NULL)
-    free(buffer);
-    
-  buffer = (byte *)malloc(query_len+5);
-
-  // Write query to packet
-  memcpy(&buffer[5], query, query_len);
-
   // Send the query
-  return run_query(query_len);
+  return run_query(query, query_len, false);
 }
 
 
@@ -124,8 +124,8 @@ boolean Connector::cmd_query(const char *query)
  * cmd_query_P - Execute a SQL statement
  *
  * This method executes the query specified as a character array that is
- * located in program memory. It copies the query to the local buffer then
- * calls the run_query() method to execute the query.
+ * located in program memory. It calls the run_query() method, which
+ * copies the query through the packet buffer a block at a time.
  * 
  * If a result set is available after the query executes, the field
  * packets and rows can be read separately using the get_field() and
@@ -139,17 +139,8 @@ boolean Connector::cmd_query_P(const char *query)
 {
   int query_len = (int)strlen_P(query);
   
-  if (buffer != NULL)
-    free(buffer);
-    
-  buffer = (byte *)malloc(query_len+5);
-
-  // Write query to packet
-  for (int c = 0; c < query_len; c++)
-    buffer[c+5] = pgm_read_byte_near(query+c);
-
   // Send the query
-  return run_query(query_len);
+  return run_query(query, query_len, true);
 }
 
 
@@ -176,30 +167,48 @@ boolean Connector::cmd_query_P(const char *query)
  * 2                          (filler), always 0x00
  * n (Length Coded Binary)    default
  * 
- * Note: the sum of all db, column, and field names must be < 255 in length
+ * Note: the whole field packet must fit in the packet buffer. The db,
+ *       table and name strings are copied to the heap, so you must free()
+ *       them. get_field_inplace() doesn't copy them.
  * 
+ * Returns integer - EOF_PACKET after the last field (or if the server
+ *                   stopped responding), TRUNCATED_PACKET if the field
+ *                   packet was cut short (the strings are then cut short
+ *                   too), else 0
 */
 int Connector::get_field(field_struct *fs) {
-  int len_bytes;
-  int len;
-  int offset;
+  int res = get_field_inplace(fs);
+
+  if (res != EOF_PACKET) {
+    fs->db = strdup(fs->db ? fs->db : "");
+    fs->table = strdup(fs->table ? fs->table : "");
+    fs->name = strdup(fs->name ? fs->name : "");
+  }
+  return res;
+}
+
+
+/**
+ * get_field_inplace - Read a field from the server, without copying it
+ *
+ * This is get_field() with the db, table and name strings left in the
+ * packet buffer (see read_string()) rather than copied to the heap. So
+ * they're only good until the next packet is read, and mustn't be freed.
+ * A string the packet was cut short before is NULL.
+ *
+ * Returns integer - as for get_field()
+*/
+int Connector::get_field_inplace(field_struct *fs) {
+  int offset = 4;
   
   // Read field packets until EOF
-  read_packet();
-  if (buffer[4] != EOF_PACKET) {
-    // calculate location of db
-    len_bytes = get_lcb_len(4);
-    len = read_int(4, len_bytes);
-    offset = 4+len_bytes+len;
+  if (read_packet() && buffer[4] != EOF_PACKET) {
+    read_string(&offset); // skip catalog
     fs->db = read_string(&offset);
-    // get table
     fs->table = read_string(&offset);
-    // calculate location of name
-    len_bytes = get_lcb_len(offset);
-    len = read_int(offset, len_bytes);
-    offset += len_bytes+len;
+    read_string(&offset); // skip org_table
     fs->name = read_string(&offset);
-    return 0;
+    return packet_truncated ? TRUNCATED_PACKET : 0;
   }
   return EOF_PACKET;
 }
@@ -220,17 +229,43 @@ int Connector::get_field(field_struct *fs) {
  * Note: each column is store as a length coded string concatenated
  *       as a single stream
  *
- * Returns integer - EOF_PACKET if no more rows, 0 if more rows available
+ * Use get_next_column() to read the column values of the row.
+ *
+ * Returns integer - EOF_PACKET if no more rows (or the server stopped
+ *                   responding), TRUNCATED_PACKET if the row didn't fit
+ *                   in the packet buffer (the columns that did can still
+ *                   be read, the last of them cut short), else 0
 */
 int Connector::get_row() {  
   // Read row packets
-  read_packet();
-  if (buffer[4] != EOF_PACKET)
-    return 0;
+  boolean read = read_packet();
+  row_offset = 4;
+  if (read && buffer[4] != EOF_PACKET)
+    return packet_truncated ? TRUNCATED_PACKET : 0;
   return EOF_PACKET;
 }
 
 
+/**
+ * get_next_column - Read the next column value of the current row
+ *
+ * This is a cursor over the row read by get_row(). Each call returns the
+ * next column value as a null-terminated string. The string is made in
+ * place in the packet buffer rather than copied to the heap, so it is
+ * only good until the next row (or any other packet) is read.
+ *
+ * value[out]      set to the column value, or to NULL if it is SQL NULL
+ *
+ * Returns boolean - True = a column was read, False = no more columns
+*/
+boolean Connector::get_next_column(char **value) {
+  if (row_offset >= packet_len+4)
+    return false;
+  *value = read_string(&row_offset);
+  return true;
+}
+
+
 /**
  * show_results - Show a result set from the server via Serial.print
  *
@@ -277,25 +312,20 @@ int Connector::get_row() {
 */
 void Connector::show_results() {
   char *str;
-  int offset; 
   int num_fields = buffer[4]; // From result header packet
   int res = 0;
   int rows = 0;
   
   for (int f = 0; f < num_fields; f++) {
-    field_struct *field = (field_struct *)malloc(sizeof(field_struct));
-    res = get_field(field);
+    field_struct field;
+    res = get_field_inplace(&field);
     if (res == EOF_PACKET) {
       Serial.println("Bad mojo. EOF found.");
       return;
     }
-    Serial.print(field->name);
+    Serial.print(field.name ? field.name : "?");
     if (f < num_fields-1)
       Serial.print(',');
-    free(field->db);
-    free(field->table);
-    free(field->name);
-    free(field);
   }
   Serial.println();      
   read_packet(); // EOF packet
@@ -306,14 +336,13 @@ void Connector::show_results() {
     if (res != EOF_PACKET) {
       rows++;
       // print column data
-      offset = 4;
-      for (int f = 0; f < num_fields; f++) {
-        str = read_string(&offset);
-        Serial.print(str);
-        if (f < num_fields-1)
+      for (int f = 0; get_next_column(&str); f++) {
+        if (f > 0)
           Serial.print(',');
-        free(str);
+        Serial.print(str ? str : "NULL");
       }
+      if (res == TRUNCATED_PACKET)
+        Serial.print("...");
       Serial.println();
     }
   } while (res != EOF_PACKET);
@@ -323,6 +352,487 @@ void Connector::show_results() {
   Serial.println(" rows in result.");
 }
 
+/**
+ * batch_begin - Start batching rows into multi-row INSERT statements
+ *
+ * Rather than run an INSERT for every row, with a round trip to the
+ * server and a statement for it to parse each time, rows given to
+ * batch_add() are gathered into one INSERT with many rows. It is sent
+ * when the next row won't fit in the batch buffer, when the first row
+ * waiting has waited max_age milliseconds, or when batch_flush() is
+ * called.
+ *
+ * The batch buffer is yours, so it only takes up memory if you use it.
+ * It must stay put for as long as you're batching.
+ *
+ * For example:
+ *
+ *   char batch_buffer[200];
+ *   my_conn.batch_begin(batch_buffer, sizeof(batch_buffer),
+ *                       "INSERT INTO test.temp VALUES ", 60000);
+ *   ...
+ *   my_conn.batch_add("(NULL, 21.5, 40.1)");
+ *
+ * batch_buffer[in]  buffer to build the statement in
+ * size[in]          size of batch_buffer
+ * insert[in]        start of the statement, up to the rows
+ * max_age[in]       (optional) most milliseconds a row waits to be sent,
+ *                   0 = until the buffer is full or batch_flush()
+*/
+void Connector::batch_begin(char *batch_buffer, int size, const char *insert,
+                            unsigned long max_age)
+{
+  batch = batch_buffer;
+  batch_size = size;
+  batch_max_age = max_age;
+  batch_prefix_len = strlen(insert);
+  if (batch_prefix_len > size-1)
+    batch_prefix_len = size-1;
+  memcpy(batch, insert, batch_prefix_len);
+  batch_len = batch_prefix_len;
+  batch_rows = 0;
+}
+
+
+/**
+ * batch_add - Add a row to the batched INSERT
+ *
+ * The row is the values for one row, in brackets, as they'd appear after
+ * VALUES in an INSERT, e.g. "(NULL, 21.5, 40.1)". If it won't fit in
+ * the batch buffer with the rows already waiting, they are sent first.
+ * If the rows have then waited long enough (see batch_begin()), they are
+ * sent straight away.
+ *
+ * Rows that couldn't be sent stay in the batch, to go with the next
+ * attempt. If that leaves no room for this row, it isn't added.
+ *
+ * row[in]         values for the row
+ *
+ * Returns boolean - True = row added and anything sent succeeded
+*/
+boolean Connector::batch_add(const char *row)
+{
+  boolean ok = true;
+  int row_len = strlen(row);
+
+  if (batch == NULL)
+    return false;
+  // Make room if need be: the row, a comma and the terminating null
+  if (batch_rows && (batch_len + row_len + 2 > batch_size))
+    ok = batch_flush();
+  if (batch_prefix_len + row_len + 1 > batch_size) {
+    Serial.println("Row too big for batch buffer.");
+    return false;
+  }
+  if (batch_rows && (batch_len + row_len + 2 > batch_size))
+    return false; // the rows waiting weren't sent, so there's no room
+  if (batch_rows == 0)
+    batch_started = millis();
+  else
+    batch[batch_len++] = ',';
+  memcpy(&batch[batch_len], row, row_len);
+  batch_len += row_len;
+  batch_rows++;
+  if (batch_due())
+    ok = batch_flush() && ok;
+  return ok;
+}
+
+
+/**
+ * batch_due - Check whether batched rows have waited long enough
+ *
+ * Call this from your loop if rows may not be added often, and call
+ * batch_flush() when it returns true, so rows don't wait much longer than
+ * the max_age given to batch_begin().
+ *
+ * Returns boolean - True = rows have waited max_age or more
+*/
+boolean Connector::batch_due()
+{
+  return batch_rows && batch_max_age &&
+         (millis() - batch_started >= batch_max_age);
+}
+
+
+/**
+ * batch_flush - Send the rows waiting in the batch
+ *
+ * This sends the rows waiting as a single multi-row INSERT. It does
+ * nothing if there aren't any. If the server doesn't store them, they
+ * are kept, so a later batch_add() or batch_flush() tries again. Call
+ * batch_begin() again to drop them instead (e.g. if the server rejects
+ * the statement itself).
+ *
+ * Returns boolean - True = no rows waiting, or the server stored them
+*/
+boolean Connector::batch_flush()
+{
+  ok_packet p;
+
+  if (batch_rows == 0)
+    return true;
+  send_command(0x03, batch, batch_len);
+  if (!read_packet() || parse_ok_packet(&p) != 0) {
+    if (buffer[4] == ERROR_PACKET)
+      parse_error_packet();
+    return false;
+  }
+  batch_len = batch_prefix_len;
+  batch_rows = 0;
+  return true;
+}
+
+
+/**
+ * stmt_prepare - Prepare a statement on the server
+ *
+ * This sends a statement with a ? for each value (e.g. "INSERT INTO
+ * test.temp VALUES (NULL, ?, ?)") for the server to parse once. It can
+ * then be run many times with stmt_execute(), with the values sent in
+ * binary, so they needn't be formatted as text or parsed by the server
+ * each time. Only statements that don't return a result set (INSERT,
+ * UPDATE, DELETE, etc.) are supported.
+ *
+ * The prepare response is defined as:
+ *
+ * Bytes                       Name
+ * -----                       ----
+ * 1                           status, always = 0
+ * 4                           statement_id
+ * 2                           num_columns
+ * 2                           num_params
+ * 1                           (filler)
+ * 2                           warning_count
+ *
+ * followed by a field packet for each parameter and an EOF packet, then
+ * a field packet for each column and an EOF packet.
+ *
+ * query[in]       SQL statement
+ * stmt[out]       the prepared statement
+ *
+ * Returns boolean - True = statement prepared
+*/
+boolean Connector::stmt_prepare(const char *query, stmt_struct *stmt)
+{
+  int num_columns;
+
+  send_command(0x16, query, strlen(query));
+  if (!read_packet() || buffer[4] != OK_PACKET) {
+    if (buffer[4] == ERROR_PACKET)
+      parse_error_packet();
+    return false;
+  }
+  stmt->id = 0;
+  for (int i = 3; i >= 0; i--)
+    stmt->id = (stmt->id << 8) | buffer[5+i];
+  num_columns = read_int(9, 2);
+  stmt->num_params = read_int(11, 2);
+  // Skip the parameter and column definitions, and the EOF after each
+  if (stmt->num_params > 0)
+    for (int i = 0; i <= stmt->num_params; i++)
+      if (!read_packet())
+        return false;
+  if (num_columns > 0)
+    for (int i = 0; i <= num_columns; i++)
+      if (!read_packet())
+        return false;
+  return true;
+}
+
+
+/**
+ * stmt_execute - Run a prepared statement
+ *
+ * This runs a statement prepared by stmt_prepare() with the given
+ * parameter values, one for each ? in the statement. The execute packet
+ * is built in the packet buffer, so it must fit in there (see
+ * PACKET_BUFFER_SIZE). It is defined as:
+ *
+ * Bytes                       Name
+ * -----                       ----
+ * 1                           command, always = 0x17
+ * 4                           statement_id
+ * 1                           flags, always = 0
+ * 4                           iteration_count, always = 1
+ * (num_params+7)/8            null_bitmap
+ * 1                           new_params_bound_flag, always = 1
+ * 2 * num_params              parameter types
+ * n                           parameter values
+ *
+ * stmt[in]        the prepared statement
+ * params[in]      array of stmt->num_params parameter values
+ *
+ * Returns boolean - True = statement ran successfully
+*/
+boolean Connector::stmt_execute(stmt_struct *stmt, const param_struct *params)
+{
+  int bitmap_len = (stmt->num_params+7)/8;
+  int types = 14+bitmap_len+1;
+  int len = types+2*stmt->num_params;
+  ok_packet p;
+
+  if (len > PACKET_BUFFER_SIZE) {
+    Serial.println("Too many parameters for packet buffer.");
+    return false;
+  }
+  buffer[3] = byte(0x00);
+  buffer[4] = byte(0x17);
+  store_int(&buffer[5], stmt->id, 4);
+  buffer[9] = 0x00;
+  store_int(&buffer[10], 1, 4);
+  memset(&buffer[14], 0, bitmap_len);
+  buffer[types-1] = 0x01;
+  for (int i = 0; i < stmt->num_params; i++) {
+    byte type = params[i].type;
+    int value_len = 4;
+    if (type == MYSQL_TYPE_NULL) {
+      buffer[14+i/8] |= 1 << (i%8);
+      value_len = 0;
+    } else if (type == MYSQL_TYPE_STRING) {
+      value_len = strlen(params[i].s);
+      // A one byte length, so strings up to 250 bytes
+      if (value_len > 250)
+        value_len = 250;
+      value_len++;
+    }
+    buffer[types+2*i] = type;
+    buffer[types+2*i+1] = 0x00;
+    if (len+value_len > PACKET_BUFFER_SIZE) {
+      Serial.println("Parameters too big for packet buffer.");
+      return false;
+    }
+    if (type == MYSQL_TYPE_LONG)
+      store_int(&buffer[len], params[i].l, 4);
+    else if (type == MYSQL_TYPE_FLOAT)
+      memcpy(&buffer[len], &params[i].f, 4);
+    else if (type == MYSQL_TYPE_STRING) {
+      buffer[len] = value_len-1;
+      memcpy(&buffer[len+1], params[i].s, value_len-1);
+    }
+    len += value_len;
+  }
+  store_int(&buffer[0], len-4, 3);
+  client.write(buffer, len);
+
+  if (!read_packet() || parse_ok_packet(&p) != 0) {
+    if (buffer[4] == ERROR_PACKET)
+      parse_error_packet();
+    return false;
+  }
+  return true;
+}
+
+
+/**
+ * stmt_close - Free a prepared statement on the server
+ *
+ * The server doesn't send a response to this.
+ *
+ * stmt[in]        the prepared statement
+*/
+void Connector::stmt_close(stmt_struct *stmt)
+{
+  store_int(&buffer[0], 5, 3);
+  buffer[3] = byte(0x00);
+  buffer[4] = byte(0x19);
+  store_int(&buffer[5], stmt->id, 4);
+  client.write(buffer, 9);
+}
+
+/**
+ * mysql_connect_async - Start connecting to a MySQL server
+ *
+ * This is mysql_connect() without the waiting. It makes the connection
+ * (just the one attempt) and returns; the handshake and authentication
+ * then go on as the server's packets arrive, driven by calls to poll().
+ * When it is done, done is called with ASYNC_OK if you are connected, or
+ * ASYNC_ERROR, ASYNC_TIMEOUT or ASYNC_FAILED if not.
+ *
+ * Note: the TCP connection itself is made by EthernetClient::connect(),
+ *       which waits until the server accepts it. Everything after that
+ *       doesn't wait.
+ *
+ * server[in]      IP address of the server as IPAddress type
+ * port[in]        port number of the server
+ * user[in]        user name, must stay put until done is called
+ * password[in]    user password, must stay put until done is called
+ * done[in]        (optional) called when connected, or it failed
+ *
+ * Returns boolean - True = connection made and handshake under way
+*/
+boolean Connector::mysql_connect_async(IPAddress server, int port,
+                                       char *user, char *password,
+                                       async_callback done)
+{
+  if (async_state != ASYNC_IDLE || !client.connect(server, port))
+    return false;
+  async_user = user;
+  async_password = password;
+  async_done = done;
+  async_heard = millis();
+  rx_len = 0;
+  async_state = ASYNC_HANDSHAKE;
+  return true;
+}
+
+
+/**
+ * cmd_query_async - Start a SQL statement without waiting for it
+ *
+ * This sends the query and returns straight away. The response is read
+ * as it arrives, by calls to poll() from your loop, so the sketch can go
+ * on sampling (or whatever else) in the meantime. When the statement is
+ * done, done is called with ASYNC_OK, or ASYNC_ERROR, ASYNC_TIMEOUT or
+ * ASYNC_FAILED if it went wrong.
+ *
+ * If the statement returns a result set, done is first called with
+ * ASYNC_ROW for each row as it arrives; use get_next_column() to read its
+ * values there and then. The field packets are skipped.
+ *
+ * For example:
+ *
+ *   void stored(Connector *conn, int status) {
+ *     if (status != ASYNC_OK)
+ *       Serial.println("Insert failed.");
+ *   }
+ *   ...
+ *   my_conn.cmd_query_async("INSERT INTO test.temp VALUES (NULL, 21.5)",
+ *                           stored);
+ *   ...
+ *   void loop() {
+ *     my_conn.poll();
+ *     ...
+ *   }
+ *
+ * Only one connect or query can be under way at a time, and the other
+ * methods mustn't be used while it is (see is_busy()).
+ *
+ * query[in]       SQL statement (using normal memory access)
+ * done[in]        (optional) called for each row and when it is done
+ *
+ * Returns boolean - True = query sent
+*/
+boolean Connector::cmd_query_async(const char *query, async_callback done)
+{
+  if (async_state != ASYNC_IDLE || !client.connected())
+    return false;
+  send_command(0x03, query, strlen(query));
+  async_done = done;
+  async_heard = millis();
+  rx_len = 0;
+  async_state = ASYNC_QUERY;
+  return true;
+}
+
+
+/**
+ * cmd_query_async_P - Start a SQL statement without waiting for it
+ *
+ * This is cmd_query_async() for a query in program memory.
+ *
+ * query[in]       SQL statement (using PROGMEM)
+ * done[in]        (optional) called for each row and when it is done
+ *
+ * Returns boolean - True = query sent
+*/
+boolean Connector::cmd_query_async_P(const char *query, async_callback done)
+{
+  if (async_state != ASYNC_IDLE || !client.connected())
+    return false;
+  send_command(0x03, query, strlen_P(query), true);
+  async_done = done;
+  async_heard = millis();
+  rx_len = 0;
+  async_state = ASYNC_QUERY;
+  return true;
+}
+
+
+/**
+ * poll - Carry on with an asynchronous connect or query
+ *
+ * Call this often from your loop. It reads whatever has arrived from the
+ * server, without waiting for more, and deals with each whole packet:
+ * answering the handshake, passing rows to the callback (one row a
+ * call), and calling it when the connect or query is done. If nothing arrives for MAX_TIMEOUT
+ * milliseconds, or the connection is lost, the connection is closed and
+ * the callback told so.
+ *
+ * The callback is called from here, and may start the next query.
+ *
+ * Returns boolean - True = still under way, False = nothing under way
+*/
+boolean Connector::poll()
+{
+  ok_packet p;
+
+  while (async_state != ASYNC_IDLE) {
+    if (!poll_packet()) {
+      if (!client.connected())
+        async_finish(ASYNC_FAILED);
+      else if (millis() - async_heard >= MAX_TIMEOUT)
+        async_finish(ASYNC_TIMEOUT);
+      break;
+    }
+    async_heard = millis();
+    switch (async_state) {
+      case ASYNC_HANDSHAKE:
+        if (buffer[4] == ERROR_PACKET) {
+          parse_error_packet();
+          async_finish(ASYNC_ERROR);
+          break;
+        }
+        parse_handshake_packet();
+        send_authentication_packet(async_user, async_password);
+        async_state = ASYNC_AUTH;
+        break;
+      case ASYNC_AUTH:
+        if (parse_ok_packet(&p) != 0) {
+          parse_error_packet();
+          async_finish(ASYNC_ERROR);
+          break;
+        }
+        Serial.print("Connected to server version ");
+        Serial.print(server_version);
+        Serial.println(".");
+        async_finish(ASYNC_OK);
+        break;
+      case ASYNC_QUERY:
+        // An Ok, an error or the result set header
+        if (buffer[4] == OK_PACKET) {
+          async_finish(ASYNC_OK);
+        } else if (buffer[4] == ERROR_PACKET) {
+          parse_error_packet();
+          async_finish(ASYNC_ERROR);
+        } else {
+          async_state = ASYNC_FIELDS;
+        }
+        break;
+      case ASYNC_FIELDS:
+        if (buffer[4] == EOF_PACKET)
+          async_state = ASYNC_ROWS;
+        break;
+      case ASYNC_ROWS:
+        // A row can start with 0xfe too, but then it's longer than an EOF
+        if (buffer[4] == EOF_PACKET && packet_len < 9) {
+          async_finish(ASYNC_OK);
+        } else if (buffer[4] == ERROR_PACKET) {
+          parse_error_packet();
+          async_finish(ASYNC_ERROR);
+        } else {
+          // One row a call, so a big result set doesn't hold up the loop
+          row_offset = 4;
+          if (async_done)
+            async_done(this, ASYNC_ROW);
+          return true;
+        }
+        break;
+    }
+  }
+  return async_state != ASYNC_IDLE;
+}
+
 // Begin private methods
 
 /**
@@ -334,28 +844,25 @@ void Connector::show_results() {
  * Serial.print(). If it is an Ok packet, it parses the packet and
  * returns false.
  *
+ * query[in]       SQL statement
  * query_len[in]   Number of bytes in the query string
+ * progmem[in]     True if query is in program memory
  *
  * Returns boolean - true = result set available,
  *                   false = no result set returned.
 */
-boolean Connector::run_query(int query_len)
+boolean Connector::run_query(const char *query, int query_len,
+                             boolean progmem)
 {
-  // TODO: need a 'store_int' method here!
-  store_int(&buffer[0], query_len+1, 3);
-  // TODO: Abort if query larger than sizeof(buffer);
-  buffer[3] = byte(0x00);
-  buffer[4] = byte(0x03);  // command packet
-  
+  ok_packet p;
+
   // Send the query
-  for (int c = 0; c < query_len+5; c++)
-    client.write(buffer[c]);
+  send_command(0x03, query, query_len, progmem);
 
   // Read a response packet and check it for Ok or Error.
-  read_packet();
-  ok_packet *p = (ok_packet *)malloc(sizeof(ok_packet));
-  int res = parse_ok_packet(p);
-  free(p);
+  if (!read_packet())
+    return false;
+  int res = parse_ok_packet(&p);
   if (res == ERROR_PACKET) {
     parse_error_packet();
     return false;
@@ -367,6 +874,45 @@ boolean Connector::run_query(int query_len)
 }
 
 
+/**
+ * send_command - Send a command packet with a string argument
+ *
+ * This sends a command packet such as COM_QUERY, whose argument is a
+ * string (the rest of the packet). The packet header and command are
+ * built in the packet buffer and the string is sent straight after them.
+ * A string in program memory is copied through the packet buffer a block
+ * at a time, so neither needs to fit in memory.
+ *
+ * command[in]     command byte
+ * data[in]        string to send after the command
+ * data_len[in]    number of bytes in the string
+ * progmem[in]     True if data is in program memory
+*/
+void Connector::send_command(byte command, const char *data, int data_len,
+                             boolean progmem)
+{
+  int len = 5;
+
+  store_int(&buffer[0], data_len+1, 3);
+  buffer[3] = byte(0x00);
+  buffer[4] = command;
+  
+  if (progmem) {
+    for (int c = 0; c < data_len; c++) {
+      buffer[len++] = pgm_read_byte_near(data+c);
+      if (len == PACKET_BUFFER_SIZE) {
+        client.write(buffer, len);
+        len = 0;
+      }
+    }
+    client.write(buffer, len);
+  } else {
+    client.write(buffer, len);
+    client.write((const byte *)data, data_len);
+  }
+}
+
+
 /**
  * wait_for_client - Wait until data is available for reading
  *
@@ -375,24 +921,129 @@ boolean Connector::run_query(int query_len)
  * set by MAX_TIMEOUT. Adjust this value to match the performance of
  * your server and network.
  *
+ * It returns as soon as there is data, and otherwise checks again every
+ * WAIT_DELAY milliseconds.
+ *
  * It is also used to read how many bytes in total are available from the
  * server. Thus, it can be used to know how large a data burst is from
  * the server.
  *
- * Returns integer - Number of bytes available to read.
+ * Returns integer - Number of bytes available to read, 0 if timed out.
 */
 int Connector::wait_for_client() {
-  int num = 0;
-  int timeout = 0;
-  do {
-    delay(500); // adjust for network latency
+  int num = client.available();
+  unsigned long start = millis();
+  while (num == 0 and (millis() - start) < MAX_TIMEOUT) {
+    delay(WAIT_DELAY);
     num = client.available();
-    timeout++;
-  } while (num == 0 and timeout < MAX_TIMEOUT);
+  }
   return num;
 }
 
 
+/**
+ * read_bytes - Read a block of bytes from the server
+ *
+ * This reads len bytes with as few calls to the client as possible,
+ * taking whatever has arrived in one go and waiting (see
+ * wait_for_client()) for the rest.
+ *
+ * dest[in]        where to store the bytes
+ * len[in]         number of bytes to read
+ *
+ * Returns integer - Number of bytes read, less than len if timed out.
+*/
+int Connector::read_bytes(byte *dest, int len) {
+  int got = 0;
+  while (got < len) {
+    if (wait_for_client() == 0)
+      break;
+    int n = client.read(dest+got, len-got);
+    if (n > 0)
+      got += n;
+  }
+  return got;
+}
+
+
+/**
+ * poll_packet - Read what has arrived of a packet, without waiting
+ *
+ * This is read_packet() for the asynchronous methods. It reads whatever
+ * the client has of the current packet into the packet buffer and
+ * returns; rx_len keeps track of how much of it has been read between
+ * calls. A packet too long for the packet buffer is cut short, as by
+ * read_packet(), with rx_skip counting what is left to throw away.
+ *
+ * Returns boolean - True = a whole packet is in the buffer
+*/
+boolean Connector::poll_packet() {
+  byte discard[16];
+  int num = client.available();
+
+  while (num > 0) {
+    int n;
+    if (rx_len < 4 || rx_len < packet_len+4) {
+      // The header, then as much of the packet as fits
+      int want = (rx_len < 4) ? 4-rx_len : packet_len+4-rx_len;
+      n = client.read(&buffer[rx_len], num < want ? num : want);
+      if (n <= 0)
+        break;
+      rx_len += n;
+      if (rx_len == 4) {
+        long len = buffer[0];
+        len += ((long)buffer[1] << 8);
+        len += ((long)buffer[2] << 16);
+        packet_len = (len > PACKET_BUFFER_SIZE-4) ? PACKET_BUFFER_SIZE-4 : len;
+        rx_skip = len - packet_len;
+        packet_truncated = (rx_skip != 0);
+        buffer[4] = 0x00;
+        if (rx_skip)
+          Serial.println("Packet too big for buffer, truncated.");
+      }
+    } else {
+      // Whatever doesn't fit
+      int want = (rx_skip < (long)sizeof(discard)) ? rx_skip : sizeof(discard);
+      n = client.read(discard, num < want ? num : want);
+      if (n <= 0)
+        break;
+      rx_skip -= n;
+    }
+    num -= n;
+    if (rx_len >= 4 && rx_len == packet_len+4 && rx_skip == 0) {
+      rx_len = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+/**
+ * async_finish - Finish an asynchronous connect or query
+ *
+ * This goes back to idle and calls the callback with the outcome. The
+ * connection is closed if it timed out or failed, since there's no
+ * telling where the server has got to, or if connecting didn't succeed.
+ * The state is idle before the callback is called, so it can start the
+ * next query.
+ *
+ * status[in]      outcome for the callback, ASYNC_OK etc.
+*/
+void Connector::async_finish(int status) {
+  async_callback done = async_done;
+
+  if (async_state == ASYNC_AUTH)
+    free(server_version); // don't need it anymore
+  if (status == ASYNC_TIMEOUT || status == ASYNC_FAILED ||
+      (status != ASYNC_OK && async_state <= ASYNC_AUTH))
+    client.stop();
+  async_state = ASYNC_IDLE;
+  if (done)
+    done(this, status);
+}
+
+
 /**
  * send_authentication_packet - Send the response to the server's challenge
  *
@@ -422,11 +1073,7 @@ int Connector::wait_for_client() {
 */
 void Connector::send_authentication_packet(char *user, char *password)
 {
-  if (buffer != NULL)
-    free(buffer);
-    
-  buffer = (byte *)malloc(256);
-
+  byte scramble[20];
   int size_send = 4;
   
   // client flags
@@ -450,13 +1097,15 @@ void Connector::send_authentication_packet(char *user, char *password)
     buffer[size_send+i] = 0x00;
   size_send += 23;
 
-  // user name
-  memcpy((char *)&buffer[size_send], user, strlen(user));
-  size_send += strlen(user) + 1;
+  // user name, cut short if it won't fit in the packet buffer
+  int user_len = strlen(user);
+  if (user_len > PACKET_BUFFER_SIZE-64)
+    user_len = PACKET_BUFFER_SIZE-64;
+  memcpy((char *)&buffer[size_send], user, user_len);
+  size_send += user_len + 1;
   buffer[size_send-1] = 0x00;
 
   // password - see scramble password
-  byte *scramble = (uint8_t *)malloc(20);
   if (scramble_password(password, scramble)) {
     buffer[size_send] = 0x14;
     size_send += 1;
@@ -465,7 +1114,6 @@ void Connector::send_authentication_packet(char *user, char *password)
     size_send += 20;
     buffer[size_send] = 0x00;
   }
-  free(scramble);
 
   // terminate password response
   buffer[size_send] = 0x00;
@@ -481,8 +1129,7 @@ void Connector::send_authentication_packet(char *user, char *password)
   buffer[3] = byte(0x01);
 
   // Write the packet
-  for (int i = 0; i < size_send; i++)
-    client.write(buffer[i]);
+  client.write(buffer, size_send);
 }
 
 
@@ -551,33 +1198,56 @@ boolean Connector::scramble_password(char *password, byte *pwd_hash) {
  * Thus, the length of the packet (not including the packet header) can
  * be found by reading the first 4 bytes from the server then reading
  * N bytes for the packet payload.
+ *
+ * The packet is read in blocks into the fixed packet buffer. If it is
+ * longer than PACKET_BUFFER_SIZE, the rest of it is read and thrown away
+ * and packet_len is set to the part that was kept.
+ *
+ * If the server stops sending (the connection was lost, or it timed out)
+ * before the whole packet has arrived, what is in the buffer isn't a
+ * packet at all; in particular a zero buffer[4] doesn't mean Ok.
+ *
+ * Returns boolean - True = the whole packet was read
 */
-void Connector::read_packet() {  
-  byte local[4];
-  
-  if (buffer != NULL)
-    free(buffer);
-  
-  // Wait for client (the server) to send data
-  wait_for_client();
-
-  // Read packet header
-  for (int i = 0; i < 4; i++) 
-    local[i] = client.read();
+boolean Connector::read_packet() {  
+  byte discard[16];
+  long len;
+
+  // Read packet header (packet number is in buffer[3])
+  memset(buffer, 0, 5);
+  packet_len = 0;
+  packet_truncated = false;
+  if (read_bytes(buffer, 4) < 4) {
+    Serial.println("No response from server.");
+    return false;
+  }
   
   // Get packet length
-  packet_len = local[0];
-  packet_len += (local[1] << 8);
-  packet_len += ((uint32_t)local[2] << 16);
-  buffer = (byte *)malloc(packet_len+4);
-  
-  // read packet number is in buffer[3]
-  for (int i = 0; i < 4; i++)
-    buffer[i] = local[i];
+  len = buffer[0];
+  len += ((long)buffer[1] << 8);
+  len += ((long)buffer[2] << 16);
+  packet_len = (len > PACKET_BUFFER_SIZE-4) ? PACKET_BUFFER_SIZE-4 : len;
+  packet_truncated = (len > packet_len);
+
+  if (read_bytes(&buffer[4], packet_len) < packet_len) {
+    Serial.println("Packet cut off by server.");
+    buffer[4] = 0x00; // so what did arrive isn't taken for an Error packet
+    packet_len = 0;
+    return false;
+  }
 
-  for (int i = 4; i < packet_len+4; i++) 
-    buffer[i] = client.read();
-    
+  // Skip whatever doesn't fit
+  if (len > packet_len) {
+    Serial.println("Packet too big for buffer, truncated.");
+    for (len -= packet_len; len > 0; len -= sizeof(discard)) {
+      int want = len < (long)sizeof(discard) ? len : sizeof(discard);
+      if (read_bytes(discard, want) < want) {
+        Serial.println("Packet cut off by server.");
+        return false;
+      }
+    }
+  }
+  return true;
 }
 
 
@@ -697,14 +1367,25 @@ void Connector::parse_error_packet() {
 */
 int Connector::parse_ok_packet(ok_packet *packet) {
   int type = buffer[4];
+  int offset = 5;
+  int len;
   if (type != OK_PACKET)
     return type;
   
-  packet->affected_rows = read_int(5, 0);
-  packet->insert_id = read_int(6, 0);
-  packet->server_status = read_int(7, 2);
-  packet->warning_count = read_int(9, 2);
-  memcpy((char *)&packet->message, (char *)&buffer[11], packet_len-7);
+  packet->affected_rows = read_int(offset);
+  offset += get_lcb_len(offset);
+  packet->insert_id = read_int(offset);
+  offset += get_lcb_len(offset);
+  packet->server_status = read_int(offset, 2);
+  packet->warning_count = read_int(offset+2, 2);
+  offset += 4;
+  len = packet_len+4 - offset;
+  if (len < 0)
+    len = 0;
+  if (len > (int)sizeof(packet->message)-1)
+    len = sizeof(packet->message)-1;
+  memcpy(packet->message, &buffer[offset], len);
+  packet->message[len] = 0x00;
   return 0;
 }
 
@@ -717,20 +1398,22 @@ int Connector::parse_ok_packet(ok_packet *packet) {
  * conjunction with read_int() to read length coded binary integers
  * from the buffer.
  *
- * Returns integer - number of bytes integer consumes
+ * Values up to 250 are stored in the one byte; larger ones follow a type
+ * byte of 0xfc, 0xfd or 0xfe with 2, 3 or 8 bytes of value.
+ *
+ * Returns integer - number of bytes integer consumes, including the type
+ *                   byte (1 past the end of the packet)
 */
 int Connector::get_lcb_len(int offset) {
-  int read_len = buffer[offset];
-  if (read_len > 250) {
-    // read type:
-    byte type = buffer[offset+1];
-    if (type == 0xfc)
-      read_len = 2;
-    else if (type == 0xfd)
-      read_len = 3;
-    else if (type == 0xfe)
-      read_len = 8;
-  }
+  if (offset >= packet_len+4)
+    return 1;
+  byte type = buffer[offset];
+  if (type == 0xfc)
+    return 3;
+  else if (type == 0xfd)
+    return 4;
+  else if (type == 0xfe)
+    return 9;
   return 1; 
 }
 
@@ -738,18 +1421,50 @@ int Connector::get_lcb_len(int offset) {
 /**
  * read_string - Retrieve a string from the buffer
  *
- * This reads a string from the buffer. It reads the length of the string
- * as the first byte.
+ * This reads a length coded string from the buffer. Rather than copy it
+ * to the heap, the string is moved back over its length, which leaves
+ * room to null-terminate it without touching whatever comes after it.
+ * So it is only good until the next packet is read, and a string can
+ * only be read once.
  *
- * offset[in]      offset from start of buffer
+ * The length, and the string, are checked against what was actually
+ * received: a string that runs past the end of the packet (one that was
+ * cut short, or a bad length) ends where the packet does.
  *
- * Returns string - String from the buffer
+ * offset[in/out]  offset from start of buffer, moved past the string
+ *
+ * Returns string - String in the buffer, or NULL for an SQL NULL or if
+ *                  the packet has already ended
 */
 char *Connector::read_string(int *offset) {
-  int len_bytes = get_lcb_len(buffer[*offset]);
-  int len = read_int(*offset, len_bytes);
-  char *str = (char *)malloc(len+1);
-  strncpy(str, (char *)&buffer[*offset+len_bytes], len);
+  int end = packet_len+4;
+  if (*offset >= end)
+    return NULL;
+  if (buffer[*offset] == NULL_COLUMN) {
+    *offset += 1;
+    return NULL;
+  }
+  char *str = (char *)&buffer[*offset];
+  int len_bytes = get_lcb_len(*offset);
+  int avail = end - *offset - len_bytes;
+  if (avail < 0) {
+    // Even the length was cut off
+    str[0] = 0x00;
+    *offset = end;
+    return str;
+  }
+  // 0xfd lengths don't fit an int, and 0xfe ones are always too long
+  long len = avail;
+  if (len_bytes == 1) {
+    len = buffer[*offset];
+  } else if (len_bytes <= 4) {
+    len = 0;
+    for (int i = len_bytes-1; i > 0; i--)
+      len = (len << 8) | buffer[*offset+i];
+  }
+  if (len > avail)
+    len = avail;
+  memmove(str, str+len_bytes, len);
   str[len] = 0x00;
   *offset += len_bytes+len;
   return str;
@@ -760,26 +1475,33 @@ char *Connector::read_string(int *offset) {
  * read_int - Retrieve an integer from the buffer in size bytes.
  *
  * This reads an integer from the buffer at offset position indicated for
- * the number of bytes specified (size).
+ * the number of bytes specified (size). Integers are stored least
+ * significant byte first.
  *
  * offset[in]      offset from start of buffer
- * size[in]        number of bytes to use to store the integer
+ * size[in]        number of bytes to use to store the integer, or 0 for
+ *                 a length coded binary integer
  *
- * Returns integer - integer from the buffer
+ * Returns integer - integer from the buffer, 0 if it runs past the end
+ *                   of the packet
 */
 int Connector::read_int(int offset, int size) {  
   int value = 0;
-  int new_size = 0;
-  if (size == 0)
-     new_size = get_lcb_len(offset);
-  if (size == 1)
-     return buffer[offset];
-  new_size = size;
-  int shifter = (new_size - 1) * 8;
-  for (int i = new_size; i > 0; i--) {
-    value += (byte)(buffer[i-1] << shifter);
-    shifter -= 8;
+  if (offset >= packet_len+4)
+    return 0;
+  if (size == 0) {
+    size = get_lcb_len(offset);
+    if (size == 1)
+      return buffer[offset];
+    // skip the type byte
+    offset++;
+    size--;
   }
+  // Bytes past the end of the packet weren't received
+  if (offset+size > packet_len+4)
+    return 0;
+  for (int i = size-1; i >= 0; i--)
+    value = (value << 8) | buffer[offset+i];
   return value;
 }
 
@@ -788,8 +1510,7 @@ int Connector::read_int(int offset, int size) {
  * store_int - Store an integer value into a byte array of size bytes.
  *
  * This writes an integer into the buffer at the current position of the
- * buffer. It will transform an integer of size to a length coded binary
- * form where 1-3 bytes are used to store the value (set by size).
+ * buffer, least significant byte first, in size bytes.
  *
  * buff[in]        pointer to location in internal buffer where the
  *                 integer will be stored
@@ -797,22 +1518,10 @@ int Connector::read_int(int offset, int size) {
  * size[in]        number of bytes to use to store the integer
 */
 void Connector::store_int(byte *buff, long value, int size) {
-  memset(buff, 0, size);
-  if (value < 0xff)
-    buff[0] = (byte)value;
-  else if (value < 0xffff) {
-    buff[0] = (byte)value;
-    buff[1] = (byte)(value << 8);
-  } else if (value < 0xffffff) {
-    buff[0] = (byte)value;
-    buff[1] = (byte)(value << 8);
-    buff[2] = (byte)(value << 16);
-  } else if (value < 0xffffff) {
-    buff[0] = (byte)value;
-    buff[1] = (byte)(value << 8);
-    buff[2] = (byte)(value << 16);
-    buff[3] = (byte)(value << 24);
-  } 
+  for (int i = 0; i < size; i++) {
+    buff[i] = (byte)value;
+    value >>= 8;
+  }
 }
 
 
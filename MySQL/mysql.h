@@ -42,6 +42,44 @@
 #define OK_PACKET     0x00
 #define EOF_PACKET    0xfe
 #define ERROR_PACKET  0xff
+#define NULL_COLUMN   0xfb
+
+// Returned by get_field() and get_row() when the packet didn't fit in the
+// packet buffer and was cut short (see PACKET_BUFFER_SIZE)
+#define TRUNCATED_PACKET -1
+
+// Size of the buffer packets are read into. It is allocated once, as part
+// of the Connector, rather than from the heap for every packet. A field
+// packet, or a whole row of a result set, must fit in it (less the 4 byte
+// packet header); anything longer is cut short. It also has to hold the
+// authentication packet sent when connecting, which is 64 bytes plus the
+// user name. Make it bigger if your rows are longer, or smaller to save
+// memory if they're short.
+#ifndef PACKET_BUFFER_SIZE
+#define PACKET_BUFFER_SIZE 128
+#endif
+#if PACKET_BUFFER_SIZE < 72
+#error PACKET_BUFFER_SIZE must be at least 72, for the authentication packet
+#endif
+
+// Parameter types for prepared statements (see param_struct)
+#define MYSQL_TYPE_LONG    0x03
+#define MYSQL_TYPE_FLOAT   0x04
+#define MYSQL_TYPE_NULL    0x06
+#define MYSQL_TYPE_STRING  0xfe
+
+// Status passed to the callback of an asynchronous connect or query (see
+// poll())
+#define ASYNC_OK       0    // finished successfully
+#define ASYNC_ROW      1    // a row of the result set is ready to read
+#define ASYNC_ERROR    2    // the server sent an error (printed via Serial)
+#define ASYNC_TIMEOUT  3    // nothing heard for MAX_TIMEOUT, disconnected
+#define ASYNC_FAILED   4    // couldn't connect, or the connection was lost
+
+class Connector;
+
+// Callback for an asynchronous connect or query, called from poll().
+typedef void (*async_callback)(Connector *conn, int status);
 
 // Structure for retrieving the OK packet.
 typedef struct {
@@ -59,12 +97,34 @@ typedef struct {
 } eof_packet;
 
 // Structure for retrieving a field (minimal implementation).
+// NOTE: get_field() allocates the strings from the heap, so free() them
+// when you're done. get_field_inplace() leaves them in the connector's
+// packet buffer instead, only good until the next packet is read; don't
+// free() those.
 typedef struct {
   char *db;
   char *table;
   char *name;
 } field_struct;
 
+// A statement prepared on the server by stmt_prepare().
+typedef struct {
+  unsigned long id;
+  int num_params;
+} stmt_struct;
+
+// A parameter value for stmt_execute(). Set type, then the member of the
+// union that goes with it (nothing for MYSQL_TYPE_NULL). Strings aren't
+// copied, so must stay put until stmt_execute() returns.
+typedef struct {
+  byte type;
+  union {
+    long l;           // MYSQL_TYPE_LONG
+    float f;          // MYSQL_TYPE_FLOAT
+    const char *s;    // MYSQL_TYPE_STRING
+  };
+} param_struct;
+
 /**
  * Connector class
  *
@@ -76,50 +136,100 @@ typedef struct {
  *    protocol).
  *  - Issue simple commands like INSERT, UPDATE, DELETE, SHOW, etc.
  *  - Run queries that return result sets.
+ *  - Batch rows up into multi-row INSERTs (see batch_begin()).
+ *  - Prepare statements on the server and execute them with binary
+ *    parameters (see stmt_prepare()), for statements that don't return
+ *    a result set.
+ *  - Connect and run queries asynchronously, driven by poll() from your
+ *    loop, so the sketch can get on with other things in the meantime
+ *    (see cmd_query_async()).
  *
  *  There are some strict limitations:
  *
- *  - Queries must fit into memory. This is because the class uses an
- *    internal buffer for building data packets to send to the server.
- *    It is suggested long strings be stored in program memory using
- *    PROGMEM (see cmd_query_P).
+ *  - Queries must fit into memory. It is suggested long strings be
+ *    stored in program memory using PROGMEM (see cmd_query_P).
  *  - Result sets are read one row-at-a-time.
- *  - The combined length of a row in a result set must fit into
- *    memory. The connector reads one packet-at-a-time and since the
- *    Arduino has a limited data size, the combined length of all fields
- *    must be less than available memory.
+ *  - The combined length of a row in a result set must fit into the
+ *    packet buffer (see PACKET_BUFFER_SIZE). The connector reads
+ *    one packet-at-a-time into this fixed buffer, and the column values
+ *    returned by get_next_column() are read in place from it. A longer
+ *    row is cut short, and get_row() returns TRUNCATED_PACKET for it.
+ *  - Strings from get_field_inplace() and get_next_column() are in the
+ *    packet buffer too, so don't free() them. Those from get_field() are
+ *    copies on the heap, which you do have to free().
  *  - Server error responses are processed immediately with the error
  *    code and text written via Serial.print.
  */
 class Connector
 {
   public:
-    Connector() { buffer = NULL; }
+    Connector() { batch = NULL; async_state = 0; /* idle */ }
     boolean mysql_connect(IPAddress server, int port, 
                           char *user, char *password);
     boolean cmd_query(const char *query);
     boolean cmd_query_P(const char *query);
     void show_results();
     int get_field(field_struct *fs);
+    int get_field_inplace(field_struct *fs);
     int get_row();
+    boolean get_next_column(char **value);
+    // Batched inserts
+    void batch_begin(char *batch_buffer, int size, const char *insert,
+                     unsigned long max_age=0);
+    boolean batch_add(const char *row);
+    boolean batch_due();
+    boolean batch_flush();
+    // Prepared statements
+    boolean stmt_prepare(const char *query, stmt_struct *stmt);
+    boolean stmt_execute(stmt_struct *stmt, const param_struct *params);
+    void stmt_close(stmt_struct *stmt);
+    // Asynchronous connect and queries
+    boolean mysql_connect_async(IPAddress server, int port,
+                                char *user, char *password,
+                                async_callback done);
+    boolean cmd_query_async(const char *query, async_callback done);
+    boolean cmd_query_async_P(const char *query, async_callback done);
+    boolean poll();
+    boolean is_busy() { return async_state != 0; }
     int is_connected () { return client.connected(); }
   private:
-    byte *buffer; 
+    byte buffer[PACKET_BUFFER_SIZE];
     char *server_version;    
     byte seed[20];           
     int packet_len;
+    boolean packet_truncated;
+    int row_offset;
+    char *batch;
+    int batch_size;
+    int batch_prefix_len;
+    int batch_len;
+    int batch_rows;
+    unsigned long batch_started;
+    unsigned long batch_max_age;
+    byte async_state;
+    async_callback async_done;
+    unsigned long async_heard;
+    char *async_user;
+    char *async_password;
+    int rx_len;
+    long rx_skip;
     
     EthernetClient client;
     
     // Methods for handling packets
     int wait_for_client();
+    int read_bytes(byte *dest, int len);
+    boolean poll_packet();
+    void async_finish(int status);
     void send_authentication_packet(char *user, char *password);
-    void read_packet();
+    boolean read_packet();
     void parse_handshake_packet();
     void parse_eof_packet(eof_packet *packet);
     int parse_ok_packet(ok_packet *packet);
     void parse_error_packet();
-    boolean run_query(int query_len);
+    boolean run_query(const char *query, int query_len, boolean progmem);
+    void send_command(byte command, const char *data, int data_len,
+                      boolean progmem=false);
     
     // Utility methods
     boolean scramble_password(char *password, byte *pwd_hash);
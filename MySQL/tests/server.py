@@ -0,0 +1,248 @@
+# Connector/Arduino test server
+#
+# A stand-in for a MySQL server, to point the Connector/Arduino benchmarks
+# at when there isn't a real server to hand.  It speaks just enough of the
+# client/server protocol for them: it sends the 4.1 handshake, accepts any
+# user and password, and then answers COM_QUERY:
+#
+#   - a SELECT with "LIMIT n" gets a result set of n rows, each with four
+#     columns (id, name, value, stamp)
+#   - an INSERT gets an Ok packet with one affected row for each row in it
+#   - anything else gets an Ok packet
+#
+# and prepared statements (COM_STMT_PREPARE, COM_STMT_EXECUTE and
+# COM_STMT_CLOSE) for statements that don't return a result set.
+#
+# It listens by default on port 3306 (or the port given as the first command
+# line parameter), and prints how many statements and rows each connection
+# sent when it closes.  Add "-v" after the port to print every statement and
+# the parameters of every execute as well, and "delay=N" to wait N
+# milliseconds before every response, like a busy server on a slow network
+# would.  Must be terminated by hitting ctrl-c to kill the process!
+
+import re
+import socket
+import socketserver
+import struct
+import sys
+import time
+
+SERVER_PORT = 3306
+if len(sys.argv) > 1:
+    SERVER_PORT = int(sys.argv[1])
+VERBOSE = '-v' in sys.argv[2:]
+DELAY = 0
+for arg in sys.argv[2:]:
+    if arg.startswith('delay='):
+        DELAY = int(arg[6:]) / 1000.0
+
+COM_QUIT = 0x01
+COM_QUERY = 0x03
+COM_PING = 0x0e
+COM_STMT_PREPARE = 0x16
+COM_STMT_EXECUTE = 0x17
+COM_STMT_CLOSE = 0x19
+
+# Binary protocol parameter types: struct format, or None for a length
+# coded string
+PARAM_TYPES = {
+    0x01: '<b',     # MYSQL_TYPE_TINY
+    0x02: '<h',     # MYSQL_TYPE_SHORT
+    0x03: '<i',     # MYSQL_TYPE_LONG
+    0x04: '<f',     # MYSQL_TYPE_FLOAT
+    0x05: '<d',     # MYSQL_TYPE_DOUBLE
+    0x08: '<q',     # MYSQL_TYPE_LONGLONG
+    0x0f: None,     # MYSQL_TYPE_VARCHAR
+    0xfd: None,     # MYSQL_TYPE_VAR_STRING
+    0xfe: None,     # MYSQL_TYPE_STRING
+}
+
+COLUMNS = (b'id', b'name', b'value', b'stamp')
+MYSQL_TYPE_VAR_STRING = 0xfd
+
+
+def lenenc_int(n):
+    if n < 251:
+        return bytes([n])
+    if n < 0x10000:
+        return b'\xfc' + struct.pack('<H', n)
+    if n < 0x1000000:
+        return b'\xfd' + struct.pack('<I', n)[:3]
+    return b'\xfe' + struct.pack('<Q', n)
+
+
+def lenenc_str(s):
+    return lenenc_int(len(s)) + s
+
+
+def read_lenenc_int(data, pos):
+    first = data[pos]
+    size = {0xfc: 2, 0xfd: 3, 0xfe: 8}.get(first, 0)
+    if not size:
+        return first, pos + 1
+    return int.from_bytes(data[pos + 1:pos + 1 + size], 'little'), pos + 1 + size
+
+
+def row(i):
+    return (b'%d' % i, b'sensor_%02d' % (i % 100), b'%.2f' % (i * 1.25),
+            b'2013-01-01 00:%02d:%02d' % (i // 60 % 60, i % 60))
+
+
+class Handler(socketserver.BaseRequestHandler):
+    def setup(self):
+        self.request.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.rfile = self.request.makefile('rb')
+        self.out = []
+
+    def read_packet(self):
+        header = self.rfile.read(4)
+        if len(header) < 4:
+            return None, None
+        length = header[0] | header[1] << 8 | header[2] << 16
+        return header[3], self.rfile.read(length)
+
+    def packet(self, seq, payload):
+        # Queued, and sent together by flush() so a response goes out in as
+        # few segments as possible
+        self.out.append(struct.pack('<I', len(payload))[:3] + bytes([seq & 0xff]) + payload)
+        return seq + 1
+
+    def flush(self):
+        if DELAY:
+            time.sleep(DELAY)
+        self.request.sendall(b''.join(self.out))
+        self.out = []
+
+    def ok(self, seq, affected=0, insert_id=0):
+        return self.packet(seq, b'\x00' + lenenc_int(affected) + lenenc_int(insert_id) +
+                           b'\x02\x00\x00\x00')
+
+    def eof(self, seq):
+        return self.packet(seq, b'\xfe\x00\x00\x02\x00')
+
+    def error(self, seq, code, message):
+        return self.packet(seq, b'\xff' + struct.pack('<H', code) + b'#HY000' + message)
+
+    def result_set(self, seq, rows):
+        seq = self.packet(seq, lenenc_int(len(COLUMNS)))
+        for name in COLUMNS:
+            seq = self.column_definition(seq, name)
+        seq = self.eof(seq)
+        for i in range(rows):
+            seq = self.packet(seq, b''.join(lenenc_str(v) for v in row(i)))
+        return self.eof(seq)
+
+    def column_definition(self, seq, name):
+        return self.packet(seq, lenenc_str(b'def') + lenenc_str(b'test') + lenenc_str(b'bench') +
+                           lenenc_str(b'bench') + lenenc_str(name) + lenenc_str(name) +
+                           b'\x0c' + struct.pack('<HIBHB', 8, 64, MYSQL_TYPE_VAR_STRING, 0, 0) +
+                           b'\x00\x00')
+
+    def prepare(self, sql):
+        self.next_stmt_id += 1
+        params = sql.count(b'?')
+        self.statements_prepared[self.next_stmt_id] = (sql, params)
+        seq = self.packet(1, b'\x00' + struct.pack('<IHHBH', self.next_stmt_id, 0, params, 0, 0))
+        if params:
+            for i in range(params):
+                seq = self.column_definition(seq, b'?')
+            self.eof(seq)
+
+    def execute(self, payload):
+        stmt_id, flags, iterations = struct.unpack_from('<IBI', payload, 1)
+        if stmt_id not in self.statements_prepared:
+            self.error(1, 1243, b'Unknown prepared statement handler')
+            return 0
+        sql, params = self.statements_prepared[stmt_id]
+        pos = 10
+        values = []
+        if params:
+            null_bitmap = payload[pos:pos + (params + 7) // 8]
+            pos += (params + 7) // 8
+            if payload[pos]:
+                self.param_types[stmt_id] = [payload[pos + 1 + 2 * i] for i in range(params)]
+                pos += 1 + 2 * params
+            else:
+                pos += 1
+            for i, param_type in enumerate(self.param_types[stmt_id]):
+                if null_bitmap[i // 8] & (1 << (i % 8)):
+                    values.append(None)
+                elif PARAM_TYPES.get(param_type, 0) is None:
+                    length, pos = read_lenenc_int(payload, pos)
+                    values.append(payload[pos:pos + length].decode('latin-1'))
+                    pos += length
+                elif param_type in PARAM_TYPES:
+                    fmt = PARAM_TYPES[param_type]
+                    values.append(struct.unpack_from(fmt, payload, pos)[0])
+                    pos += struct.calcsize(fmt)
+                else:
+                    self.error(1, 1210, b'Unsupported parameter type')
+                    return 0
+        if VERBOSE:
+            print('execute %d: %r' % (stmt_id, tuple(values)))
+        self.ok(1, affected=1)
+        return 1
+
+    def query(self, sql):
+        if VERBOSE:
+            print(sql.decode('latin-1'))
+        match = re.match(rb'\s*select\b.*\blimit\s+(\d+)', sql, re.I | re.S)
+        if match:
+            self.result_set(1, int(match.group(1)))
+        elif re.match(rb'\s*insert\b', sql, re.I):
+            # One affected row for each row in a (possibly multi-row) INSERT
+            rows = len(re.findall(rb'\)\s*,\s*\(', sql)) + 1
+            self.ok(1, affected=rows)
+            return rows
+        else:
+            self.ok(1)
+        return 0
+
+    def handle(self):
+        statements = 0
+        rows = 0
+        self.next_stmt_id = 0
+        self.statements_prepared = {}
+        self.param_types = {}
+        scramble = b'abcdefgh' + b'ijklmnopqrst'
+        self.packet(0, b'\x0a' + b'5.5.0-standin\x00' + struct.pack('<I', 1) + scramble[:8] +
+                    b'\x00' + struct.pack('<HBHH', 0xf7ff, 8, 2, 0x8000) + bytes([21]) +
+                    b'\x00' * 10 + scramble[8:] + b'\x00')
+        self.flush()
+        seq, auth = self.read_packet()
+        if auth is None:
+            return
+        self.ok(seq + 1)
+        self.flush()
+        while True:
+            seq, payload = self.read_packet()
+            if not payload or payload[0] == COM_QUIT:
+                break
+            command = payload[0]
+            if command == COM_STMT_CLOSE:
+                # No response to this one
+                self.statements_prepared.pop(struct.unpack_from('<I', payload, 1)[0], None)
+                continue
+            statements += 1
+            if command == COM_QUERY:
+                rows += self.query(payload[1:])
+            elif command == COM_STMT_PREPARE:
+                self.prepare(payload[1:])
+            elif command == COM_STMT_EXECUTE:
+                rows += self.execute(payload)
+            elif command == COM_PING:
+                self.ok(1)
+            else:
+                self.error(1, 1047, b'Unknown command')
+            self.flush()
+        print('%s:%d %d statements, %d rows inserted' %
+              (self.client_address[0], self.client_address[1], statements, rows))
+        sys.stdout.flush()
+
+
+class Server(socketserver.ThreadingTCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+Server(('', SERVER_PORT), Handler).serve_forever()
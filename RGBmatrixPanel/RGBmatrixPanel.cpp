@@ -90,14 +90,14 @@ void RGBmatrixPanel::init(uint8_t rows, uint8_t a, uint8_t b, uint8_t c,
 
   nRows = rows; // Number of multiplexed rows; actual height is 2X this
   nPanels = pwidth;
+  tilesX  = pwidth; // Single row of panels unless a tiled constructor
+  tilesY  = 1;      // says otherwise
+  tileLayout = TILE_PROGRESSIVE;
+  dbuffered = dbuf;
 
-  // Allocate and initialize matrix buffer:
-  int buffsize  = 32 * nRows * 3 * nPanels, // x3 = 3 bytes holds 4 planes "packed"
-      allocsize = (dbuf == true) ? (buffsize * 2) : buffsize;
-  if(NULL == (matrixbuff[0] = (uint8_t *)malloc(allocsize))) return;
-  memset(matrixbuff[0], 0, allocsize);
-  // If not double-buffered, both buffers then point to the same address:
-  matrixbuff[1] = (dbuf == true) ? &matrixbuff[0][buffsize] : matrixbuff[0];
+  // Allocate and initialize matrix buffer, 4 planes to begin with:
+  matrixbuff[0] = NULL;
+  if(!setPlanes(4)) return;
 
   // Save pin numbers for use by begin() method later.
   _a     = a;
@@ -120,13 +120,30 @@ void RGBmatrixPanel::init(uint8_t rows, uint8_t a, uint8_t b, uint8_t c,
   addrbpin  = digitalPinToBitMask(b);
   addrcport = portOutputRegister(digitalPinToPort(c));
   addrcpin  = digitalPinToBitMask(c); 
-  nPlanes   = 4;     // Other code is fixed at 4 planes; don't change this
-  plane     = nPlanes - 1;
-  row       = nRows   - 1;
   swapflag  = false;
   backindex = 0;     // Array index of back buffer
 }
 
+// Allocate matrix buffer for the current number of planes.  Usually
+// 3 bytes per pixel pair hold 4 planes "packed": planes 1 and up each
+// take a byte, and plane 0 hides in the 2 spare bits of the first three.
+// With only 3 planes there aren't enough spare bits, so each plane gets
+// its own byte instead.
+boolean RGBmatrixPanel::alloc(void) {
+  uint8_t blocks = (nPlanes > 3) ? (nPlanes - 1) : nPlanes;
+  int     allocsize;
+
+  buffsize  = 32 * nRows * blocks * nPanels;
+  allocsize = (dbuffered == true) ? (buffsize * 2) : buffsize;
+  if(NULL == (matrixbuff[0] = (uint8_t *)malloc(allocsize))) return false;
+  memset(matrixbuff[0], 0, allocsize);
+  // If not double-buffered, both buffers then point to the same address:
+  matrixbuff[1] = (dbuffered == true) ? &matrixbuff[0][buffsize] : matrixbuff[0];
+  plane = nPlanes - 1;
+  row   = nRows   - 1;
+  return true;
+}
+
 // Constructor for 16x32 panel:
 RGBmatrixPanel::RGBmatrixPanel(
   uint8_t a, uint8_t b, uint8_t c,
@@ -150,6 +167,36 @@ RGBmatrixPanel::RGBmatrixPanel(
   addrdpin  = digitalPinToBitMask(d);
 }
 
+// Constructor for a wall of 16x32 panels:
+RGBmatrixPanel::RGBmatrixPanel(
+  uint8_t a, uint8_t b, uint8_t c,
+  uint8_t sclk, uint8_t latch, uint8_t oe, boolean dbuf,
+  uint8_t tilesx, uint8_t tilesy, uint8_t layout) :
+  Adafruit_GFX(32*tilesx, 16*tilesy) {
+
+  init(8, a, b, c, sclk, latch, oe, dbuf, tilesx * tilesy);
+  tilesX     = tilesx;
+  tilesY     = tilesy;
+  tileLayout = layout;
+}
+
+// Constructor for a wall of 32x32 panels:
+RGBmatrixPanel::RGBmatrixPanel(
+  uint8_t a, uint8_t b, uint8_t c, uint8_t d,
+  uint8_t sclk, uint8_t latch, uint8_t oe, boolean dbuf,
+  uint8_t tilesx, uint8_t tilesy, uint8_t layout) :
+  Adafruit_GFX(32*tilesx, 32*tilesy) {
+
+  init(16, a, b, c, sclk, latch, oe, dbuf, tilesx * tilesy);
+  tilesX     = tilesx;
+  tilesY     = tilesy;
+  tileLayout = layout;
+
+  _d        = d;
+  addrdport = portOutputRegister(digitalPinToPort(d));
+  addrdpin  = digitalPinToBitMask(d);
+}
+
 void RGBmatrixPanel::begin(void) {
 
   backindex   = 0;                         // Back buffer
@@ -174,7 +221,10 @@ void RGBmatrixPanel::begin(void) {
 
   // Set up Timer1 for interrupt:
   TCCR1A  = _BV(WGM11); // Mode 14 (fast PWM), OC1A off
-  TCCR1B  = _BV(WGM13) | _BV(WGM12) | _BV(CS10); // Mode 14, no prescale
+  TCCR1B  = _BV(WGM13) | _BV(WGM12);            // Mode 14
+  if(prescale == 1)      TCCR1B |= _BV(CS10);             // No prescale
+  else if(prescale == 8) TCCR1B |= _BV(CS11);             // Clock/8
+  else                   TCCR1B |= _BV(CS11) | _BV(CS10); // Clock/64
   ICR1    = 100;
   TIMSK1 |= _BV(TOIE1); // Enable Timer1 interrupt
   sei();                // Enable global interrupts
@@ -269,7 +319,8 @@ uint16_t RGBmatrixPanel::ColorHSV(
 }
 
 void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t c) {
-  uint8_t r, g, b, bit, limit, *ptr;
+  uint8_t  r, g, b, *ptr;
+  uint16_t bit, limit, cw = 32 * nPanels; // cw = width of whole chain
 
   if((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) return;
 
@@ -288,47 +339,81 @@ void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t c) {
     break;
   }
 
+  if(tilesY > 1) {
+    // Find the tile, then where it sits along the chain.  The matrix
+    // buffer is laid out as if all panels were in one long row.
+    uint8_t th = nRows * 2, tx = x >> 5, ty = y / th;
+    x &= 31;
+    y -= ty * th;
+    if((ty & 1) && (tileLayout & TILE_SERPENTINE)) tx = tilesX - 1 - tx;
+    if((ty & 1) && (tileLayout & TILE_ROTATE)) {
+      x = 31     - x;
+      y = th - 1 - y;
+    }
+    x += (ty * tilesX + tx) << 5;
+  }
+
   // Adafruit_GFX uses 16-bit color in 5/6/5 format, while matrix needs
-  // 4/4/4.  Pluck out relevant bits while separating into R,G,B:
-  r =  c >> 12;        // RRRRrggggggbbbbb
-  g = (c >>  7) & 0xF; // rrrrrGGGGggbbbbb
-  b = (c >>  1) & 0xF; // rrrrrggggggBBBBb
+  // one bit per plane.  Separate into R,G,B, widen red and blue to 6 bits
+  // and look up the level for each (see setPlanes()):
+  r =  c >> 11;         // RRRRRggggggbbbbb
+  g = (c >>  5) & 0x3F; // rrrrrGGGGGGbbbbb
+  b =  c        & 0x1F; // rrrrrggggggBBBBB
+  r = level[(r << 1) | (r >> 4)];
+  g = level[g];
+  b = level[(b << 1) | (b >> 4)];
 
   // Loop counter stuff
   bit   = 2;
   limit = 1 << nPlanes;
 
-  if(y < nRows) {
+  if(nPlanes < 4) {
+    // Unpacked: every plane is stored like planes 1+ below, upper half
+    // of the display in bits 2-4 and lower half in bits 5-7.
+    uint8_t shift = 2;
+    if(y >= nRows) {
+      y    -= nRows;
+      shift = 5;
+    }
+    ptr = &matrixbuff[backindex][y * cw * nPlanes + x];
+    for(bit = 1; bit < limit; bit <<= 1) {
+      *ptr &= ~(B00000111 << shift);           // Mask out R,G,B in one op
+      if(r & bit) *ptr |= (B00000001 << shift); // Plane N R
+      if(g & bit) *ptr |= (B00000010 << shift); // Plane N G
+      if(b & bit) *ptr |= (B00000100 << shift); // Plane N B
+      ptr  += cw;                               // Advance to next bit plane
+    }
+  } else if(y < nRows) {
     // Data for the upper half of the display is stored in the lower
     // bits of each byte.
-    ptr = &matrixbuff[backindex][y * WIDTH * (nPlanes - 1) + x]; // Base addr
+    ptr = &matrixbuff[backindex][y * cw * (nPlanes - 1) + x]; // Base addr
     // Plane 0 is a tricky case -- its data is spread about,
     // stored in least two bits not used by the other planes.
-    ptr=ptr+64*nPanels;
+    ptr=ptr+2*cw;
     *ptr &= ~B00000011;            // Plane 0 R,G mask out in one op
     if(r & 1) *ptr |=  B00000001;  // Plane 0 R: 64 bytes ahead, bit 0
     if(g & 1) *ptr |=  B00000010;  // Plane 0 G: 64 bytes ahead, bit 1
-    ptr=ptr-32*nPanels;
+    ptr=ptr-cw;
     if(b & 1) *ptr |=  B00000001;  // Plane 0 B: 32 bytes ahead, bit 0
     else      *ptr &= ~B00000001;  // Plane 0 B unset; mask out
     // The remaining three image planes are more normal-ish.
     // Data is stored in the high 6 bits so it can be quickly
     // copied to the DATAPORT register w/6 output lines.
-    ptr=ptr-32*nPanels;
+    ptr=ptr-cw;
     for(; bit < limit; bit <<= 1) {
       *ptr &= ~B00011100;             // Mask out R,G,B in one op
       if(r & bit) *ptr |= B00000100;  // Plane N R: bit 2
       if(g & bit) *ptr |= B00001000;  // Plane N G: bit 3
       if(b & bit) *ptr |= B00010000;  // Plane N B: bit 4
-      ptr  += WIDTH;                  // Advance to next bit plane
+      ptr  += cw;                     // Advance to next bit plane
     }
   } else {
     // Data for the lower half of the display is stored in the upper
     // bits, except for the plane 0 stuff, using 2 least bits.
-    ptr = &matrixbuff[backindex][(y - nRows) * WIDTH * (nPlanes - 1) + x];
+    ptr = &matrixbuff[backindex][(y - nRows) * cw * (nPlanes - 1) + x];
     *ptr &= ~B00000011;               // Plane 0 G,B mask out in one op
-    if(r & 1)  ptr[32*nPanels] |=  B00000010; // Plane 0 R: 32 bytes ahead, bit 1
-    else       ptr[32*nPanels] &= ~B00000010; // Plane 0 R unset; mask out
+    if(r & 1)  ptr[cw] |=  B00000010; // Plane 0 R: 32 bytes ahead, bit 1
+    else       ptr[cw] &= ~B00000010; // Plane 0 R unset; mask out
     if(g & 1) *ptr     |=  B00000001; // Plane 0 G: bit 0
     if(b & 1) *ptr     |=  B00000010; // Plane 0 B: bit 0
     for(; bit < limit; bit <<= 1) {
@@ -336,7 +421,7 @@ void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t c) {
       if(r & bit) *ptr |= B00100000;  // Plane N R: bit 5
       if(g & bit) *ptr |= B01000000;  // Plane N G: bit 6
       if(b & bit) *ptr |= B10000000;  // Plane N B: bit 7
-      ptr  += WIDTH;                  // Advance to next bit plane
+      ptr  += cw;                     // Advance to next bit plane
     }
   }
 }
@@ -346,7 +431,7 @@ void RGBmatrixPanel::fillScreen(uint16_t c) {
     // For black or white, all bits in frame buffer will be identically
     // set or unset (regardless of weird bit packing), so it's OK to just
     // quickly memset the whole thing:
-    memset(matrixbuff[backindex], c, 32 * nRows * 3 * nPanels);
+    memset(matrixbuff[backindex], c, buffsize);
   } else {
     // Otherwise, need to handle it the long way:
     Adafruit_GFX::fillScreen(c);
@@ -371,7 +456,7 @@ void RGBmatrixPanel::swapBuffers(boolean copy) {
     swapflag = true;                  // Set flag here, then...
     while(swapflag == true) delay(1); // wait for interrupt to clear it
     if(copy == true)
-      memcpy(matrixbuff[backindex], matrixbuff[1-backindex], 32 * nRows * 3 * nPanels);
+      memcpy(matrixbuff[backindex], matrixbuff[1-backindex], buffsize);
   }
 }
 
@@ -382,8 +467,18 @@ void RGBmatrixPanel::swapBuffers(boolean copy) {
 // back into the display using a pgm_read_byte() loop.
 void RGBmatrixPanel::dumpMatrix(void) {
 
-  int i, buffsize = 32 * nRows * 3 * nPanels;
-
+  int i;
+
+  // Note the layout, since the data is only right for the same panels,
+  // chain length and plane count.  Tiles don't matter: the buffer is in
+  // chain order, so loading the data back re-creates the same picture.
+  Serial.print("\n\n// ");
+  Serial.print(nPanels);
+  Serial.print(" panel(s) of 32x");
+  Serial.print(nRows * 2);
+  Serial.print(", ");
+  Serial.print(nPlanes);
+  Serial.print(" planes");
   Serial.print("\n\n"
     "#include <avr/pgmspace.h>\n\n"
     "static PROGMEM prog_uchar img[] = {\n  ");
@@ -421,6 +516,10 @@ ISR(TIMER1_OVF_vect, ISR_BLOCK) { // ISR_BLOCK important -- see notes later
 // should different compilers produce slightly different results.
 #define CALLOVERHEAD 60   // Actual value measured = 56
 #define LOOPTIME     350  // Actual value measured = 188
+// PANELTIME is added to LOOPTIME for each additional chained panel: 32
+// more 'pews' at 5 ticks each, plus the panel loop.  The slack in
+// LOOPTIME only needs to be allowed once, however long the chain.
+#define PANELTIME    180  // 32 * 5 = 160 + loop overhead
 // The "on" time for bitplane 0 (with the shortest BCM interval) can
 // then be estimated as LOOPTIME + CALLOVERHEAD * 2.  Each successive
 // bitplane then doubles the prior amount of time.  We can then
@@ -445,6 +544,92 @@ ISR(TIMER1_OVF_vect, ISR_BLOCK) { // ISR_BLOCK important -- see notes later
 // 16x32 matrix uses about half that CPU load.  CPU time could be
 // further adjusted by padding the LOOPTIME value, but refresh rates
 // will decrease proportionally, and 200 Hz is a decent target.
+// Other plane counts follow the same arithmetic: each extra plane
+// doubles the ticks per row (5 planes = 9920, about 100 Hz on the
+// 32x32) while adding one more 320-tick data load, so CPU use drops;
+// each plane fewer halves the ticks and raises the CPU share.  Chained
+// panels add PANELTIME apiece, since each plane has that many more columns
+// to shift out.  refreshRate() and cpuLoad() report the real figures.
+// A 64x64 wall (four 32x32 panels, one chain) at 4 planes works out to
+// 350 + 3 * 180 + 120 = 1010 ticks for plane 0, 15150 per row, 242400
+// per frame: 66 Hz.  3 planes doubles that.
+
+// Set the number of bitplanes, reallocate the matrix buffer to suit,
+// and work out the BCM intervals.  The longest interval has to fit the
+// 16-bit Timer1; with many planes or panels the timer is prescaled.
+// Past the largest prescale (64) the plane count is reduced instead, so
+// a very long chain can't overflow bcmBase << plane in the interrupt.
+boolean RGBmatrixPanel::setPlanes(uint8_t planes, boolean gflag) {
+  uint8_t  i, maxval, maxPlanes;
+  uint32_t t;
+  boolean  ok = true;
+
+  t = LOOPTIME + PANELTIME * (uint32_t)(nPanels - 1);
+  if(nRows <= 8) t *= 2; // 16x32: same refresh, half the CPU load
+  t += CALLOVERHEAD * 2;
+  for(maxPlanes = 8; (maxPlanes > 3) &&
+    ((((t + 63) / 64) << (maxPlanes - 1)) > 0xFFFF); maxPlanes--);
+
+  if(planes < 3)      planes = 3;
+  else if(planes > 8) planes = 8;
+  if(planes > maxPlanes) {
+    planes = maxPlanes;
+    ok     = false;
+  }
+
+  free(matrixbuff[0]);
+  nPlanes = planes;
+  if(!alloc()) {
+    // Not enough RAM; fall back to the default 4 planes (or fewer, above)
+    if(nPlanes > 4) nPlanes = 4;
+    gflag   = false;
+    ok      = false;
+    if(!alloc()) return false;
+  }
+
+  // Lookup for drawPixel(): 6-bit color component to plane bits.  Linear
+  // takes the top bits (replicating them to fill more than 6 planes);
+  // gamma scales the 16-bit gamma16 table down to the plane count.
+  maxval = (1 << nPlanes) - 1;
+  for(i=0; i<64; i++) {
+    if(gflag) {
+      level[i] = ((uint32_t)pgm_read_word(&gamma16[i]) * maxval + 32767) >> 16;
+    } else if(nPlanes <= 6) {
+      level[i] = i >> (6 - nPlanes);
+    } else {
+      level[i] = (i << (nPlanes - 6)) | (i >> (12 - nPlanes));
+    }
+  }
+
+  // Smallest prescale at which the longest interval, rounded up, fits
+  for(prescale = 1; (prescale < 64) &&
+    ((((t + prescale - 1) / prescale) << (nPlanes - 1)) > 0xFFFF);
+    prescale *= 8);
+  bcmBase     = (t + prescale - 1) / prescale;
+  bcmOverhead = CALLOVERHEAD / prescale;
+
+  busyTicks = rowBusyTicks = 0;
+  return ok;
+}
+
+// Whole-screen refreshes per second: every row shows every plane, each
+// plane twice as long as the one before.
+uint16_t RGBmatrixPanel::refreshRate(void) {
+  uint32_t rowTicks = (uint32_t)bcmBase * ((1 << nPlanes) - 1);
+  return F_CPU / ((uint32_t)prescale * rowTicks * nRows);
+}
+
+// Percentage of CPU time spent in the interrupt, from the ticks measured
+// over the last complete row plus the call overhead at either end.
+uint8_t RGBmatrixPanel::cpuLoad(void) {
+  uint32_t rowTicks = (uint32_t)bcmBase * ((1 << nPlanes) - 1), busy;
+
+  cli();
+  busy = rowBusyTicks;
+  sei();
+  busy += (uint32_t)bcmOverhead * 2 * nPlanes;
+  return busy * 100 / rowTicks;
+}
 
 // The flow of the interrupt can be awkward to grasp, because data is
 // being issued to the LED matrix for the *next* bitplane and/or row
@@ -453,8 +638,8 @@ ISR(TIMER1_OVF_vect, ISR_BLOCK) { // ISR_BLOCK important -- see notes later
 // function...hopefully tenses are sufficiently commented.
 
 void RGBmatrixPanel::updateDisplay(void) {
-  uint8_t  i, tick, tock, *ptr;
-  uint16_t t, duration;
+  uint8_t  tick, tock, *ptr;
+  uint16_t i, duration; // i: chains of 8+ panels are over 255 columns
   uint8_t panelcount;
 
   *oeport  |= oepin;  // Disable LED output during row/plane switchover
@@ -466,8 +651,7 @@ void RGBmatrixPanel::updateDisplay(void) {
   // result because that time is implicit between the timer overflow
   // (interrupt triggered) and the initial LEDs-off line at the start
   // of this method.
-  t = (nRows > 8) ? LOOPTIME : (LOOPTIME * 2);
-  duration = ((t + CALLOVERHEAD * 2) << plane) - CALLOVERHEAD;
+  duration = (bcmBase << plane) - bcmOverhead;
 
   // Borrowing a technique here from Ray's Logic:
   // www.rayslogic.com/propeller/Programming/AdafruitRGB/AdafruitRGB.htm
@@ -479,6 +663,8 @@ void RGBmatrixPanel::updateDisplay(void) {
 
   if(++plane >= nPlanes) {      // Advance plane counter.  Maxed out?
     plane = 0;                  // Yes, reset to plane 0, and
+    rowBusyTicks = busyTicks;   // note time spent on the last row,
+    busyTicks    = 0;
     if(++row >= nRows) {        // advance row counter.  Maxed out?
       row     = 0;              // Yes, reset row counter, then...
       if(swapflag == true) {    // Swap front/back buffers if requested
@@ -522,11 +708,11 @@ void RGBmatrixPanel::updateDisplay(void) {
   tock = SCLKPORT;
   tick = tock | sclkpin;
 
-  if(plane > 0) { // 188 ticks from TCNT1=0 (above) to end of function
+  if((plane > 0) || (nPlanes < 4)) { // 188 ticks from TCNT1=0 (above) to end of function
 
-    // Planes 1-3 copy bytes directly from RAM to PORT without unpacking.
-    // The least 2 bits (used for plane 0 data) are presumed masked out
-    // by the port direction bits.
+    // Planes 1+ (and all planes when unpacked) copy bytes directly from
+    // RAM to PORT without unpacking.  The least 2 bits (used for plane 0
+    // data) are presumed masked out by the port direction bits.
 
 #if defined(__AVR__)    
     // A tiny bit of inline assembly is used; compiler doesn't pick
@@ -587,5 +773,6 @@ void RGBmatrixPanel::updateDisplay(void) {
 
     } 
   }
+  busyTicks += TCNT1; // Time spent loading data, for cpuLoad()
 }
 
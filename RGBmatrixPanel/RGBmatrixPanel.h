@@ -6,6 +6,12 @@
 #endif
 #include "Adafruit_GFX.h"
 
+// Panel layouts for the tiled constructors.  Tiles are numbered along the
+// chain from the top left, one row of tiles at a time:
+#define TILE_PROGRESSIVE 0x00 // Every row of tiles chained left to right
+#define TILE_SERPENTINE  0x01 // Odd rows chained right to left (zig-zag)
+#define TILE_ROTATE      0x02 // Panels in odd rows mounted upside down
+
 class RGBmatrixPanel : public Adafruit_GFX {
 
  public:
@@ -24,6 +30,37 @@ class RGBmatrixPanel : public Adafruit_GFX {
   RGBmatrixPanel(uint8_t a, uint8_t b, uint8_t c, uint8_t d,
     uint8_t sclk, uint8_t latch, uint8_t oe, boolean dbuf,uint8_t pwidth);
 
+  // Constructors for a wall of tilesx by tilesy panels, all in one chain,
+  // drawn as a single (32 * tilesx) by (16 or 32 * tilesy) canvas.  layout
+  // is TILE_PROGRESSIVE, or TILE_SERPENTINE and/or TILE_ROTATE, e.g. a
+  // 64x64 wall of four 32x32 panels cabled in a zig-zag:
+  //   RGBmatrixPanel(A, B, C, D, CLK, LAT, OE, true, 2, 2,
+  //     TILE_SERPENTINE | TILE_ROTATE);
+  RGBmatrixPanel(uint8_t a, uint8_t b, uint8_t c,
+    uint8_t sclk, uint8_t latch, uint8_t oe, boolean dbuf,
+    uint8_t tilesx, uint8_t tilesy, uint8_t layout);
+  RGBmatrixPanel(uint8_t a, uint8_t b, uint8_t c, uint8_t d,
+    uint8_t sclk, uint8_t latch, uint8_t oe, boolean dbuf,
+    uint8_t tilesx, uint8_t tilesy, uint8_t layout);
+
+  // Number of bitplanes (3 to 8, default 4) -- more gives smoother color,
+  // fewer gives a faster refresh and less CPU time in the interrupt.  With
+  // gflag set, 5/6/5 colors are gamma corrected as they're drawn, which
+  // makes use of all 2^planes levels; don't also pass gflag to Color888()
+  // or ColorHSV() then.  Call before begin(); returns false (and leaves the
+  // panel at 4 planes) if there isn't enough RAM, or at fewer planes than
+  // asked if the chain is too long for the longest interval to fit Timer1.
+  boolean
+    setPlanes(uint8_t planes, boolean gflag = false);
+
+  // Refresh report: whole-screen refresh rate in Hz, as set by the plane
+  // count and panel size, and the percentage of CPU time spent in the
+  // refresh interrupt, measured as it runs.
+  uint16_t
+    refreshRate(void);
+  uint8_t
+    cpuLoad(void);
+
   void
     begin(void),
     drawPixel(int16_t x, int16_t y, uint16_t c),
@@ -44,8 +81,18 @@ class RGBmatrixPanel : public Adafruit_GFX {
  private:
 
   uint8_t *matrixbuff[2];
-  uint8_t nRows, nPlanes, backindex, nPanels;
-  boolean swapflag;
+  uint8_t nRows, nPlanes, backindex, nPanels, tilesX, tilesY, tileLayout;
+  boolean swapflag, dbuffered;
+  uint16_t buffsize;
+
+  // 6-bit color component -> bitplane level, built by setPlanes():
+  uint8_t level[64];
+
+  // BCM timing, in Timer1 ticks (after prescaler):
+  uint16_t bcmBase, bcmOverhead;
+  uint8_t  prescale;
+
+  boolean alloc(void);
 
   // Init/alloc code common to both constructors:
   void init(uint8_t rows, uint8_t a, uint8_t b, uint8_t c,
@@ -61,5 +108,6 @@ class RGBmatrixPanel : public Adafruit_GFX {
   // Counters/pointers for interrupt handler:
   volatile uint8_t row, plane;
   volatile uint8_t *buffptr;
+  volatile uint16_t busyTicks, rowBusyTicks;
 };
 
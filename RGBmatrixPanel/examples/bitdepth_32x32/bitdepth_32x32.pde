@@ -0,0 +1,64 @@
+// Bit depth demo for RGBmatrixPanel library.
+// Draws red, green, blue and white ramps on a 32x32 RGB LED matrix and
+// reports refresh rate and CPU load on the Serial Monitor (9600 baud).
+// Change PLANES to trade smoother color for flicker and free CPU time:
+// 3 planes = 8 levels per color, 4 = 16 (the default), up to 8 = 256.
+// More planes need more RAM: a 32x32 takes 512 bytes per plane above
+// the first, so 4 planes (1536 bytes) is the most that fits an Uno.
+// 5 and up need a Mega.
+
+#include <Adafruit_GFX.h>   // Core graphics library
+#include <RGBmatrixPanel.h> // Hardware-specific library
+
+#define PLANES 4
+#define GAMMA  true // Gamma correct as drawn, to use all the levels
+
+// If your 32x32 matrix has the SINGLE HEADER input,
+// use this pinout:
+#define CLK 8  // MUST be on PORTB!
+#define OE  9
+#define LAT 10
+#define A   A0
+#define B   A1
+#define C   A2
+#define D   A3
+// If your matrix has the DOUBLE HEADER input, use:
+//#define CLK 8  // MUST be on PORTB!
+//#define LAT 9
+//#define OE  10
+//#define A   A3
+//#define B   A2
+//#define C   A1
+//#define D   A0
+RGBmatrixPanel matrix(A, B, C, D, CLK, LAT, OE, false, 1);
+
+void setup() {
+  int     x, y;
+  uint8_t v;
+
+  Serial.begin(9600);
+  if(!matrix.setPlanes(PLANES, GAMMA)) {
+    Serial.println("Not enough RAM, using 4 planes");
+  }
+  matrix.begin();
+
+  // Plain 5/6/5 colors; gamma (if enabled) is applied by the matrix
+  for(x=0; x < matrix.width(); x++) {
+    v = x * 255 / (matrix.width() - 1);
+    for(y=0; y < 8; y++) {
+      matrix.drawPixel(x, y     , matrix.Color888(v, 0, 0));
+      matrix.drawPixel(x, y +  8, matrix.Color888(0, v, 0));
+      matrix.drawPixel(x, y + 16, matrix.Color888(0, 0, v));
+      matrix.drawPixel(x, y + 24, matrix.Color888(v, v, v));
+    }
+  }
+}
+
+void loop() {
+  Serial.print("Refresh: ");
+  Serial.print(matrix.refreshRate());
+  Serial.print(" Hz, CPU load: ");
+  Serial.print(matrix.cpuLoad());
+  Serial.println("%");
+  delay(1000);
+}
@@ -0,0 +1,51 @@
+// Video wall demo for RGBmatrixPanel library.
+// Four 32x32 panels in one chain, drawn as a single 64x64 canvas.  The
+// chain runs along the top row left to right, then back along the bottom
+// row right to left with those two panels mounted upside down -- the
+// usual zig-zag cabling.  Draws an outline around each panel (to check
+// the layout) and bounces a ball across all four.
+
+// The 64x64 buffer needs 6K of RAM at 4 planes, so this is for the Mega;
+// data lines go on pins 24-29, see the notes in RGBmatrixPanel.cpp.
+
+#include <Adafruit_GFX.h>   // Core graphics library
+#include <RGBmatrixPanel.h> // Hardware-specific library
+
+#define CLK 11  // MUST be on PORTB!
+#define OE  9
+#define LAT 10
+#define A   A0
+#define B   A1
+#define C   A2
+#define D   A3
+
+RGBmatrixPanel matrix(A, B, C, D, CLK, LAT, OE, false, 2, 2,
+  TILE_SERPENTINE | TILE_ROTATE);
+
+int16_t  ballX = 10, ballY = 20, dx = 1, dy = 1;
+
+void setup() {
+  Serial.begin(9600);
+  matrix.begin();
+  Serial.print("Refresh: ");
+  Serial.print(matrix.refreshRate());
+  Serial.println(" Hz");
+}
+
+void loop() {
+  matrix.fillCircle(ballX, ballY, 4, 0);
+
+  // One outline per panel, in a different color each
+  matrix.drawRect( 0,  0, 32, 32, matrix.Color333(7, 0, 0));
+  matrix.drawRect(32,  0, 32, 32, matrix.Color333(0, 7, 0));
+  matrix.drawRect( 0, 32, 32, 32, matrix.Color333(0, 0, 7));
+  matrix.drawRect(32, 32, 32, 32, matrix.Color333(7, 7, 0));
+
+  ballX += dx;
+  ballY += dy;
+  if((ballX <= 5) || (ballX >= matrix.width()  - 6)) dx = -dx;
+  if((ballY <= 5) || (ballY >= matrix.height() - 6)) dy = -dy;
+  matrix.fillCircle(ballX, ballY, 4, matrix.Color333(7, 7, 7));
+
+  delay(20);
+}
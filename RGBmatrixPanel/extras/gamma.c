@@ -3,8 +3,12 @@
 // redirect or copy and paste the results into header file for the
 // RGBmatrixPanel library code.
 // Optional 1 parameter: bit depth (default=4, for 16 output levels).
+// A second table, gamma16, maps the 6-bit color components used by
+// drawPixel() to 16-bit intensities; setPlanes() scales it down to the
+// number of bitplanes in use.
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 
 #define GAMMA 2.5
@@ -31,6 +35,16 @@ int main(int argc, char *argv[])
 		if(i < 255) (void)printf(((i & 7) == 7) ? ",\n  " : ",");
 	}
 
+	(void)printf(
+	  "\n};\n\n"
+	  "static PROGMEM prog_uint16_t gamma16[] = {\n  ");
+
+	for(i=0; i<64; i++) {
+		(void)printf("0x%04x",(int)(pow((float)i / 63.0, GAMMA) *
+		  65535.0 + 0.5));
+		if(i < 63) (void)printf(((i & 7) == 7) ? ",\n  " : ",");
+	}
+
 	(void)puts(
 	  "\n};\n\n"
 	  "#endif // _GAMMA_H_");
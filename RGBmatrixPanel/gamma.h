@@ -38,4 +38,15 @@ static PROGMEM prog_uchar gamma[] = {
   0x0e,0x0e,0x0e,0x0e,0x0f,0x0f,0x0f,0x0f
 };
 
+static PROGMEM prog_uint16_t gamma16[] = {
+  0x0000,0x0002,0x000c,0x0020,0x0043,0x0074,0x00b7,0x010e,
+  0x0179,0x01fa,0x0292,0x0343,0x040e,0x04f4,0x05f6,0x0715,
+  0x0852,0x09af,0x0b2c,0x0cc9,0x0e89,0x106c,0x1273,0x149e,
+  0x16ee,0x1965,0x1c03,0x1ec8,0x21b6,0x24cd,0x280f,0x2b7b,
+  0x2f12,0x32d6,0x36c6,0x3ae4,0x3f30,0x43ab,0x4855,0x4d30,
+  0x523b,0x5777,0x5ce6,0x6287,0x685b,0x6e63,0x749f,0x7b10,
+  0x81b7,0x8893,0x8fa7,0x96f1,0x9e73,0xa62d,0xae21,0xb64d,
+  0xbeb3,0xc754,0xd030,0xd947,0xe29a,0xec29,0xf5f5,0xffff
+};
+
 #endif // _GAMMA_H_
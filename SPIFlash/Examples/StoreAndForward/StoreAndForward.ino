@@ -0,0 +1,127 @@
+/*
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License version 2
+ * or the GNU Lesser General Public License version 2.1, both as
+ * published by the Free Software Foundation.
+ */
+
+// This sketch is an example of using SPIFlashQueue to keep sensor samples on the
+// SPI flash chip while the uplink is down, and upload them when it comes back.
+// Every sample is queued first; the queue is then drained in batches of up to
+// BATCH samples per request with SensuinoEth::postSense(size, data), and a batch
+// is only taken off the queue once its request has gone through. The queue
+// survives a reset, so nothing queued is lost if the power goes either.
+// The same pattern works for XivelyClient::put() or ERxPachube: queue the
+// datastream id and value, and on draining set them on the feed and put() it.
+// Backlog, drain rate and the other counters are printed every minute.
+
+#include <SPIFlash.h>
+#include <SPIFlashQueue.h>
+#include <SensuinoEth.h>
+#include <Ethernet.h>
+#include <SPI.h>
+
+#define SERIAL_BAUD      115200
+#define SAMPLE_PERIOD    10000        // ms between samples
+#define RETRY_PERIOD     30000        // ms to wait after a failed upload
+#define REPORT_PERIOD    60000        // ms between printing the queue's counters
+#define BATCH            8            // samples per request
+#define VALUE_SIZE       12
+
+//////////////////////////////////////////
+// flash(SPI_CS, MANUFACTURER_ID)
+// SPI_CS          - CS pin attached to SPI flash chip (8 in case of Moteino)
+// MANUFACTURER_ID - OPTIONAL, 0x1F44 for adesto(ex atmel) 4mbit flash
+//                             0xEF30 for windbond 4mbit flash
+//////////////////////////////////////////
+SPIFlash flash(8, 0xEF30);
+// the queue takes 64 sectors (256Kbytes) from the start of the chip
+SPIFlashQueue queue(flash, 0, 64);
+SensuinoEth pf;
+
+const unsigned long feed_id = 0000; //Set feed ID
+
+// a queued record is the feed id followed by the value's characters
+struct Sample {
+  unsigned long feed_id;
+  char value[VALUE_SIZE];
+};
+
+Sample batch[BATCH];
+char values[BATCH][VALUE_SIZE + 1];
+SenseData postData[BATCH];
+unsigned long lastSample = 0, lastFailure = 0, lastReport = 0;
+boolean failed = false;
+
+void setup() {
+  Serial.begin(SERIAL_BAUD);
+  byte err;
+  if (!flash.initialize()) {
+    Serial.println("SPI Flash init FAIL!");
+    while (1);
+  }
+  if (queue.begin()) {
+    Serial.print("Queue found, backlog ");
+    Serial.println(queue.backlog());
+  }
+  else
+    Serial.println("New queue");
+
+  pf.init(&err, 1, "aa:bb:cc:dd:ee:ff");
+  pf.setSenseKey("your-sense-key-goes-here");//Enter your Sen.se key
+  Serial.println("Init done");
+}
+
+void loop() {
+  if (millis() - lastSample >= SAMPLE_PERIOD) {
+    lastSample = millis();
+    Sample s;
+    s.feed_id = feed_id;
+    ltoa(analogRead(A0), s.value, 10);
+    queue.push(&s, sizeof(s.feed_id) + strlen(s.value));
+  }
+
+  if (queue.backlog() && (!failed || millis() - lastFailure >= RETRY_PERIOD))
+    drain();
+
+  if (millis() - lastReport >= REPORT_PERIOD) {
+    lastReport = millis();
+    Serial.print("backlog ");
+    Serial.print(queue.backlog());
+    Serial.print(" pushed ");
+    Serial.print(queue.pushed());
+    Serial.print(" drained ");
+    Serial.print(queue.drained());
+    Serial.print(" dropped ");
+    Serial.print(queue.dropped());
+    Serial.print(" drain rate ");
+    Serial.print(queue.drainRate());
+    Serial.println("/s");
+  }
+}
+
+// upload the queue a batch at a time, until it's empty or a request fails
+void drain() {
+  int len;
+  byte n;
+  do {
+    for (n = 0; n < BATCH && (len = queue.readNext(&batch[n], sizeof(Sample))) >= 0; n++) {
+      len -= sizeof(batch[n].feed_id);
+      memcpy(values[n], batch[n].value, len);
+      values[n][len] = 0;
+      postData[n].feed_id = batch[n].feed_id;
+      postData[n].value = values[n];
+    }
+    if (n == 0)
+      break;
+    if (!pf.postSense(n, postData)) {
+      // leave them queued for the next try
+      queue.rewind();
+      failed = true;
+      lastFailure = millis();
+      return;
+    }
+    queue.commit();
+    failed = false;
+  } while (n == BATCH);
+}
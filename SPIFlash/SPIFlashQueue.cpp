@@ -0,0 +1,244 @@
+/*
+ * Persistent store-and-forward queue on SPI flash memory, for arduino/moteino.
+ * DEPENDS ON: SPIFlash library
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License version 2
+ * or the GNU Lesser General Public License version 2.1, both as
+ * published by the Free Software Foundation.
+ */
+
+#include <SPIFlashQueue.h>
+
+/// startAddr must be on a 4K boundary; the queue takes sectors*4K bytes from there (at least 2 sectors)
+SPIFlashQueue::SPIFlashQueue(SPIFlash& flash, long startAddr, word sectors) : _flash(flash) {
+  _startAddr = startAddr;
+  _sectors = sectors < 2 ? 2 : sectors;
+  _headSector = _tailSector = _readSector = 0;
+  _headOffset = _tailOffset = _readOffset = SPIFLASHQUEUE_HEADER;
+  _headSeq = 0;
+  _readCount = 0;
+  _readStart = 0;
+  _backlog = _pushed = _drained = _dropped = 0;
+  _drainRate = 0;
+}
+
+/// Find the queue left in flash by the last run, picking up where it left off
+/// Returns false if there wasn't one (a new, empty queue is started)
+/// Call format() instead the first time, or if the flash was used for something else
+boolean SPIFlashQueue::begin() {
+  word seq, newestSeq = 0;
+  boolean found = false;
+  _backlog = _pushed = _drained = _dropped = 0;
+  _drainRate = 0;
+  _readCount = 0;
+
+  // the head is in the sector with the newest sequence number
+  for (word s = 0; s < _sectors; s++)
+    if (readSectorHeader(s, &seq) && (!found || (int16_t)(seq - newestSeq) > 0)) {
+      _headSector = s;
+      newestSeq = seq;
+      found = true;
+    }
+  if (!found) {
+    startSector(0, 0);
+    _headSector = _tailSector = _readSector = 0;
+    _headOffset = _tailOffset = _readOffset = SPIFLASHQUEUE_HEADER;
+    _headSeq = 0;
+    return false;
+  }
+  _headSeq = newestSeq;
+
+  // the oldest sector still in use is where the run of sequence numbers ending there starts
+  word oldest = _headSector;
+  for (word n = 1; n < _sectors; n++) {
+    word prev = oldest ? oldest - 1 : _sectors - 1;
+    if (!readSectorHeader(prev, &seq) || seq != (word)(newestSeq - n)) break;
+    oldest = prev;
+  }
+
+  // walk the records to the end of the head sector, counting the ones still queued
+  word sector = oldest, offset = SPIFLASHQUEUE_HEADER;
+  byte len, state;
+  found = false;
+  _headOffset = SPIFLASHQUEUE_SECTOR; // so only the end of the records stops nextRecord()
+  while (nextRecord(&sector, &offset, &len, &state)) {
+    if (state == SPIFLASHQUEUE_QUEUED) {
+      if (!found) {
+        _tailSector = sector;
+        _tailOffset = offset;
+        found = true;
+      }
+      _backlog++;
+    }
+    offset += 2 + len;
+  }
+  _headOffset = offset;
+  // if the records ended in something other than erased flash (a length byte cut short
+  // by a reset), don't write over it: the next push() starts a new sector
+  if (offset < SPIFLASHQUEUE_SECTOR && _flash.readByte(sectorAddr(sector) + offset) != 0xFF)
+    _headOffset = SPIFLASHQUEUE_SECTOR;
+  if (!found) {
+    _tailSector = _headSector;
+    _tailOffset = _headOffset;
+  }
+  _readSector = _tailSector;
+  _readOffset = _tailOffset;
+  return true;
+}
+
+/// Erase the queue's sectors and start an empty queue
+void SPIFlashQueue::format() {
+  for (word s = 1; s < _sectors; s++)
+    _flash.blockErase4K(sectorAddr(s));
+  startSector(0, 0);
+  _headSector = _tailSector = _readSector = 0;
+  _headOffset = _tailOffset = _readOffset = SPIFLASHQUEUE_HEADER;
+  _headSeq = 0;
+  _readCount = 0;
+  _backlog = 0;
+}
+
+/// Append a record of 1-250 bytes
+/// When the queue is full the oldest sector of records is dropped to make room (see dropped()),
+/// and any batch being read is rewound
+boolean SPIFlashQueue::push(const void* buf, byte len) {
+  if (len == 0 || len > SPIFLASHQUEUE_MAXRECORD) return false;
+
+  if (_headOffset + 2 + len > SPIFLASHQUEUE_SECTOR) {
+    word next = nextSector(_headSector);
+    if (next == _tailSector) {
+      unsigned long lost = countQueued(_tailSector, _tailOffset);
+      _dropped += lost;
+      _backlog -= lost;
+      _tailSector = nextSector(next);
+      _tailOffset = SPIFLASHQUEUE_HEADER;
+      rewind();
+    }
+    startSector(next, ++_headSeq);
+    _headSector = next;
+    _headOffset = SPIFLASHQUEUE_HEADER;
+  }
+
+  // length and data first, then the state byte says it's all there
+  long addr = sectorAddr(_headSector) + _headOffset;
+  _flash.writeByte(addr, len);
+  write(addr + 2, buf, len);
+  _flash.writeByte(addr + 1, SPIFLASHQUEUE_QUEUED);
+  _headOffset += 2 + len;
+  _backlog++;
+  _pushed++;
+  return true;
+}
+
+/// Read the next queued record into buf (up to size bytes), without taking it off the queue
+/// Read as many as will go in one upload, then call commit() if it went or rewind() if not
+/// Returns the record's length, or -1 when there are no more
+int SPIFlashQueue::readNext(void* buf, byte size) {
+  byte len, state;
+  while (nextRecord(&_readSector, &_readOffset, &len, &state)) {
+    long addr = sectorAddr(_readSector) + _readOffset + 2;
+    _readOffset += 2 + len;
+    if (state == SPIFLASHQUEUE_QUEUED) {
+      if (_readCount++ == 0) _readStart = millis();
+      _flash.readBytes(addr, buf, len < size ? len : size);
+      return len;
+    }
+  }
+  return -1;
+}
+
+/// Take the records read since the last commit()/rewind() off the queue
+void SPIFlashQueue::commit() {
+  word sector = _tailSector, offset = _tailOffset;
+  byte len, state;
+  word sent = 0;
+  while (!(sector == _readSector && offset == _readOffset)
+         && nextRecord(&sector, &offset, &len, &state)
+         && !(sector == _readSector && offset == _readOffset)) {
+    if (state == SPIFLASHQUEUE_QUEUED) {
+      _flash.writeByte(sectorAddr(sector) + offset + 1, SPIFLASHQUEUE_SENT);
+      sent++;
+    }
+    offset += 2 + len;
+  }
+  _tailSector = _readSector;
+  _tailOffset = _readOffset;
+  _backlog -= sent;
+  _drained += sent;
+
+  if (sent) {
+    unsigned long elapsed = millis() - _readStart;
+    unsigned long rate = sent * 1000UL / (elapsed ? elapsed : 1);
+    if (rate > 0xFFFF) rate = 0xFFFF;
+    _drainRate = _drainRate ? (word)((_drainRate * 3UL + rate) / 4) : (word)rate;
+  }
+  _readCount = 0;
+}
+
+/// Put the records read since the last commit() back, to be read again
+void SPIFlashQueue::rewind() {
+  _readSector = _tailSector;
+  _readOffset = _tailOffset;
+  _readCount = 0;
+}
+
+boolean SPIFlashQueue::readSectorHeader(word sector, word* seq) {
+  byte header[SPIFLASHQUEUE_HEADER];
+  _flash.readBytes(sectorAddr(sector), header, SPIFLASHQUEUE_HEADER);
+  *seq = header[2] | ((word)header[3] << 8);
+  return header[0] == 'S' && header[1] == 'Q';
+}
+
+/// Erase a sector and write its header
+void SPIFlashQueue::startSector(word sector, word seq) {
+  byte header[SPIFLASHQUEUE_HEADER] = { 'S', 'Q', (byte)seq, (byte)(seq >> 8) };
+  _flash.blockErase4K(sectorAddr(sector));
+  _flash.writeBytes(sectorAddr(sector), header, SPIFLASHQUEUE_HEADER);
+}
+
+/// Find the record at or after sector/offset, moving on to the next sector at the end of one
+/// Returns false at the head of the queue
+boolean SPIFlashQueue::nextRecord(word* sector, word* offset, byte* len, byte* state) {
+  byte rec[2];
+  for (;;) {
+    if (*sector == _headSector && *offset >= _headOffset) return false;
+    if (*offset + 2 <= SPIFLASHQUEUE_SECTOR) {
+      _flash.readBytes(sectorAddr(*sector) + *offset, rec, 2);
+      if (rec[0] != 0xFF && rec[0] != 0 && rec[0] <= SPIFLASHQUEUE_MAXRECORD
+          && *offset + 2 + rec[0] <= SPIFLASHQUEUE_SECTOR) {
+        *len = rec[0];
+        *state = rec[1];
+        return true;
+      }
+    }
+    if (*sector == _headSector) return false;
+    *sector = nextSector(*sector);
+    *offset = SPIFLASHQUEUE_HEADER;
+  }
+}
+
+/// Count the records still queued in a sector, from offset on
+unsigned long SPIFlashQueue::countQueued(word sector, word offset) {
+  unsigned long n = 0;
+  word s = sector;
+  byte len, state;
+  while (nextRecord(&s, &offset, &len, &state) && s == sector) {
+    if (state == SPIFLASHQUEUE_QUEUED) n++;
+    offset += 2 + len;
+  }
+  return n;
+}
+
+/// writeBytes() wraps round within a 256 byte page, so split writes at page boundaries
+void SPIFlashQueue::write(long addr, const void* buf, word len) {
+  const byte* p = (const byte*)buf;
+  while (len) {
+    word n = SPIFLASHQUEUE_PAGE - (addr & (SPIFLASHQUEUE_PAGE - 1));
+    if (n > len) n = len;
+    _flash.writeBytes(addr, p, n);
+    addr += n;
+    p += n;
+    len -= n;
+  }
+}
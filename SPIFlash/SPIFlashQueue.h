@@ -0,0 +1,82 @@
+/*
+ * Persistent store-and-forward queue on SPI flash memory, for arduino/moteino.
+ * Records (up to 250 bytes each) are appended to a ring of 4K sectors and read back
+ * oldest first, so samples that couldn't be uploaded survive until the uplink returns.
+ * DEPENDS ON: SPIFlash library
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License version 2
+ * or the GNU Lesser General Public License version 2.1, both as
+ * published by the Free Software Foundation.
+ */
+
+#ifndef _SPIFLASHQUEUE_H_
+#define _SPIFLASHQUEUE_H_
+
+#include <SPIFlash.h>
+
+/// Wear: each sector is only erased when the ring comes back round to it, and
+///       records are never rewritten - reading them and marking them sent only
+///       clears bits in their state byte (1s to 0s needs no erase). There's no
+///       fixed index sector to wear out; begin() finds the queue again by
+///       scanning the sector headers and records.
+///
+/// Layout: each sector starts with a 4 byte header, "SQ" and a 16 bit sequence number
+///         that goes up by one for each sector used. Then come the records:
+///         [length][state][data...], never crossing into the next sector.
+#define SPIFLASHQUEUE_SECTOR      4096
+#define SPIFLASHQUEUE_PAGE        256
+#define SPIFLASHQUEUE_HEADER      4
+#define SPIFLASHQUEUE_MAXRECORD   250
+
+/// Record states, written over the erased 0xFF
+#define SPIFLASHQUEUE_WRITING     0xFF        // data may not all be there (power lost mid-write), skipped
+#define SPIFLASHQUEUE_QUEUED      0x7F        // waiting to be sent
+#define SPIFLASHQUEUE_SENT        0x3F        // sent, skipped from now on
+
+class SPIFlashQueue {
+public:
+  SPIFlashQueue(SPIFlash& flash, long startAddr, word sectors);
+  boolean begin();
+  void format();
+  boolean push(const void* buf, byte len);
+  int readNext(void* buf, byte size);
+  void commit();
+  void rewind();
+
+  /// Metrics
+  unsigned long backlog() { return _backlog; }     // records waiting to be sent
+  unsigned long pushed() { return _pushed; }       // records queued since begin()
+  unsigned long drained() { return _drained; }     // records sent since begin()
+  unsigned long dropped() { return _dropped; }     // oldest records overwritten when the queue was full
+  word drainRate() { return _drainRate; }          // records per second while draining, averaged over recent batches
+
+protected:
+  long sectorAddr(word sector) { return _startAddr + (long)sector * SPIFLASHQUEUE_SECTOR; }
+  word nextSector(word sector) { return (sector + 1 == _sectors) ? 0 : sector + 1; }
+  boolean readSectorHeader(word sector, word* seq);
+  void startSector(word sector, word seq);
+  boolean nextRecord(word* sector, word* offset, byte* len, byte* state);
+  unsigned long countQueued(word sector, word fromOffset);
+  void write(long addr, const void* buf, word len);
+
+  SPIFlash& _flash;
+  long _startAddr;
+  word _sectors;
+  word _headSector;      // where the next record goes
+  word _headOffset;
+  word _headSeq;
+  word _tailSector;      // oldest record that may still be waiting
+  word _tailOffset;
+  word _readSector;      // next record readNext() looks at
+  word _readOffset;
+  word _readCount;       // records read since the last commit()
+  unsigned long _readStart;
+  unsigned long _backlog;
+  unsigned long _pushed;
+  unsigned long _drained;
+  unsigned long _dropped;
+  word _drainRate;
+};
+
+#endif
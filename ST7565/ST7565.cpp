@@ -381,15 +381,25 @@ void ST7565::begin(uint8_t contrast) {
 
 void ST7565::st7565_init(void) {
   // set pin directions
-  pinMode(sid, OUTPUT);
-  pinMode(sclk, OUTPUT);
+  if (hwSPI) {
+    SPI.begin();
+#ifdef __SAM3X8E__
+    SPI.setClockDivider(9); // 9.3 MHz
+#else
+    SPI.setClockDivider(SPI_CLOCK_DIV2); // 8 MHz
+#endif
+  } else {
+    pinMode(sid, OUTPUT);
+    pinMode(sclk, OUTPUT);
+  }
   pinMode(a0, OUTPUT);
   pinMode(rst, OUTPUT);
   pinMode(cs, OUTPUT);
 
   // toggle RST low to reset; CS low so it'll listen to us
+  // (with hardware SPI, CS is only low while writing so the bus can be shared)
   if (cs > 0)
-    digitalWrite(cs, LOW);
+    digitalWrite(cs, hwSPI ? HIGH : LOW);
 
   digitalWrite(rst, LOW);
   _delay_ms(500);
@@ -433,6 +443,12 @@ void ST7565::st7565_init(void) {
 }
 
 inline void ST7565::spiwrite(uint8_t c) {
+  if (hwSPI) {
+    if (cs > 0) digitalWrite(cs, LOW);
+    SPI.transfer(c);
+    if (cs > 0) digitalWrite(cs, HIGH);
+    return;
+  }
   shiftOut(sid, sclk, MSBFIRST, c);
   /*
   int8_t i;
@@ -508,6 +524,30 @@ inline void ST7565::spiwrite(uint8_t c) {
 */
 
 }
+// write a run of bytes with one chip select; on AVR the next byte is
+// fetched while the previous one is still shifting out
+void ST7565::spiwrite(const uint8_t *buf, uint8_t n) {
+  if (! n) return;
+  if (! hwSPI) {
+    while (n--) shiftOut(sid, sclk, MSBFIRST, *buf++);
+    return;
+  }
+
+  if (cs > 0) digitalWrite(cs, LOW);
+#ifdef __AVR__
+  SPDR = *buf++;
+  while (--n) {
+    uint8_t c = *buf++;
+    while (!(SPSR & _BV(SPIF)));
+    SPDR = c;
+  }
+  while (!(SPSR & _BV(SPIF)));
+#else
+  while (n--) SPI.transfer(*buf++);
+#endif
+  if (cs > 0) digitalWrite(cs, HIGH);
+}
+
 void ST7565::st7565_command(uint8_t c) {
   digitalWrite(a0, LOW);
 
@@ -519,6 +559,12 @@ void ST7565::st7565_data(uint8_t c) {
 
   spiwrite(c);
 }
+
+void ST7565::st7565_data(const uint8_t *buf, uint8_t n) {
+  digitalWrite(a0, HIGH);
+
+  spiwrite(buf, n);
+}
 void ST7565::st7565_set_brightness(uint8_t val) {
     st7565_command(CMD_SET_VOLUME_FIRST);
     st7565_command(CMD_SET_VOLUME_SECOND | (val & 0x3f));
@@ -567,11 +613,9 @@ void ST7565::display(void) {
     st7565_command(CMD_SET_COLUMN_UPPER | (((col+ST7565_STARTBYTES) >> 4) & 0x0F));
     st7565_command(CMD_RMW);
     
-    for(; col <= maxcol; col++) {
-      //uart_putw_dec(col);
-      //uart_putchar(' ');
-      st7565_data(st7565_buffer[(128*p)+col]);
-    }
+    // the whole span of the page in one go
+    if (maxcol >= col)
+      st7565_data(st7565_buffer+(128*p)+col, maxcol-col+1);
   }
 
 #ifdef enablePartialUpdate
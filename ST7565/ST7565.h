@@ -27,6 +27,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 #else
  #include "WProgram.h"
 #endif
+#include <SPI.h>
 
 #define swap(a, b) { uint8_t t = a; a = b; b = t; }
 
@@ -77,14 +78,17 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
 
 class ST7565 {
  public:
-  ST7565(int8_t SID, int8_t SCLK, int8_t A0, int8_t RST, int8_t CS) :sid(SID), sclk(SCLK), a0(A0), rst(RST), cs(CS) {}
-  ST7565(int8_t SID, int8_t SCLK, int8_t A0, int8_t RST) :sid(SID), sclk(SCLK), a0(A0), rst(RST), cs(-1) {}
+  ST7565(int8_t SID, int8_t SCLK, int8_t A0, int8_t RST, int8_t CS) :sid(SID), sclk(SCLK), a0(A0), rst(RST), cs(CS), hwSPI(false) {}
+  ST7565(int8_t SID, int8_t SCLK, int8_t A0, int8_t RST) :sid(SID), sclk(SCLK), a0(A0), rst(RST), cs(-1), hwSPI(false) {}
+  // hardware SPI: SID and SCLK go to the MOSI and SCK pins
+  ST7565(int8_t A0, int8_t RST, int8_t CS) :sid(-1), sclk(-1), a0(A0), rst(RST), cs(CS), hwSPI(true) {}
 
 
   void st7565_init(void);
   void begin(uint8_t contrast);
   void st7565_command(uint8_t c);
   void st7565_data(uint8_t c);
+  void st7565_data(const uint8_t *buf, uint8_t n);
   void st7565_set_brightness(uint8_t val);
   void clear_display(void);
   void clear();
@@ -112,7 +116,9 @@ class ST7565 {
 
  private:
   int8_t sid, sclk, a0, rst, cs;
+  boolean hwSPI;
   void spiwrite(uint8_t c);
+  void spiwrite(const uint8_t *buf, uint8_t n);
 
   void my_setpixel(uint8_t x, uint8_t y, uint8_t color);
 
@@ -2,6 +2,7 @@
 // Modified from:
 // (c) adafruit industries - public domain!
 
+#include <SPI.h>
 #include "ST7565.h"
 
 int ledPin =  13;    // LED connected to digital pin 13
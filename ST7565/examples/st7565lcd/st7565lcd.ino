@@ -1,3 +1,4 @@
+#include <SPI.h>
 #include "ST7565.h"
 
 int ledPin =  13;    // LED connected to digital pin 13
@@ -13,6 +14,9 @@ int ledPin =  13;    // LED connected to digital pin 13
 #define BACKLIGHT_BLU 11
 
 ST7565 glcd(LCD_SID, LCD_SCLK, LCD_A0, LCD_RST, LCD_CS);
+// Alternately, use hardware SPI (SID to MOSI, SCLK to SCK: pins 11 and 13
+// on an Uno, so move the backlight off pin 11). display() is then much faster
+//ST7565 glcd(LCD_A0, LCD_RST, LCD_CS);
 
 #define LOGO16_GLCD_HEIGHT 16 
 #define LOGO16_GLCD_WIDTH  16 
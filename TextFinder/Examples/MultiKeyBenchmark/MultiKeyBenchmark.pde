@@ -0,0 +1,141 @@
+/*
+ * MultiKeyBenchmark
+ * times getting several fields from a page with findAny (one pass through
+ * the data, whatever order the fields come in) against using find for each
+ * field, which either needs the fields asked for in the order they come or a
+ * fresh copy of the page for each field.
+ * the pages are copies of real responses (an XML weather report and a JSON
+ * feed) kept in program memory and read through a Stream, so no network is
+ * needed. results go to the serial port at 9600 baud.
+ */
+
+#include <TextFinder.h>
+#include <avr/pgmspace.h>
+
+#define RUNS 20
+
+// a Stream reading a string in program memory
+class ProgmemStream : public Stream {
+  const char *data;
+  int pos;
+  int len;
+public:
+  void begin(const char *page) { data = page; pos = 0; len = strlen_P(page); }
+  int charsRead() { return pos; }
+  int available() { return len - pos; }
+  int read() { return pos < len ? pgm_read_byte(data + pos++) : -1; }
+  int peek() { return pos < len ? pgm_read_byte(data + pos) : -1; }
+  void flush() { }
+  size_t write(uint8_t c) { return 0; }
+};
+
+const char weatherPage[] PROGMEM =
+  "<?xml version=\"1.0\"?><xml_api_reply version=\"1\"><weather module_id=\"0\" tab_id=\"0\" "
+  "mobile_row=\"0\" mobile_zipped=\"1\" row=\"0\" section=\"0\" ><forecast_information>"
+  "<city data=\"London, England\"/><postal_code data=\"london,uk\"/><latitude_e6 data=\"\"/>"
+  "<longitude_e6 data=\"\"/><forecast_date data=\"2012-02-23\"/>"
+  "<current_date_time data=\"2012-02-23 12:50:00 +0000\"/><unit_system data=\"US\"/>"
+  "</forecast_information><current_conditions><condition data=\"Partly Cloudy\"/>"
+  "<temp_f data=\"59\"/><temp_c data=\"15\"/><humidity data=\"Humidity: 63%\"/>"
+  "<icon data=\"/ig/images/weather/partly_cloudy.gif\"/>"
+  "<wind_condition data=\"Wind: SW at 17 mph\"/></current_conditions>"
+  "<forecast_conditions><day_of_week data=\"Thu\"/><low data=\"46\"/><high data=\"61\"/>"
+  "<icon data=\"/ig/images/weather/chance_of_rain.gif\"/><condition data=\"Chance of Rain\"/>"
+  "</forecast_conditions><forecast_conditions><day_of_week data=\"Fri\"/><low data=\"45\"/>"
+  "<high data=\"57\"/><icon data=\"/ig/images/weather/mostly_sunny.gif\"/>"
+  "<condition data=\"Mostly Sunny\"/></forecast_conditions><forecast_conditions>"
+  "<day_of_week data=\"Sat\"/><low data=\"41\"/><high data=\"52\"/>"
+  "<icon data=\"/ig/images/weather/sunny.gif\"/><condition data=\"Clear\"/>"
+  "</forecast_conditions><forecast_conditions><day_of_week data=\"Sun\"/><low data=\"43\"/>"
+  "<high data=\"54\"/><icon data=\"/ig/images/weather/partly_cloudy.gif\"/>"
+  "<condition data=\"Partly Cloudy\"/></forecast_conditions></weather></xml_api_reply>";
+
+const char feedPage[] PROGMEM =
+  "{\"id\":15552,\"title\":\"Office environment\",\"private\":\"false\","
+  "\"feed\":\"https://api.xively.com/v2/feeds/15552.json\",\"status\":\"live\","
+  "\"updated\":\"2013-06-10T09:37:51.112000Z\",\"created\":\"2011-01-10T16:28:47.412000Z\","
+  "\"creator\":\"https://xively.com/users/example\",\"version\":\"1.0.0\",\"datastreams\":["
+  "{\"id\":\"humidity\",\"current_value\":\"48.2\",\"at\":\"2013-06-10T09:37:51.006000Z\","
+  "\"max_value\":\"71.0\",\"min_value\":\"22.9\",\"unit\":{\"symbol\":\"%\",\"label\":\"percent\"}},"
+  "{\"id\":\"light\",\"current_value\":\"412\",\"at\":\"2013-06-10T09:37:51.006000Z\","
+  "\"max_value\":\"1023.0\",\"min_value\":\"0.0\"},"
+  "{\"id\":\"pressure\",\"current_value\":\"1013.4\",\"at\":\"2013-06-10T09:37:51.006000Z\","
+  "\"max_value\":\"1036.1\",\"min_value\":\"982.5\",\"unit\":{\"symbol\":\"hPa\",\"label\":\"hectopascal\"}},"
+  "{\"id\":\"temperature\",\"current_value\":\"21.7\",\"at\":\"2013-06-10T09:37:51.006000Z\","
+  "\"max_value\":\"31.2\",\"min_value\":\"12.5\",\"unit\":{\"symbol\":\"C\",\"label\":\"Celsius\"}}],"
+  "\"location\":{\"disposition\":\"fixed\",\"name\":\"Office\",\"exposure\":\"indoor\","
+  "\"domain\":\"physical\",\"lat\":51.5,\"lon\":-0.12}}";
+
+// the fields wanted from each page, not in the order they come in
+// (getFloat skips the text between a key and its value)
+const char *weatherKeys[] = { "<humidity data=", "<temp_c data=", "<wind_condition data=",
+                              "<high data=" };
+const char *feedKeys[] = { "\"temperature\"", "\"humidity\"", "\"pressure\"", "\"light\"" };
+#define FIELDS 4
+
+ProgmemStream page;
+TextFinder finder(page);
+FinderKeys weather;
+FinderKeys feed;
+float values[FIELDS];
+long chars;
+
+// find for each field, with a fresh copy of the page each time
+unsigned long eachField(const char *data, const char **keys) {
+  unsigned long start = micros();
+  chars = 0;
+  for(int r = 0; r < RUNS; r++) {
+    for(int k = 0; k < FIELDS; k++) {
+      page.begin(data);
+      if(finder.find((char *)keys[k]))
+        values[k] = finder.getFloat();
+      chars += page.charsRead();
+    }
+  }
+  return (micros() - start) / RUNS;
+}
+
+// findAny, in one pass through the page
+unsigned long oneFindAny(const char *data, FinderKeys &keys) {
+  unsigned long start = micros();
+  chars = 0;
+  for(int r = 0; r < RUNS; r++) {
+    int key;
+    page.begin(data);
+    for(int found = 0; found < FIELDS && (key = finder.findAny(keys)) >= 0; found++)
+      values[key] = finder.getFloat();
+    chars += page.charsRead();
+  }
+  return (micros() - start) / RUNS;
+}
+
+void report(const char *name, unsigned long us) {
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(us);
+  Serial.print(" us, ");
+  Serial.print(chars / RUNS);
+  Serial.print(" chars read, values");
+  for(int k = 0; k < FIELDS; k++) {
+    Serial.print(' ');
+    Serial.print(values[k]);
+  }
+  Serial.println();
+}
+
+void setup() {
+  Serial.begin(9600);
+  for(int k = 0; k < FIELDS; k++) {
+    if(weather.add(weatherKeys[k]) < 0 || feed.add(feedKeys[k]) < 0) {
+      Serial.println("Keys too long, make MAX_KEY_CHARS bigger");
+      return;
+    }
+  }
+  report("weather, find each field", eachField(weatherPage, weatherKeys));
+  report("weather, findAny", oneFindAny(weatherPage, weather));
+  report("feed, find each field", eachField(feedPage, feedKeys));
+  report("feed, findAny", oneFindAny(feedPage, feed));
+}
+
+void loop() {
+}
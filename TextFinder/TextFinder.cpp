@@ -21,6 +21,8 @@
 #include "TextFinder.h"
 
 #define NO_SKIP_CHAR  1  // a magic char not found in a valid numeric field
+#define NO_KEY        0xff  // FinderKeys node key when no key ends there
+#define INHERITED_KEY 0x80  // flags a node key that ends at a suffix of the node
 
 #if ARDUINO < 19
 // the constructors allow one and only one of the streams to be initialized
@@ -95,6 +97,18 @@
   }
 #endif
   
+  // number of characters of target matched once the character c has been read,
+  // when index characters had matched and c doesn't match the next one:
+  // the longest prefix of target that ends with c (rather than starting again from 0)
+  static byte restart(const char *target, byte index, char c)
+  {
+    for(byte k = index; k > 0; k--){
+      if( target[k-1] == c && strncmp(target, target + index - k + 1, k - 1) == 0)
+        return k;
+    }
+    return 0;
+  }
+
   // public methods
   //
   // find returns true if the target string is found
@@ -115,24 +129,44 @@
     if( *target == 0)
        return true;   // return true if target is a null string 
     while( (c = myRead()) != 0){   
-      if( c == target[index]){        
-        if(++index >= targetLen){ // return true if all chars in the target match
-          return true;    
-        }
-      }
-      else{        
-        index = 0;  // reset index if any char does not match   
+      if( c == target[index])
+        index++;
+      else
+        index = restart(target, index, c);  // fall back to a shorter match if any char does not match
+      if(index >= targetLen){ // return true if all chars in the target match
+        return true;    
       }
-      if(termLen > 0 && c == terminate[termIndex]){
-         if(++termIndex >= termLen)  
-           return false;       // return false if terminate string found before target string
+      if(termLen > 0){
+        if(c == terminate[termIndex])
+          termIndex++;
+        else
+          termIndex = restart(terminate, termIndex, c);
+        if(termIndex >= termLen)  
+          return false;       // return false if terminate string found before target string
       }
-      else
-          termIndex = 0;
     }
     return false;
   }
 
+  // reads until any of the keys is found and returns its number, or -1 if none is found
+  // each character is read once and looked up in the key tree, however many keys there are
+  int TextFinder::findAny(FinderKeys &keys)
+  {
+    byte state = 0;   // the key tree node for the characters matched so far
+    char c;
+
+    if( !keys.built)
+      keys.build();
+    if( keys.keyCount == 0)
+      return -1;
+    while( (c = myRead()) != 0){
+      state = keys.step(state, c);
+      if( keys.nodes[state].key != NO_KEY)
+        return keys.nodes[state].key & ~INHERITED_KEY;
+    }
+    return -1;
+  }
+
     // places the string between the prestring  and poststring in the given buffer
     // buffer must be one more than the longest string to get
     // the string will be truncated to fit the buffer length
@@ -200,7 +234,7 @@
   // as integer version but returns a floating point value
     float TextFinder::getFloat()
     {
-       getFloat(NO_SKIP_CHAR);
+       return getFloat(NO_SKIP_CHAR);
     }
 
   // as above but the given skipChar is ignored
@@ -237,3 +271,98 @@
       else  
         return value;
   }
+
+  // FinderKeys methods
+  //
+  // the keys are held as a tree with a node for each key prefix, linked to its
+  // children by child and sibling; a node's key is the key that ends there,
+  // or (flagged with INHERITED_KEY) the one ending at a shorter suffix of it
+  FinderKeys::FinderKeys()
+  {
+    nodes[0].child = 0;
+    nodes[0].key = NO_KEY;
+    nodeCount = 1;
+    keyCount = 0;
+    built = false;
+  }
+
+  // returns the child of node state for character c, 0 if it has none
+  byte FinderKeys::findChild(byte state, char c)
+  {
+    byte n = nodes[state].child;
+    while( n != 0 && nodes[n].c != c)
+      n = nodes[n].sibling;
+    return n;
+  }
+
+  int FinderKeys::add(const char *key)
+  {
+    byte state = 0;
+
+    if( *key == 0 || keyCount >= INHERITED_KEY - 1)
+      return -1;
+    // follow the prefix already in the tree, then check there is room for the rest
+    while( *key != 0){
+      byte n = findChild(state, *key);
+      if( n == 0)
+        break;
+      state = n;
+      key++;
+    }
+    if( nodeCount + strlen(key) > MAX_KEY_CHARS + 1)
+      return -1;
+    for( ; *key != 0; key++){
+      node *n = &nodes[nodeCount];
+      n->c = *key;
+      n->child = 0;
+      n->sibling = nodes[state].child;
+      n->key = NO_KEY;
+      nodes[state].child = nodeCount;
+      state = nodeCount++;
+    }
+    if( nodes[state].key != NO_KEY && !(nodes[state].key & INHERITED_KEY))
+      return nodes[state].key;   // the same key again
+    nodes[state].key = keyCount;
+    built = false;
+    return keyCount++;
+  }
+
+  // sets the fail links, and the keys nodes inherit through them, a level of
+  // the tree at a time (so a node's fail link is always set before its children's)
+  void FinderKeys::build()
+  {
+    byte queue[MAX_KEY_CHARS];
+    byte head = 0;
+    byte tail = 0;
+
+    for( byte n = nodes[0].child; n != 0; n = nodes[n].sibling){
+      nodes[n].fail = 0;
+      if( nodes[n].key & INHERITED_KEY)
+        nodes[n].key = NO_KEY;
+      queue[tail++] = n;
+    }
+    while( head < tail){
+      byte parent = queue[head++];
+      for( byte n = nodes[parent].child; n != 0; n = nodes[n].sibling){
+        byte f = nodes[parent].fail;
+        byte next;
+        while( (next = findChild(f, nodes[n].c)) == 0 && f != 0)
+          f = nodes[f].fail;
+        nodes[n].fail = next;
+        if( nodes[n].key & INHERITED_KEY)   // (or NO_KEY)
+          nodes[n].key = (nodes[next].key == NO_KEY) ? NO_KEY : (nodes[next].key | INHERITED_KEY);
+        queue[tail++] = n;
+      }
+    }
+    built = true;
+  }
+
+  // returns the node reached from state on reading c, following fail links
+  // back to shorter matches until one can be extended by c (or the root is reached)
+  byte FinderKeys::step(byte state, char c)
+  {
+    byte n;
+    while( (n = findChild(state, c)) == 0 && state != 0)
+      state = nodes[state].fail;
+    return n;
+  }
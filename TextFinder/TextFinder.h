@@ -40,6 +40,39 @@
 #include "Stream.h"
 #endif
 
+// the most characters FinderKeys can hold for all its keys together (a prefix
+// shared by several keys is only counted once); each takes 5 bytes of RAM
+#ifndef MAX_KEY_CHARS
+#define MAX_KEY_CHARS 64
+#endif
+
+// a set of keys for TextFinder::findAny to look for all at once
+// the keys are built into a tree (an Aho-Corasick automaton) so the stream is
+// read just once however many keys there are, and no character is read twice
+class FinderKeys {
+  friend class TextFinder;
+private:
+  struct node {
+    char c;        // character leading to this node from its parent
+    byte child;    // first child, 0 if none
+    byte sibling;  // next child of the same parent, 0 if none
+    byte fail;     // node for the longest suffix that is also a key prefix
+    byte key;      // key ending here (or at a node on the fail chain), 0xff if none
+  } nodes[MAX_KEY_CHARS + 1];  // node 0 is the root (no characters matched)
+  byte nodeCount;
+  byte keyCount;
+  boolean built;   // true when the fail links are up to date
+  void build();
+  byte findChild(byte state, char c);
+  byte step(byte state, char c);
+
+public:
+  FinderKeys();
+  int add(const char *key);   // adds a key and returns its number (0 for the first,
+  // 1 for the next, and so on), or -1 if there isn't room for it
+  int count() { return keyCount; }
+};
+
 class TextFinder {
 private:
 #if ARDUINO < 19  
@@ -70,6 +103,11 @@ public:
 
   boolean findUntil(char *target, char *terminate);   // as above but search ends if the terminate string is found
 
+  int findAny(FinderKeys &keys);   // reads data from the stream until any of the keys is found
+  // returns the number of the key found, or -1 if none is found
+  // the stream is left just after the key, so use the get methods to read the value after it,
+  // then call findAny again for the next key
+
   
   // get methods - these get a numeric value or string from the data stream  
   //
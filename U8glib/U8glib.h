@@ -92,6 +92,11 @@ class U8GLIB : public Print
     void firstPage(void) { u8g_FirstPage(&u8g); }
     uint8_t nextPage(void) { return u8g_NextPage(&u8g); }
     
+    /* display list: execute the picture loop body only once */
+    void setDisplayList(u8g_dl_t *dl, uint8_t *buf, uint16_t size) { u8g_SetDisplayList(&u8g, dl, buf, size); }
+    uint16_t getDisplayListLen(void) { return u8g_GetDisplayListLen(&u8g); }
+    uint8_t isDisplayListOverflow(void) { return u8g_IsDisplayListOverflow(&u8g); }
+    
     /* system commands */
     uint8_t setContrast(uint8_t contrast) { return u8g_SetContrast(&u8g, contrast); }
     
@@ -132,6 +137,7 @@ class U8GLIB : public Print
       
     /* font handling */
     void setFont(const u8g_fntpgm_uint8_t *font) {u8g_SetFont(&u8g, font); }
+    void setFontIndex(u8g_font_index_t *idx, uint16_t *buf, uint8_t size) { u8g_SetFontIndex(&u8g, idx, buf, size); }
     int8_t getFontAscent(void) { return u8g_GetFontAscent(&u8g); }
     int8_t getFontDescent(void) { return u8g_GetFontDescent(&u8g); }
     int8_t getFontLineSpacing(void) { return u8g_GetFontLineSpacing(&u8g); }
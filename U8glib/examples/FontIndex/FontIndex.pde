@@ -0,0 +1,93 @@
+/*
+
+  FontIndex.pde
+  
+  Measure the string drawing speed with and without glyph index.
+  The "gprof" device renders into the page buffer only, so the 
+  result does not include the transfer to the display.
+  The result is written to the serial monitor.
+  
+  Universal 8bit Graphics Library, http://code.google.com/p/u8glib/
+  
+  Copyright (c) 2012, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+  
+*/
+
+#include "U8glib.h"
+
+U8GLIB u8g(&u8g_dev_gprof);
+
+// one entry for each glyph of u8g_font_6x10 (224 glyphs)
+u8g_font_index_t idx;
+uint16_t idx_buf[224];
+
+void draw(void) {
+  u8g.setFont(u8g_font_6x10);
+  u8g.drawStr( 0, 10, "abcdefghijklmnopqrstu");
+  u8g.drawStr( 0, 20, "vwxyz ABCDEFGHIJKLMNO");
+  u8g.drawStr( 0, 30, "PQRSTUVWXYZ 012345678");
+  u8g.drawStr( 0, 40, "~}|{`_^]\\[@?>=<;:/.-");
+}
+
+unsigned long measure(void) {
+  unsigned long t;
+  uint8_t i;
+  t = millis();
+  for( i = 0; i < 20; i++ ) {
+    u8g.firstPage();  
+    do {
+      draw();
+    } while( u8g.nextPage() );
+  }
+  return millis() - t;
+}
+
+void setup(void) {
+  Serial.begin(9600);
+  u8g.setColorIndex(1);
+}
+
+void loop(void) {
+  u8g.setFontIndex(NULL, NULL, 0);
+  Serial.print("without index: ");
+  Serial.print(measure());
+  Serial.println(" ms / 20 frames");
+  
+  u8g.setFontIndex(&idx, idx_buf, 224);
+  Serial.print("with index:    ");
+  Serial.print(measure());
+  Serial.println(" ms / 20 frames");
+  
+  u8g.setFontIndex(&idx, idx_buf, 16);
+  Serial.print("with 16 entries: ");
+  Serial.print(measure());
+  Serial.println(" ms / 20 frames");
+  
+  delay(2000);
+}
+
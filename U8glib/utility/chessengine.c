@@ -36,6 +36,7 @@
 
   Note:
     UNIX_MAIN --> unix console executable
+    LRC_ALPHA_BETA --> alpha-beta search for the computer move, see below
 
   Current Rule Limitation
     - no minor promotion, only "Queening" of the pawn
@@ -138,7 +139,9 @@ king = "K".
 /* This is the build in upper limit of the search stack */
 /* This value defines the amount of memory allocated for the search stack */
 /* The search depth of this chess engine can never exceed this value */
+#ifndef STACK_MAX_SIZE
 #define STACK_MAX_SIZE 5
+#endif
 
 /* chess half move stack: twice the number of undo's, a user can do */ 
 #define CHM_USER_SIZE 6
@@ -153,6 +156,54 @@ typedef int16_t eval_t;	/* a variable type to store results from the evaluation
 #define EVAL_T_MAX 32767
 //#define EVAL_T_WIN 32767
 
+/*
+  LRC_ALPHA_BETA
+    chess_ComputerMove() uses ce_Search(): iterative deepening alpha-beta 
+    with a transposition table and move ordering (hash move, MVV-LVA, killer moves).
+    It returns the same evaluation as the full width search, but visits
+    far fewer positions. It needs some RAM for the move list and the 
+    transposition table, so by default it is only used if there is more 
+    than 2K RAM. Define LRC_ALPHA_BETA or LRC_NO_ALPHA_BETA to override this.
+*/
+#if !defined(LRC_ALPHA_BETA) && !defined(LRC_NO_ALPHA_BETA)
+#if !defined(__AVR__) || (defined(RAMEND) && RAMEND > 0x08ff)
+#define LRC_ALPHA_BETA
+#endif
+#endif
+
+/* the UNIX_MAIN benchmark compares both searches */
+#if defined(LRC_ALPHA_BETA) || defined(UNIX_MAIN)
+#define LRC_WITH_ALPHA_BETA
+#endif
+
+/* number of transposition table entries (8 bytes each), must be a power of two */
+/* other targets get 8K: define LRC_TT_SIZE 4096 (32K) if there is enough RAM */
+#ifndef LRC_TT_SIZE
+#if defined(UNIX_MAIN)
+#define LRC_TT_SIZE 4096
+#elif defined(__AVR__) && defined(RAMEND) && RAMEND <= 0x08ff
+#define LRC_TT_SIZE 16
+#elif defined(__AVR__) && defined(RAMEND) && RAMEND <= 0x21ff
+#define LRC_TT_SIZE 128
+#elif defined(__AVR__) && defined(RAMEND) && RAMEND <= 0x41ff
+#define LRC_TT_SIZE 512
+#else
+#define LRC_TT_SIZE 1024
+#endif
+#endif
+
+/* the move list is shared by all plies of the search (3 bytes per move) */
+/* if the moves of a node do not fit, the search evaluates the node instead */
+#ifndef LRC_MOVE_LIST_SIZE
+#if defined(__AVR__) && defined(RAMEND) && RAMEND <= 0x08ff
+#define LRC_MOVE_LIST_SIZE 120
+#elif defined(__AVR__) && defined(RAMEND) && RAMEND <= 0x21ff
+#define LRC_MOVE_LIST_SIZE 200
+#else
+#define LRC_MOVE_LIST_SIZE (STACK_MAX_SIZE*64)
+#endif
+#endif
+
 /* for maintainance of our own stack: this is the definition of one element on the stack */
 struct _stack_element_struct
 {
@@ -201,6 +252,41 @@ struct _chm_struct
 typedef struct _chm_struct chm_t;
 typedef struct _chm_struct *chm_p;
 
+#ifdef LRC_WITH_ALPHA_BETA
+/* one entry of the move list, generated by ce_LoopPieces() with CHECK_MODE_COLLECT */
+struct _ce_move_struct
+{
+  uint8_t from;
+  uint8_t to;
+  uint8_t order;		/* higher values are searched first */
+};
+typedef struct _ce_move_struct ce_move_t;
+typedef struct _ce_move_struct *ce_move_p;
+
+/* transposition table entry */
+struct _ce_tt_struct
+{
+  uint16_t lock;		/* upper 16 bits of the hash key */
+  eval_t eval;
+  uint8_t depth;		/* remaining search depth of the stored result */
+  uint8_t flags;		/* CE_TT_NONE, CE_TT_EXACT, CE_TT_LOWER, CE_TT_UPPER */
+  uint8_t from;		/* best move, ILLEGAL_POSITION if unknown */
+  uint8_t to;
+};
+typedef struct _ce_tt_struct ce_tt_t;
+typedef struct _ce_tt_struct *ce_tt_p;
+
+#define CE_TT_NONE 0
+#define CE_TT_EXACT 1
+#define CE_TT_LOWER 2
+#define CE_TT_UPPER 3
+
+/* move order values */
+#define CE_ORDER_HASH 255
+#define CE_ORDER_CAPTURE 64
+#define CE_ORDER_KILLER 32
+#endif
+
 /* little rook chess, main structure */
 struct _lrc_struct
 {  
@@ -276,12 +362,28 @@ struct _lrc_struct
 
   /* the half move stack, used for move undo and depth search, size is stored in chm_pos */
   chm_t chm_list[CHM_LIST_SIZE];
+
+#ifdef LRC_WITH_ALPHA_BETA
+  /* zobrist key of the pieces on the board, updated by cp_SetOnBoard() */
+  uint32_t hash;
+  /* color of the side to move at the root of the search */
+  uint8_t root_color;
+  /* number of used entries in move_list */
+  uint16_t move_cnt;
+  /* set by ce_AddMove() if a move did not fit into move_list */
+  uint8_t move_list_full;
+  /* moves of all plies of the current search path */
+  ce_move_t move_list[LRC_MOVE_LIST_SIZE];
+  /* two quiet moves per ply, which caused a beta cutoff: from, to, from, to */
+  uint8_t killer[STACK_MAX_SIZE][4];
+#endif
 };
 typedef struct _lrc_struct lrc_t;
 
 #define CHECK_MODE_NONE 0
 #define CHECK_MODE_MOVEABLE 1
 #define CHECK_MODE_TARGET_MOVE 2
+#define CHECK_MODE_COLLECT 3	/* ce_LoopRecur() only appends the move to the move list */
 
 
 
@@ -293,6 +395,22 @@ u8g_t *lrc_u8g;
 
 lrc_t lrc_obj;
 
+#ifdef LRC_WITH_ALPHA_BETA
+ce_tt_t lrc_tt[LRC_TT_SIZE];
+#endif
+
+#ifdef UNIX_MAIN
+/* number of moves done by the search, for the benchmark */
+uint32_t ce_node_cnt;
+#define ce_CountNode() ce_node_cnt++
+/* number of nodes, which ce_AlphaBeta() evaluated because the move list was full */
+uint32_t ce_cut_cnt;
+#define ce_CountCut() ce_cut_cnt++
+#else
+#define ce_CountNode()
+#define ce_CountCut()
+#endif
+
 
 /*==============================================================*/
 /* forward declarations */
@@ -335,6 +453,11 @@ uint8_t ce_GetPositionAttackWeight(uint8_t pos, uint8_t color);
 void chess_Thinking(void);
 void ce_LoopPieces(void);
 
+#ifdef LRC_WITH_ALPHA_BETA
+static uint32_t ce_ZobristKey(uint8_t cp, uint8_t bpos) U8G_NOINLINE;
+void ce_AddMove(uint8_t to_pos) U8G_NOINLINE;
+#endif
+
 
 /*==============================================================*/
 /* search stack */
@@ -522,7 +645,14 @@ uint8_t cp_GetFromBoard(uint8_t pos)
 void cp_SetOnBoard(uint8_t pos, uint8_t cp)
 {
   /*printf("cp_SetOnBoard gpos:%02x cp:%02x\n", pos, cp);*/
+#ifdef LRC_WITH_ALPHA_BETA
+  uint8_t bpos = cu_gpos2bpos(pos);
+  lrc_obj.hash ^= ce_ZobristKey(lrc_obj.board[bpos], bpos);
+  lrc_obj.hash ^= ce_ZobristKey(cp, bpos);
+  lrc_obj.board[bpos] = cp;
+#else
   lrc_obj.board[cu_gpos2bpos(pos)] = cp;
+#endif
 }
 
 /*==============================================================*/
@@ -1043,8 +1173,18 @@ uint8_t ce_LoopRecur(uint8_t pos)
   if ( cu_IsIllegalPosition(pos, stack_GetCurrElement()->current_color) != 0 )
     return 0;
 
+#ifdef LRC_WITH_ALPHA_BETA
+  /* the alpha-beta search only wants to know the moves */
+  if ( lrc_obj.check_mode == CHECK_MODE_COLLECT )
+  {
+    ce_AddMove(pos);
+    return 1;
+  }
+#endif
+
   /* 2. move piece to the specified position, capture opponent piece if required */
   cu_Move(stack_GetCurrElement()->current_pos, pos);
+  ce_CountNode();
 
   
   /* 3. */
@@ -1568,6 +1708,291 @@ void ce_LoopPieces(void)
   } while( e->current_pos != 0 );
 }
 
+#ifdef LRC_WITH_ALPHA_BETA
+
+/*==============================================================*/
+/* alpha-beta search */
+/*==============================================================*/
+
+/*
+  Zobrist key for a colored piece on a board position (bpos).
+  Instead of a table with 12*64 random numbers (3K flash), the keys are
+  derived from piece and position with an integer hash function.
+  Special values of cp are used for the state, which is not on the board:
+    0x0c: side to move (bpos 0)
+    0x0d/0x0e: pawn double move of white/black (bpos of the pawn)
+    0x0f: castling flags (bpos = castling_possible)
+*/
+static uint32_t ce_ZobristKey(uint8_t cp, uint8_t bpos)
+{
+  uint32_t x;
+  cp &= COLOR_PIECE_MASK;
+  if ( cp == PIECE_NONE )
+    return 0;
+  x = cp;
+  x <<= 6;
+  x |= bpos;
+  x *= 0x9e3779b1UL;
+  x ^= x >> 15;
+  x *= 0x85ebca77UL;
+  x ^= x >> 13;
+  return x;
+}
+
+/* calculate lrc_obj.hash from scratch, required after the board has been changed directly */
+void ce_HashBoard(void)
+{
+  uint8_t i;
+  lrc_obj.hash = 0;
+  for( i = 0; i < 64; i++ )
+    lrc_obj.hash ^= ce_ZobristKey(lrc_obj.board[i], i);
+}
+
+/* the key of the current position: pieces and everything else which has an influence on the moves */
+uint32_t ce_GetHashKey(uint8_t color)
+{
+  uint32_t key = lrc_obj.hash;
+  if ( color != COLOR_WHITE )
+    key ^= ce_ZobristKey(0x0c, 0);
+  if ( lrc_obj.pawn_dbl_move[COLOR_WHITE] != ILLEGAL_POSITION )
+    key ^= ce_ZobristKey(0x0d, cu_gpos2bpos(lrc_obj.pawn_dbl_move[COLOR_WHITE]));
+  if ( lrc_obj.pawn_dbl_move[COLOR_BLACK] != ILLEGAL_POSITION )
+    key ^= ce_ZobristKey(0x0e, cu_gpos2bpos(lrc_obj.pawn_dbl_move[COLOR_BLACK]));
+  key ^= ce_ZobristKey(0x0f, lrc_obj.castling_possible);
+  return key;
+}
+
+void ce_ClearTT(void)
+{
+  uint16_t i;
+  for( i = 0; i < LRC_TT_SIZE; i++ )
+    lrc_tt[i].flags = CE_TT_NONE;
+}
+
+/* called by ce_LoopRecur() in CHECK_MODE_COLLECT */
+void ce_AddMove(uint8_t to_pos)
+{
+  ce_move_p m;
+  /* ce_AlphaBeta() does not search a node with an incomplete move list */
+  if ( lrc_obj.move_cnt >= LRC_MOVE_LIST_SIZE )
+  {
+    lrc_obj.move_list_full = 1;
+    return;
+  }
+  m = lrc_obj.move_list + lrc_obj.move_cnt;
+  m->from = stack_GetCurrElement()->current_pos;
+  m->to = to_pos;
+  lrc_obj.move_cnt++;
+}
+
+/*
+  generate all moves of "color" into the move list, starting at index "start"
+  and assign the order value:
+    hash move: CE_ORDER_HASH
+    captures: CE_ORDER_CAPTURE + 8*victim - attacker (MVV-LVA)
+    killer moves: CE_ORDER_KILLER, CE_ORDER_KILLER-1
+    all others: 0
+*/
+void ce_GenerateMoves(uint8_t ply, uint8_t color, uint8_t hash_from, uint8_t hash_to)
+{
+  ce_move_p m;
+  uint16_t i;
+  uint8_t victim;
+  uint8_t *k = lrc_obj.killer[ply];
+  
+  i = lrc_obj.move_cnt;
+  stack_GetCurrElement()->current_color = color;
+  lrc_obj.check_mode = CHECK_MODE_COLLECT;
+  ce_LoopPieces();
+  lrc_obj.check_mode = CHECK_MODE_NONE;
+  
+  for( m = lrc_obj.move_list + i; i < lrc_obj.move_cnt; i++, m++ )
+  {
+    victim = cp_GetPiece(cp_GetFromBoard(m->to));
+    if ( m->from == hash_from && m->to == hash_to )
+      m->order = CE_ORDER_HASH;
+    else if ( victim != PIECE_NONE )
+      m->order = CE_ORDER_CAPTURE + (victim<<3) - cp_GetPiece(cp_GetFromBoard(m->from));
+    else if ( m->from == k[0] && m->to == k[1] )
+      m->order = CE_ORDER_KILLER;
+    else if ( m->from == k[2] && m->to == k[3] )
+      m->order = CE_ORDER_KILLER-1;
+    else
+      m->order = 0;
+  }
+}
+
+/*
+  negamax alpha-beta search
+    ply:	distance from the root, selects the search stack element and the killer moves
+    depth:	0: evaluate the board after each move, otherwise search "depth" more half moves
+  returns the best evaluation for the side to move, the same value as the 
+  full width search in ce_LoopPieces() with max_depth = ply+depth.
+  At ply 0, the best move is stored in the first element of the search stack.
+*/
+eval_t ce_AlphaBeta(uint8_t ply, uint8_t depth, eval_t alpha, eval_t beta)
+{
+  uint8_t color, best_from, best_to, is_capture;
+  uint16_t start, i, j;
+  eval_t eval, best, alpha_orig = alpha;
+  uint32_t key;
+  ce_tt_p tt;
+  ce_move_p m;
+  
+  color = lrc_obj.root_color ^ (ply & 1);
+  key = ce_GetHashKey(color);
+  tt = lrc_tt + (uint16_t)(key & (LRC_TT_SIZE-1));
+  
+  best_from = ILLEGAL_POSITION;
+  best_to = ILLEGAL_POSITION;
+  if ( tt->flags != CE_TT_NONE && tt->lock == (uint16_t)(key >> 16) )
+  {
+    /* the root must always search, because it has to find the move */
+    if ( ply > 0 && tt->depth >= depth )
+    {
+      if ( tt->flags == CE_TT_EXACT )
+	return tt->eval;
+      if ( tt->flags == CE_TT_LOWER && tt->eval >= beta )
+	return tt->eval;
+      if ( tt->flags == CE_TT_UPPER && tt->eval <= alpha )
+	return tt->eval;
+    }
+    best_from = tt->from;
+    best_to = tt->to;
+  }
+
+  lrc_obj.curr_depth = ply;
+  lrc_obj.curr_element = lrc_obj.stack_memory+ply;
+  start = lrc_obj.move_cnt;
+  ce_GenerateMoves(ply, color, best_from, best_to);
+  if ( lrc_obj.move_list_full != 0 )
+  {
+    /* the move list is full: evaluate this node for "color" instead of */
+    /* searching only some of its moves. The root has to find a move, so */
+    /* it searches the moves which did fit. */
+    lrc_obj.move_list_full = 0;
+    if ( ply > 0 )
+    {
+      lrc_obj.move_cnt = start;
+      ce_CountCut();
+      return ce_Eval();
+    }
+  }
+  
+  best = EVAL_T_MIN;
+  best_from = ILLEGAL_POSITION;
+  best_to = ILLEGAL_POSITION;
+  for( i = start; i < lrc_obj.move_cnt; i++ )
+  {
+    /* bring the move with the highest order value to position i */
+    m = lrc_obj.move_list + i;
+    for( j = i+1; j < lrc_obj.move_cnt; j++ )
+    {
+      if ( lrc_obj.move_list[j].order > m->order )
+	m = lrc_obj.move_list + j;
+    }
+    if ( m != lrc_obj.move_list + i )
+    {
+      ce_move_t tmp = *m;
+      *m = lrc_obj.move_list[i];
+      lrc_obj.move_list[i] = tmp;
+      m = lrc_obj.move_list + i;
+    }
+    
+    is_capture = cp_GetPiece(cp_GetFromBoard(m->to));
+    cu_Move(m->from, m->to);
+    ce_CountNode();
+    if ( depth == 0 )
+    {
+      /* ce_Eval() uses the color of the current stack element */
+      lrc_obj.curr_element = lrc_obj.stack_memory+ply;
+      eval = ce_Eval();
+    }
+    else
+    {
+      eval = -ce_AlphaBeta(ply+1, depth-1, -beta, -alpha);
+    }
+    cu_UndoHalfMove();
+    
+    if ( eval > best )
+    {
+      best = eval;
+      best_from = m->from;
+      best_to = m->to;
+      if ( best > alpha )
+	alpha = best;
+    }
+    if ( alpha >= beta )
+    {
+      /* cutoff: remember quiet moves as killer moves for this ply */
+      if ( is_capture == PIECE_NONE && (lrc_obj.killer[ply][0] != m->from || lrc_obj.killer[ply][1] != m->to) )
+      {
+	lrc_obj.killer[ply][2] = lrc_obj.killer[ply][0];
+	lrc_obj.killer[ply][3] = lrc_obj.killer[ply][1];
+	lrc_obj.killer[ply][0] = m->from;
+	lrc_obj.killer[ply][1] = m->to;
+      }
+      break;
+    }
+  }
+  lrc_obj.move_cnt = start;
+  
+  tt->lock = key >> 16;
+  tt->eval = best;
+  tt->depth = depth;
+  tt->from = best_from;
+  tt->to = best_to;
+  if ( best <= alpha_orig )
+    tt->flags = CE_TT_UPPER;
+  else if ( best >= beta )
+    tt->flags = CE_TT_LOWER;
+  else
+    tt->flags = CE_TT_EXACT;
+  
+  if ( ply == 0 )
+  {
+    lrc_obj.stack_memory[0].best_eval = best;
+    lrc_obj.stack_memory[0].best_from_pos = best_from;
+    lrc_obj.stack_memory[0].best_to_pos = best_to;
+  }
+  return best;
+}
+
+/*
+  find the best move for the side to move with iterative deepening:
+  each iteration fills the transposition table and the killer moves, which
+  improve the move order of the next iteration.
+  The result is stored in the first element of the search stack.
+*/
+void ce_Search(uint8_t depth)
+{
+  uint8_t d;
+  
+  if ( depth >= STACK_MAX_SIZE )
+    depth = STACK_MAX_SIZE-1;
+  
+  stack_Init(0);
+  lrc_obj.root_color = stack_GetCurrElement()->current_color;
+  lrc_obj.move_cnt = 0;
+  lrc_obj.move_list_full = 0;
+  ce_HashBoard();
+  for( d = 0; d < STACK_MAX_SIZE; d++ )
+  {
+    lrc_obj.killer[d][0] = ILLEGAL_POSITION;
+    lrc_obj.killer[d][1] = ILLEGAL_POSITION;
+    lrc_obj.killer[d][2] = ILLEGAL_POSITION;
+    lrc_obj.killer[d][3] = ILLEGAL_POSITION;
+  }
+  
+  for( d = 0; d <= depth; d++ )
+    ce_AlphaBeta(0, d, EVAL_T_MIN, EVAL_T_MAX);
+  
+  lrc_obj.curr_depth = 0;
+  lrc_obj.curr_element = lrc_obj.stack_memory;
+}
+
+#endif
+
 /*==============================================================*/
 /* user interface */
 /*==============================================================*/
@@ -1727,6 +2152,10 @@ void chess_ManualMove(uint8_t src, uint8_t dest)
 /* let the computer do a move */
 void chess_ComputerMove(uint8_t depth)
 {
+#ifdef LRC_ALPHA_BETA
+  cu_ReduceHistoryByFullMove();
+  ce_Search(depth);
+#else
   stack_Init(depth);
   
   //stack_GetCurrElement()->current_color = lrc_obj.ply_count;
@@ -1734,6 +2163,7 @@ void chess_ComputerMove(uint8_t depth)
   
   cu_ReduceHistoryByFullMove();
   ce_LoopPieces();
+#endif
 
   chess_ManualMove(stack_GetCurrElement()->best_from_pos, stack_GetCurrElement()->best_to_pos);
 }
@@ -1745,8 +2175,21 @@ void chess_ComputerMove(uint8_t depth)
 
 #ifdef UNIX_MAIN
 
+/*
+  Build and run, e.g.:
+    gcc -O2 -DUNIX_MAIN -DSTACK_MAX_SIZE=8 -I. chessengine.c -o lrc
+    ./lrc		play one move as before
+    ./lrc perft 4	count move sequences from the start position
+    ./lrc bench 4	compare full width and alpha-beta search up to depth 4
+  A FEN string can be added as last argument to perft and bench.
+*/
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+uint8_t unix_is_quiet = 0;
 
 char *piece_str[] = {
   /* 0x00 */
@@ -1798,6 +2241,8 @@ void chess_Thinking(void)
   uint8_t i;
   uint8_t cp = cp_GetPiece(stack_GetCurrElement()->current_cp);
   
+  if ( unix_is_quiet != 0 )
+    return;
   printf("Thinking:  ", piece_str[cp], stack_GetCurrElement()->current_pos);
   
   for( i = 0; i <= lrc_obj.curr_depth; i++ )
@@ -1833,9 +2278,168 @@ void board_Show(void)
   }
 }
 
-int main(void)
+/* setup the board from the first four fields of a FEN string */
+int unix_SetupFEN(const char *fen)
 {
-  uint8_t depth = 3;
+  const char *pieces = "PNBRQK";
+  const char *p;
+  uint8_t row = 7, col = 0;
+  
+  cu_ClearBoard();
+  lrc_obj.castling_possible = 0;
+  for( ; *fen != ' '; fen++ )
+  {
+    if ( *fen == '\0' )
+      return 0;
+    if ( *fen == '/' )
+    {
+      row--;
+      col = 0;
+    }
+    else if ( *fen >= '1' && *fen <= '8' )
+    {
+      col += *fen - '0';
+    }
+    else
+    {
+      if ( (p = strchr(pieces, *fen)) != NULL )
+	lrc_obj.board[row*8+col] = cp_Construct(COLOR_WHITE, p-pieces+1);
+      else if ( (p = strchr(pieces, *fen - 'a' + 'A')) != NULL )
+	lrc_obj.board[row*8+col] = cp_Construct(COLOR_BLACK, p-pieces+1);
+      else
+	return 0;
+      col++;
+    }
+  }
+  fen++;
+  if ( *fen == 'b' )
+    lrc_obj.ply_count = 1;
+  fen += 2;
+  for( ; *fen != ' ' && *fen != '\0'; fen++ )
+  {
+    if ( *fen == 'Q' ) lrc_obj.castling_possible |= 1;
+    if ( *fen == 'K' ) lrc_obj.castling_possible |= 2;
+    if ( *fen == 'q' ) lrc_obj.castling_possible |= 4;
+    if ( *fen == 'k' ) lrc_obj.castling_possible |= 8;
+  }
+  if ( *fen == ' ' && fen[1] >= 'a' && fen[1] <= 'h' )
+  {
+    /* the engine stores the position of the pawn, not the square behind it */
+    if ( fen[2] == '3' )
+      lrc_obj.pawn_dbl_move[COLOR_WHITE] = 0x30 | (fen[1]-'a');
+    if ( fen[2] == '6' )
+      lrc_obj.pawn_dbl_move[COLOR_BLACK] = 0x40 | (fen[1]-'a');
+  }
+  return 1;
+}
+
+/* number of move sequences with "depth" half moves, including moves which leave the KING in check */
+uint32_t unix_Perft(uint8_t ply, uint8_t depth)
+{
+  uint32_t cnt = 0;
+  uint16_t i, start;
+  ce_move_t m;
+  
+  lrc_obj.curr_depth = ply;
+  lrc_obj.curr_element = lrc_obj.stack_memory+ply;
+  start = lrc_obj.move_cnt;
+  ce_GenerateMoves(ply, (lrc_obj.ply_count+ply) & 1, ILLEGAL_POSITION, ILLEGAL_POSITION);
+  if ( depth <= 1 )
+  {
+    cnt = lrc_obj.move_cnt - start;
+  }
+  else
+  {
+    for( i = start; i < lrc_obj.move_cnt; i++ )
+    {
+      m = lrc_obj.move_list[i];
+      cu_Move(m.from, m.to);
+      cnt += unix_Perft(ply+1, depth-1);
+      cu_UndoHalfMove();
+    }
+  }
+  lrc_obj.move_cnt = start;
+  return cnt;
+}
+
+double unix_Millis(clock_t start)
+{
+  return (double)(clock()-start)*1000.0/CLOCKS_PER_SEC;
+}
+
+void unix_ShowResult(const char *name, double ms)
+{
+  stack_element_p e = lrc_obj.stack_memory;
+  
+  printf("  %-10s %10lu nodes %9.1f ms %8.0f knps  eval %6d  %c%c-%c%c\n", 
+    name, (unsigned long)ce_node_cnt, ms, ms > 0 ? ce_node_cnt/ms : 0.0, e->best_eval, 
+    'a'+(e->best_from_pos&15), '1'+(e->best_from_pos>>4), 'a'+(e->best_to_pos&15), '1'+(e->best_to_pos>>4));
+}
+
+void unix_Bench(uint8_t max_depth)
+{
+  uint8_t depth;
+  clock_t start;
+  
+  if ( max_depth >= STACK_MAX_SIZE )
+    max_depth = STACK_MAX_SIZE-1;
+  for( depth = 1; depth <= max_depth; depth++ )
+  {
+    printf("depth %d (%d half moves)\n", depth, depth+1);
+    
+    cu_ClearMoveHistory();
+    ce_node_cnt = 0;
+    start = clock();
+    stack_Init(depth);
+    ce_LoopPieces();
+    unix_ShowResult("full width", unix_Millis(start));
+    
+    cu_ClearMoveHistory();
+    ce_ClearTT();
+    ce_node_cnt = 0;
+    ce_cut_cnt = 0;
+    start = clock();
+    ce_Search(depth);
+    unix_ShowResult("alpha-beta", unix_Millis(start));
+    if ( ce_cut_cnt > 0 )
+      printf("  %lu nodes evaluated early, increase LRC_MOVE_LIST_SIZE (%d)\n", (unsigned long)ce_cut_cnt, LRC_MOVE_LIST_SIZE);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  if ( argc >= 3 )
+  {
+    uint8_t depth = atoi(argv[2]);
+    
+    unix_is_quiet = 1;
+    chess_SetupBoard();
+    if ( argc >= 4 && unix_SetupFEN(argv[3]) == 0 )
+    {
+      printf("illegal FEN: %s\n", argv[3]);
+      return 1;
+    }
+    board_Show();
+    if ( strcmp(argv[1], "perft") == 0 )
+    {
+      uint8_t d;
+      if ( depth > STACK_MAX_SIZE )
+	depth = STACK_MAX_SIZE;
+      for( d = 1; d <= depth; d++ )
+      {
+	clock_t start = clock();
+	uint32_t cnt = unix_Perft(0, d);
+	double ms = unix_Millis(start);
+	printf("perft %d: %10lu %9.1f ms %8.0f knps\n", d, (unsigned long)cnt, ms, ms > 0 ? cnt/ms : 0.0);
+      }
+    }
+    else
+    {
+      unix_Bench(depth);
+    }
+    return 0;
+  }
+
   chess_SetupBoard();
   board_Show();
   puts("");
@@ -1858,7 +2462,7 @@ int main(void)
   printf("lrc_obj.lost_side_color: %d\n" , lrc_obj.lost_side_color);
   
   board_Show();
-
+  return 0;
 }
 
 
@@ -84,6 +84,8 @@ typedef uint8_t u8g_fntpgm_uint8_t;
 /* forward */
 typedef struct _u8g_t u8g_t;
 typedef struct _u8g_dev_t u8g_dev_t;
+typedef struct _u8g_dl_t u8g_dl_t;
+typedef struct _u8g_font_index_t u8g_font_index_t;
 
 
 /*===============================================================*/
@@ -593,6 +595,9 @@ struct _u8g_t
   uint8_t pin_list[U8G_PIN_LIST_LEN];
   
   u8g_state_cb state_cb;
+  
+  u8g_dl_t *dl;                 /* optional display list, NULL if not used */
+  u8g_font_index_t *font_index; /* optional glyph index, NULL if not used */
 };
 
 #define u8g_GetFontAscent(u8g) ((u8g)->font_ref_ascent)
@@ -669,6 +674,76 @@ void u8g_backup_avr_spi(uint8_t msg);		/* backup SPI state on atmel avr controll
 void u8g_SetHardwareBackup(u8g_t *u8g, u8g_state_cb backup_cb);
 
 
+/* u8g_dl.c */
+
+/*
+  Display list: If a display list is assigned with u8g_SetDisplayList(), the 
+  draw procedures of the first page are not executed but recorded into the 
+  buffer of the display list. u8g_NextPage() will then replay the list for 
+  all pages, so that the picture loop body is executed only once. 
+  If the buffer is too small, the picture loop falls back to the normal 
+  behavior. "len" always contains the required size of the buffer.
+*/
+
+/* font related state, which is restored before a recorded procedure is replayed */
+struct _u8g_dl_font_state_t
+{
+  const u8g_pgm_uint8_t *font;
+  u8g_font_calc_vref_fnptr font_calc_vref;
+  int8_t font_ref_ascent;
+  int8_t font_ref_descent;
+};
+typedef struct _u8g_dl_font_state_t u8g_dl_font_state_t;
+
+struct _u8g_dl_t
+{
+  uint8_t *buf;
+  uint16_t size;                        /* size of buf */
+  uint16_t len;                         /* number of bytes recorded in the last picture loop */
+  uint8_t overflow;                     /* set when an entry did not fit: recording has stopped */
+  uint8_t mode;                         /* one of U8G_DL_MODE_xxx */
+  uint8_t start_color;
+  uint8_t last_color;
+  u8g_dl_font_state_t start_font;
+  u8g_dl_font_state_t last_font;
+};
+
+#define U8G_DL_MODE_NONE 0
+#define U8G_DL_MODE_RECORD 1
+#define U8G_DL_MODE_REPLAY 2
+
+/* commands of the display list */
+#define U8G_DL_PIXEL 0
+#define U8G_DL_8PIXEL 1
+#define U8G_DL_HLINE 2
+#define U8G_DL_VLINE 3
+#define U8G_DL_FRAME 4
+#define U8G_DL_BOX 5
+#define U8G_DL_LINE 6
+#define U8G_DL_CIRCLE 7
+#define U8G_DL_DISC 8
+#define U8G_DL_BITMAPP 9
+#define U8G_DL_XBMP 10
+#define U8G_DL_STR 11
+#define U8G_DL_STRP 12
+#define U8G_DL_GLYPH 13
+#define U8G_DL_COLOR 14
+#define U8G_DL_FONT 15
+
+#define u8g_dl_IsRecording(u8g) ((u8g)->dl != NULL && (u8g)->dl->mode == U8G_DL_MODE_RECORD)
+
+void u8g_SetDisplayList(u8g_t *u8g, u8g_dl_t *dl, uint8_t *buf, uint16_t size);
+uint16_t u8g_GetDisplayListLen(u8g_t *u8g);
+uint8_t u8g_IsDisplayListOverflow(u8g_t *u8g);
+
+void u8g_dl_Add(u8g_t *u8g, uint8_t cmd, u8g_uint_t v0, u8g_uint_t v1, u8g_uint_t v2, u8g_uint_t v3, const void *ptr);
+u8g_uint_t u8g_dl_AddStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const char *s);
+u8g_uint_t u8g_dl_AddStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const u8g_pgm_uint8_t *s);
+int8_t u8g_dl_AddGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t encoding);
+void u8g_dl_FirstPage(u8g_t *u8g);
+uint8_t u8g_dl_NextPage(u8g_t *u8g);
+
+
 /* u8g_dev_rot.c */
 
 void u8g_UndoRotation(u8g_t *u8g);
@@ -679,6 +754,24 @@ void u8g_SetRot270(u8g_t *u8g);
 
 /* u8g_font.c */
 
+/*
+  Glyph index: Offsets of every "step" glyph of one font, built in RAM by 
+  u8g_SetFontIndex() (or by the next u8g_SetFont(), if no font was set). With
+  one entry for each glyph of the font (step = 1), the glyph lookup does not 
+  need to walk through the glyph list any more. Smaller buffers reduce the walk 
+  to at most step-1 glyphs. Other fonts are looked up as before.
+*/
+struct _u8g_font_index_t
+{
+  const u8g_pgm_uint8_t *font;  /* font, for which the index has been built, NULL if invalid */
+  uint16_t *pos;                        /* offset of glyph start+i*step, relative to the font start */
+  uint8_t size;                         /* number of entries in pos */
+  uint8_t step;
+};
+
+void u8g_SetFontIndex(u8g_t *u8g, u8g_font_index_t *idx, uint16_t *buf, uint8_t size);
+void u8g_font_UpdateIndex(u8g_t *u8g);
+
 size_t u8g_font_GetSize(const void *font);
 uint8_t u8g_font_GetFontStartEncoding(const void *font) U8G_NOINLINE;
 uint8_t u8g_font_GetFontEndEncoding(const void *font) U8G_NOINLINE;
@@ -74,6 +74,11 @@ void u8g_DrawHBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, co
 
 void u8g_DrawBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_BITMAPP, x, y, cnt, h, bitmap);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, cnt*8, h) == 0 )
     return;
   while( h > 0 )
@@ -165,6 +170,12 @@ void u8g_DrawXBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint
   b += 7;
   b >>= 3;
   
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_XBMP, x, y, w, h, bitmap);
+    return;
+  }
+  
   if ( u8g_IsBBXIntersection(u8g, x, y, w, h) == 0 )
     return;
   while( h > 0 )
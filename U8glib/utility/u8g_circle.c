@@ -238,6 +238,12 @@ static void u8g_draw_circle_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_
 
 void u8g_DrawCircle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_CIRCLE, x0, y0, rad, option, NULL);
+    return;
+  }
+
   /* check for bounding box */
   {
     u8g_uint_t radp, radp2;
@@ -322,6 +328,12 @@ static void u8g_draw_disc_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_ui
 
 void u8g_DrawDisc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_DISC, x0, y0, rad, option, NULL);
+    return;
+  }
+
   /* check for bounding box */
   {
     u8g_uint_t radp, radp2;
@@ -0,0 +1,435 @@
+/*
+
+  u8g_dl.c
+  
+  display list: record the picture loop once, replay it for all pages
+
+  Universal 8bit Graphics Library
+  
+  Copyright (c) 2012, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+  
+  
+*/
+
+#include <string.h>
+#include "u8g.h"
+
+/*
+  Each entry of the display list starts with the command byte, followed by 
+  the arguments of the command:
+    bits 0..2 of the info byte: number of u8g_uint_t arguments
+    U8G_DL_INFO_PTR: a pointer to a PROGMEM object follows
+    U8G_DL_INFO_STR: a copy of a zero terminated RAM string follows
+  The font state (U8G_DL_FONT) is stored as u8g_dl_font_state_t
+*/
+#define U8G_DL_INFO_PTR 8
+#define U8G_DL_INFO_STR 16
+
+static const uint8_t u8g_dl_info[] PROGMEM = 
+{
+  2,                    /* U8G_DL_PIXEL: x, y */
+  4,                    /* U8G_DL_8PIXEL: x, y, dir, pixel */
+  3,                    /* U8G_DL_HLINE: x, y, w */
+  3,                    /* U8G_DL_VLINE: x, y, h */
+  4,                    /* U8G_DL_FRAME: x, y, w, h */
+  4,                    /* U8G_DL_BOX: x, y, w, h */
+  4,                    /* U8G_DL_LINE: x1, y1, x2, y2 */
+  4,                    /* U8G_DL_CIRCLE: x0, y0, rad, option */
+  4,                    /* U8G_DL_DISC: x0, y0, rad, option */
+  4|U8G_DL_INFO_PTR,    /* U8G_DL_BITMAPP: x, y, cnt, h, bitmap */
+  4|U8G_DL_INFO_PTR,    /* U8G_DL_XBMP: x, y, w, h, bitmap */
+  4|U8G_DL_INFO_STR,    /* U8G_DL_STR: x, y, dir, width, string */
+  4|U8G_DL_INFO_PTR,    /* U8G_DL_STRP: x, y, dir, width, string */
+  4,                    /* U8G_DL_GLYPH: x, y, dir, encoding */
+  1,                    /* U8G_DL_COLOR: color index */
+  0                     /* U8G_DL_FONT: u8g_dl_font_state_t */
+};
+
+void u8g_SetDisplayList(u8g_t *u8g, u8g_dl_t *dl, uint8_t *buf, uint16_t size)
+{
+  u8g->dl = dl;
+  if ( dl == NULL )
+    return;
+  dl->buf = buf;
+  dl->size = size;
+  dl->len = 0;
+  dl->overflow = 0;
+  dl->mode = U8G_DL_MODE_NONE;
+}
+
+uint16_t u8g_GetDisplayListLen(u8g_t *u8g)
+{
+  if ( u8g->dl == NULL )
+    return 0;
+  return u8g->dl->len;
+}
+
+uint8_t u8g_IsDisplayListOverflow(u8g_t *u8g)
+{
+  if ( u8g->dl == NULL )
+    return 0;
+  return u8g->dl->overflow;
+}
+
+/*========================================================================*/
+/* recording */
+
+/* returns NULL if the buffer is too small; recording stops for the rest of the picture loop */
+static uint8_t *u8g_dl_alloc(u8g_dl_t *dl, uint16_t size)
+{
+  uint8_t *p;
+  if ( dl->overflow != 0 )
+    return NULL;
+  if ( size > dl->size - dl->len )
+  {
+    dl->overflow = 1;
+    return NULL;
+  }
+  p = dl->buf + dl->len;
+  dl->len += size;
+  return p;
+}
+
+static void u8g_dl_get_font_state(u8g_t *u8g, u8g_dl_font_state_t *s)
+{
+  s->font = u8g->font;
+  s->font_calc_vref = u8g->font_calc_vref;
+  s->font_ref_ascent = u8g->font_ref_ascent;
+  s->font_ref_descent = u8g->font_ref_descent;
+}
+
+static void u8g_dl_set_font_state(u8g_t *u8g, const u8g_dl_font_state_t *s)
+{
+  u8g->font = s->font;
+  u8g->font_calc_vref = s->font_calc_vref;
+  u8g->font_ref_ascent = s->font_ref_ascent;
+  u8g->font_ref_descent = s->font_ref_descent;
+  u8g_font_UpdateIndex(u8g);
+}
+
+/* add color and font entries, if they have been changed since the last entry */
+static void u8g_dl_sync_state(u8g_t *u8g)
+{
+  u8g_dl_t *dl = u8g->dl;
+  u8g_dl_font_state_t s;
+  uint8_t *p;
+  
+  if ( dl->last_color != u8g_GetColorIndex(u8g) )
+  {
+    dl->last_color = u8g_GetColorIndex(u8g);
+    p = u8g_dl_alloc(dl, 1+sizeof(u8g_uint_t));
+    if ( p != NULL )
+    {
+      u8g_uint_t v = dl->last_color;
+      *p++ = U8G_DL_COLOR;
+      memcpy(p, &v, sizeof(u8g_uint_t));
+    }
+  }
+  
+  u8g_dl_get_font_state(u8g, &s);
+  if ( s.font != dl->last_font.font || s.font_calc_vref != dl->last_font.font_calc_vref 
+    || s.font_ref_ascent != dl->last_font.font_ref_ascent || s.font_ref_descent != dl->last_font.font_ref_descent )
+  {
+    dl->last_font = s;
+    p = u8g_dl_alloc(dl, 1+sizeof(u8g_dl_font_state_t));
+    if ( p != NULL )
+    {
+      *p++ = U8G_DL_FONT;
+      memcpy(p, &s, sizeof(u8g_dl_font_state_t));
+    }
+  }
+}
+
+void u8g_dl_Add(u8g_t *u8g, uint8_t cmd, u8g_uint_t v0, u8g_uint_t v1, u8g_uint_t v2, u8g_uint_t v3, const void *ptr)
+{
+  u8g_uint_t v[4];
+  uint8_t info, cnt;
+  uint16_t size;
+  uint8_t *p;
+  
+  if ( u8g->dl->overflow != 0 )
+    return;
+  
+  u8g_dl_sync_state(u8g);
+  
+  info = u8g_pgm_read(u8g_dl_info+cmd);
+  cnt = info & 7;
+  size = 1 + cnt*sizeof(u8g_uint_t);
+  if ( info & U8G_DL_INFO_PTR )
+    size += sizeof(const void *);
+  if ( info & U8G_DL_INFO_STR )
+    size += strlen((const char *)ptr) + 1;
+  
+  p = u8g_dl_alloc(u8g->dl, size);
+  if ( p == NULL )
+    return;
+  
+  v[0] = v0;
+  v[1] = v1;
+  v[2] = v2;
+  v[3] = v3;
+  
+  *p++ = cmd;
+  memcpy(p, v, cnt*sizeof(u8g_uint_t));
+  p += cnt*sizeof(u8g_uint_t);
+  if ( info & U8G_DL_INFO_PTR )
+    memcpy(p, &ptr, sizeof(const void *));
+  if ( info & U8G_DL_INFO_STR )
+    strcpy((char *)p, (const char *)ptr);
+}
+
+/* string and glyph procedures must return the width, even if nothing is drawn */
+u8g_uint_t u8g_dl_AddStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const char *s)
+{
+  u8g_uint_t w = u8g_GetStrWidth(u8g, s);
+  u8g_dl_Add(u8g, U8G_DL_STR, x, y, dir, w, s);
+  return w;
+}
+
+u8g_uint_t u8g_dl_AddStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, const u8g_pgm_uint8_t *s)
+{
+  u8g_uint_t w = u8g_GetStrWidthP(u8g, s);
+  u8g_dl_Add(u8g, U8G_DL_STRP, x, y, dir, w, s);
+  return w;
+}
+
+int8_t u8g_dl_AddGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t encoding)
+{
+  u8g_dl_Add(u8g, U8G_DL_GLYPH, x, y, dir, encoding, NULL);
+  return u8g_GetGlyphDeltaX(u8g, encoding);
+}
+
+/*========================================================================*/
+/* replay */
+
+/* calculate the bounding box of an entry and check against the current page */
+static uint8_t u8g_dl_is_visible(u8g_t *u8g, uint8_t cmd, u8g_uint_t *v)
+{
+  u8g_uint_t x = v[0];
+  u8g_uint_t y = v[1];
+  u8g_uint_t w = 1;
+  u8g_uint_t h = 1;
+  
+  switch(cmd)
+  {
+    case U8G_DL_PIXEL:
+      break;
+    case U8G_DL_8PIXEL:
+      switch(v[2])
+      {
+        case 0: w = 8; break;
+        case 1: h = 8; break;
+        case 2: x -= 7; w = 8; break;
+        default: y -= 7; h = 8; break;
+      }
+      break;
+    case U8G_DL_HLINE:
+      w = v[2];
+      break;
+    case U8G_DL_VLINE:
+      h = v[2];
+      break;
+    case U8G_DL_FRAME:
+    case U8G_DL_BOX:
+    case U8G_DL_XBMP:
+      w = v[2];
+      h = v[3];
+      break;
+    case U8G_DL_BITMAPP:
+      w = v[2];
+      w *= 8;
+      h = v[3];
+      break;
+    case U8G_DL_LINE:
+      if ( v[2] < x ) { x = v[2]; w = v[0]; } else { w = v[2]; }
+      w -= x;
+      w++;
+      if ( v[3] < y ) { y = v[3]; h = v[1]; } else { h = v[3]; }
+      h -= y;
+      h++;
+      break;
+    case U8G_DL_CIRCLE:
+    case U8G_DL_DISC:
+      w = v[2];
+      w++;
+      x -= w;
+      y -= w;
+      w *= 2;
+      h = w;
+      break;
+    case U8G_DL_STR:
+    case U8G_DL_STRP:
+    case U8G_DL_GLYPH:
+      /* rotated text: leave the check to the glyph procedures */
+      if ( v[2] != 0 )
+        return 1;
+      y += u8g->font_calc_vref(u8g);
+      x += u8g_GetFontBBXOffX(u8g);
+      w = u8g_GetFontBBXWidth(u8g);
+      if ( cmd != U8G_DL_GLYPH )
+        w += v[3];
+      h = u8g_GetFontBBXHeight(u8g);
+      y -= u8g_GetFontBBXOffY(u8g);
+      y -= h;
+      h++;
+      break;
+    default:
+      return 1;
+  }
+  return u8g_IsBBXIntersection(u8g, x, y, w, h);
+}
+
+static void u8g_dl_draw(u8g_t *u8g, uint8_t cmd, u8g_uint_t *v, const void *ptr)
+{
+  switch(cmd)
+  {
+    case U8G_DL_PIXEL: u8g_DrawPixel(u8g, v[0], v[1]); break;
+    case U8G_DL_8PIXEL: u8g_Draw8Pixel(u8g, v[0], v[1], v[2], v[3]); break;
+    case U8G_DL_HLINE: u8g_DrawHLine(u8g, v[0], v[1], v[2]); break;
+    case U8G_DL_VLINE: u8g_DrawVLine(u8g, v[0], v[1], v[2]); break;
+    case U8G_DL_FRAME: u8g_DrawFrame(u8g, v[0], v[1], v[2], v[3]); break;
+    case U8G_DL_BOX: u8g_DrawBox(u8g, v[0], v[1], v[2], v[3]); break;
+    case U8G_DL_LINE: u8g_DrawLine(u8g, v[0], v[1], v[2], v[3]); break;
+    case U8G_DL_CIRCLE: u8g_DrawCircle(u8g, v[0], v[1], v[2], v[3]); break;
+    case U8G_DL_DISC: u8g_DrawDisc(u8g, v[0], v[1], v[2], v[3]); break;
+    case U8G_DL_BITMAPP: u8g_DrawBitmapP(u8g, v[0], v[1], v[2], v[3], (const u8g_pgm_uint8_t *)ptr); break;
+    case U8G_DL_XBMP: u8g_DrawXBMP(u8g, v[0], v[1], v[2], v[3], (const u8g_pgm_uint8_t *)ptr); break;
+    case U8G_DL_STR: u8g_DrawStrDir(u8g, v[0], v[1], v[2], (const char *)ptr); break;
+    case U8G_DL_STRP:
+      switch(v[2])
+      {
+        case 0: u8g_DrawStrP(u8g, v[0], v[1], (const u8g_pgm_uint8_t *)ptr); break;
+        case 1: u8g_DrawStr90P(u8g, v[0], v[1], (const u8g_pgm_uint8_t *)ptr); break;
+        case 2: u8g_DrawStr180P(u8g, v[0], v[1], (const u8g_pgm_uint8_t *)ptr); break;
+        case 3: u8g_DrawStr270P(u8g, v[0], v[1], (const u8g_pgm_uint8_t *)ptr); break;
+      }
+      break;
+    case U8G_DL_GLYPH:
+      switch(v[2])
+      {
+        case 0: u8g_DrawGlyph(u8g, v[0], v[1], v[3]); break;
+        case 1: u8g_DrawGlyph90(u8g, v[0], v[1], v[3]); break;
+        case 2: u8g_DrawGlyph180(u8g, v[0], v[1], v[3]); break;
+        case 3: u8g_DrawGlyph270(u8g, v[0], v[1], v[3]); break;
+      }
+      break;
+    case U8G_DL_COLOR: u8g_SetColorIndex(u8g, v[0]); break;
+  }
+}
+
+static void u8g_dl_replay(u8g_t *u8g)
+{
+  u8g_dl_t *dl = u8g->dl;
+  uint8_t *p = dl->buf;
+  uint8_t *end = p + dl->len;
+  u8g_uint_t v[4];
+  const void *ptr;
+  uint8_t cmd, info, cnt;
+  
+  u8g_SetColorIndex(u8g, dl->start_color);
+  u8g_dl_set_font_state(u8g, &(dl->start_font));
+  
+  while( p < end )
+  {
+    cmd = *p++;
+    if ( cmd == U8G_DL_FONT )
+    {
+      u8g_dl_font_state_t s;
+      memcpy(&s, p, sizeof(u8g_dl_font_state_t));
+      p += sizeof(u8g_dl_font_state_t);
+      u8g_dl_set_font_state(u8g, &s);
+      continue;
+    }
+    
+    info = u8g_pgm_read(u8g_dl_info+cmd);
+    cnt = info & 7;
+    memcpy(v, p, cnt*sizeof(u8g_uint_t));
+    p += cnt*sizeof(u8g_uint_t);
+    ptr = NULL;
+    if ( info & U8G_DL_INFO_PTR )
+    {
+      memcpy(&ptr, p, sizeof(const void *));
+      p += sizeof(const void *);
+    }
+    if ( info & U8G_DL_INFO_STR )
+    {
+      ptr = p;
+      p += strlen((const char *)p) + 1;
+    }
+    
+    if ( u8g_dl_is_visible(u8g, cmd, v) != 0 )
+      u8g_dl_draw(u8g, cmd, v, ptr);
+  }
+}
+
+/*========================================================================*/
+/* picture loop */
+
+void u8g_dl_FirstPage(u8g_t *u8g)
+{
+  u8g_dl_t *dl = u8g->dl;
+  dl->len = 0;
+  dl->overflow = 0;
+  dl->mode = U8G_DL_MODE_RECORD;
+  dl->start_color = u8g_GetColorIndex(u8g);
+  dl->last_color = dl->start_color;
+  u8g_dl_get_font_state(u8g, &(dl->start_font));
+  dl->last_font = dl->start_font;
+}
+
+/*
+  called instead of u8g_NextPage() after the first (recording) pass of the picture loop
+  returns 0 if all pages have been replayed
+  returns 1 if the display list did not fit into the buffer: the first page is still 
+  empty and the picture loop must be executed without display list
+*/
+uint8_t u8g_dl_NextPage(u8g_t *u8g)
+{
+  u8g_dl_t *dl = u8g->dl;
+  
+  if ( dl->overflow != 0 )
+  {
+    dl->mode = U8G_DL_MODE_NONE;
+    return 1;
+  }
+  
+  dl->mode = U8G_DL_MODE_REPLAY;
+  for(;;)
+  {
+    u8g_dl_replay(u8g);
+    if  ( u8g->cursor_fn != (u8g_draw_cursor_fn)0 )
+    {
+      u8g->cursor_fn(u8g);
+    }
+    if ( u8g_NextPageLL(u8g, u8g->dev) == 0 )
+      break;
+  }
+  dl->mode = U8G_DL_MODE_NONE;
+  return 0;
+}
+
@@ -341,6 +341,100 @@ static void u8g_FillEmptyGlyphCache(u8g_t *u8g)
   u8g->glyph_y = 0;
 }
 
+/*========================================================================*/
+/* glyph index */
+
+static void u8g_font_BuildIndex(u8g_t *u8g)
+{
+  u8g_font_index_t *idx = u8g->font_index;
+  uint8_t *p = (uint8_t *)(u8g->font);
+  uint8_t data_structure_size;
+  uint8_t start, end;
+  uint8_t i, j, k;
+  uint8_t mask = 255;
+  uint16_t cnt;
+  
+  idx->font = NULL;
+  if ( u8g->font == NULL || idx->size == 0 )
+    return;
+  
+  data_structure_size = u8g_font_GetFontGlyphStructureSize(u8g->font);
+  if ( u8g_font_GetFormat(u8g->font) == 1 )
+    mask = 15;
+  
+  start = u8g_font_GetFontStartEncoding(u8g->font);
+  end = u8g_font_GetFontEndEncoding(u8g->font);
+  if ( start > end )
+    return;
+  
+  /* number of glyphs per index entry */
+  cnt = end;
+  cnt -= start;
+  cnt++;
+  cnt += idx->size-1;
+  cnt /= idx->size;
+  if ( cnt > 255 )
+    return;
+  idx->step = cnt;
+  
+  p += U8G_FONT_DATA_STRUCT_SIZE;       /* skip font general information */  
+  
+  i = start;
+  j = 0;        /* glyph counter inside one step */
+  k = 0;        /* index entry */
+  for(;;)
+  {
+    if ( j == 0 )
+    {
+      idx->pos[k] = p - (uint8_t *)(u8g->font);
+      k++;
+    }
+    j++;
+    if ( j == idx->step )
+      j = 0;
+    
+    if ( u8g_pgm_read((u8g_pgm_uint8_t *)(p)) == 255 )
+    {
+      p += 1;
+    }
+    else
+    {
+      p += u8g_pgm_read( ((u8g_pgm_uint8_t *)(p)) + 2 ) & mask;
+      p += data_structure_size;
+    }
+    if ( i == end )
+      break;
+    i++;
+  }
+  
+  idx->font = u8g->font;
+}
+
+/*
+  assign a buffer of "size" words for the glyph index of the current font
+  size should be equal to the number of glyphs of the largest font (e.g. 96 for the "r" fonts)
+  the index stays with this font: other fonts use the normal lookup and switching 
+  between fonts never rebuilds it. If no font is set yet, the index is built for the 
+  next font. Call again to index another font.
+  idx == NULL will remove the index
+*/
+void u8g_SetFontIndex(u8g_t *u8g, u8g_font_index_t *idx, uint16_t *buf, uint8_t size)
+{
+  u8g->font_index = idx;
+  if ( idx == NULL )
+    return;
+  idx->pos = buf;
+  idx->size = size;
+  u8g_font_BuildIndex(u8g);
+}
+
+/* called whenever u8g->font changes: builds the index, if it does not belong to a font yet */
+void u8g_font_UpdateIndex(u8g_t *u8g)
+{
+  if ( u8g->font_index != NULL && u8g->font_index->font == NULL )
+    u8g_font_BuildIndex(u8g);
+}
+
 /*
   Find (with some speed optimization) and return a pointer to the glyph data structure
   Also uncompress (format 1) and copy the content of the data structure to the u8g structure
@@ -361,22 +455,38 @@ u8g_glyph_t u8g_GetGlyph(u8g_t *u8g, uint8_t requested_encoding)
   start = u8g_font_GetFontStartEncoding(u8g->font);
   end = u8g_font_GetFontEndEncoding(u8g->font);
 
-  pos = u8g_font_GetEncoding97Pos(u8g->font);
-  if ( requested_encoding >= 97 && pos > 0 )
+  if ( u8g->font_index != NULL && u8g->font_index->font == u8g->font )
   {
-    p+= pos;
-    start = 97;
+    /* the index also requires, that the encoding is inside the font */
+    if ( requested_encoding < start || requested_encoding > end )
+    {
+      u8g_FillEmptyGlyphCache(u8g);
+      return NULL;
+    }
+    i = requested_encoding - start;
+    i /= u8g->font_index->step;
+    p += u8g->font_index->pos[i];
+    start += i * u8g->font_index->step;
   }
-  else 
+  else
   {
-    pos = u8g_font_GetEncoding65Pos(u8g->font);
-    if ( requested_encoding >= 65 && pos > 0 )
+    pos = u8g_font_GetEncoding97Pos(u8g->font);
+    if ( requested_encoding >= 97 && pos > 0 )
     {
       p+= pos;
-      start = 65;
+      start = 97;
+    }
+    else 
+    {
+      pos = u8g_font_GetEncoding65Pos(u8g->font);
+      if ( requested_encoding >= 65 && pos > 0 )
+      {
+        p+= pos;
+        start = 65;
+      }
+      else
+        p += U8G_FONT_DATA_STRUCT_SIZE;       /* skip font general information */  
     }
-    else
-      p += U8G_FONT_DATA_STRUCT_SIZE;       /* skip font general information */  
   }
   
   if ( requested_encoding > end )
@@ -606,6 +716,8 @@ int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 
 int8_t u8g_DrawGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddGlyph(u8g, x, y, 0, encoding);
   y += u8g->font_calc_vref(u8g);
   return u8g_draw_glyph(u8g, x, y, encoding);
 }
@@ -657,6 +769,8 @@ int8_t u8g_draw_glyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding
 
 int8_t u8g_DrawGlyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddGlyph(u8g, x, y, 1, encoding);
   x -= u8g->font_calc_vref(u8g);
   return u8g_draw_glyph90(u8g, x, y, encoding);
 }
@@ -709,6 +823,8 @@ int8_t u8g_draw_glyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
 
 int8_t u8g_DrawGlyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddGlyph(u8g, x, y, 2, encoding);
   y -= u8g->font_calc_vref(u8g);
   return u8g_draw_glyph180(u8g, x, y, encoding);
 }
@@ -763,6 +879,8 @@ int8_t u8g_draw_glyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
 
 int8_t u8g_DrawGlyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddGlyph(u8g, x, y, 3, encoding);
   x += u8g->font_calc_vref(u8g);
   return u8g_draw_glyph270(u8g, x, y, encoding);
 }
@@ -790,6 +908,9 @@ u8g_uint_t u8g_DrawStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
   u8g_uint_t t = 0;
   int8_t d;
   
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStr(u8g, x, y, 0, s);
+  
   y += u8g->font_calc_vref(u8g);
   
   while( *s != '\0' )
@@ -807,6 +928,9 @@ u8g_uint_t u8g_DrawStr90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
   u8g_uint_t t = 0;
   int8_t d;
   
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStr(u8g, x, y, 1, s);
+  
   x -= u8g->font_calc_vref(u8g);
 
   while( *s != '\0' )
@@ -823,6 +947,9 @@ u8g_uint_t u8g_DrawStr180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
 {
   u8g_uint_t t = 0;
   int8_t d;
+  
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStr(u8g, x, y, 2, s);
 
   y -= u8g->font_calc_vref(u8g);
   
@@ -840,6 +967,9 @@ u8g_uint_t u8g_DrawStr270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
 {
   u8g_uint_t t = 0;
   int8_t d;
+  
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStr(u8g, x, y, 3, s);
 
   x += u8g->font_calc_vref(u8g);
 
@@ -875,6 +1005,9 @@ u8g_uint_t u8g_DrawStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_ui
   int8_t d;
   uint8_t c;
   
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStrP(u8g, x, y, 0, s);
+  
   y += u8g->font_calc_vref(u8g);
   
   for(;;)
@@ -895,6 +1028,9 @@ u8g_uint_t u8g_DrawStr90P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_
   u8g_uint_t t = 0;
   int8_t d;
   
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStrP(u8g, x, y, 1, s);
+  
   x -= u8g->font_calc_vref(u8g);
 
   while( *s != '\0' )
@@ -911,6 +1047,9 @@ u8g_uint_t u8g_DrawStr180P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm
 {
   u8g_uint_t t = 0;
   int8_t d;
+  
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStrP(u8g, x, y, 2, s);
 
   y -= u8g->font_calc_vref(u8g);
   
@@ -928,6 +1067,9 @@ u8g_uint_t u8g_DrawStr270P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm
 {
   u8g_uint_t t = 0;
   int8_t d;
+  
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_AddStrP(u8g, x, y, 3, s);
 
   x += u8g->font_calc_vref(u8g);
 
@@ -1402,6 +1544,7 @@ void u8g_SetFont(u8g_t *u8g, const u8g_fntpgm_uint8_t  *font)
     u8g->font = font;
     u8g_UpdateRefHeight(u8g);
     u8g_SetFontPosBaseline(u8g);
+    u8g_font_UpdateIndex(u8g);
   }
 }
 
@@ -45,6 +45,12 @@ void u8g_DrawLine(u8g_t *u8g, u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_u
 
   uint8_t swapxy = 0;
   
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_LINE, x1, y1, x2, y2, NULL);
+    return;
+  }
+
   /* no BBX intersection check at the moment, should be added... */
 
   if ( x1 > x2 ) dx = x1-x2; else dx = x2-x1;
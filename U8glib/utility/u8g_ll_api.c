@@ -163,6 +163,9 @@ static void u8g_init_data(u8g_t *u8g)
   u8g->line_spacing = 0;
   
   u8g->state_cb = u8g_state_dummy_cb;
+  
+  u8g->dl = NULL;
+  u8g->font_index = NULL;
 }
 
 uint8_t u8g_Init(u8g_t *u8g, u8g_dev_t *dev)
@@ -282,11 +285,15 @@ uint8_t u8g_Init8Bit(u8g_t *u8g, u8g_dev_t *dev, uint8_t d0, uint8_t d1, uint8_t
 
 void u8g_FirstPage(u8g_t *u8g)
 {
+  if ( u8g->dl != NULL )
+    u8g_dl_FirstPage(u8g);
   u8g_FirstPageLL(u8g, u8g->dev);
 }
 
 uint8_t u8g_NextPage(u8g_t *u8g)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+    return u8g_dl_NextPage(u8g);
   if  ( u8g->cursor_fn != (u8g_draw_cursor_fn)0 )
   {
     u8g->cursor_fn(u8g);
@@ -302,16 +309,29 @@ uint8_t u8g_SetContrast(u8g_t *u8g, uint8_t contrast)
 
 void u8g_DrawPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_PIXEL, x, y, 0, 0, NULL);
+    return;
+  }
   u8g_DrawPixelLL(u8g, u8g->dev, x, y);
 }
 
 void u8g_Draw8Pixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_8PIXEL, x, y, dir, pixel, NULL);
+    return;
+  }
   u8g_Draw8PixelLL(u8g, u8g->dev, x, y, dir, pixel);
 }
 
 uint8_t u8g_IsBBXIntersection(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h)
 {
+  /* while recording, the object must not be clipped against the first page */
+  if ( u8g_dl_IsRecording(u8g) )
+    return 1;
   return u8g_IsBBXIntersectionLL(u8g, u8g->dev, x, y, w, h);
 }
 
@@ -76,6 +76,11 @@ void u8g_draw_vline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t h)
 
 void u8g_DrawHLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_HLINE, x, y, w, 0, NULL);
+    return;
+  }
   if ( u8g_IsBBXIntersection(u8g, x, y, w, 1) == 0 )
     return;
   u8g_draw_hline(u8g, x, y, w);
@@ -83,6 +88,11 @@ void u8g_DrawHLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
 
 void u8g_DrawVLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_VLINE, x, y, w, 0, NULL);
+    return;
+  }
   u8g_draw_vline(u8g, x, y, w);
 }
 
@@ -91,6 +101,12 @@ void u8g_DrawFrame(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uin
 {
   u8g_uint_t xtmp = x;
   
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_FRAME, x, y, w, h, NULL);
+    return;
+  }
+
   if ( u8g_IsBBXIntersection(u8g, x, y, w, h) == 0 )
     return;
 
@@ -108,6 +124,12 @@ void u8g_DrawFrame(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uin
 /* restrictions: h > 0 */
 void u8g_DrawBox(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h)
 {
+  if ( u8g_dl_IsRecording(u8g) )
+  {
+    u8g_dl_Add(u8g, U8G_DL_BOX, x, y, w, h, NULL);
+    return;
+  }
+
   if ( u8g_IsBBXIntersection(u8g, x, y, w, h) == 0 )
     return;
   
@@ -1,15 +1,14 @@
 #include <Cosm.h>
 #include <HttpClient.h>
-#include <CountingStream.h>
 
 CosmClient::CosmClient(Client& aClient)
-  : _client(aClient)
+  : _client(aClient), _http(aClient), _chunked(false)
 {
 }
 
 int CosmClient::put(CosmFeed& aFeed, const char* aApiKey)
 {
-  HttpClient http(_client);
+  HttpClient& http = _http;
   char path[30];
   buildPath(path, aFeed.id(), "json");
   http.beginRequest();
@@ -19,40 +18,33 @@ int CosmClient::put(CosmFeed& aFeed, const char* aApiKey)
     http.sendHeader("X-ApiKey", aApiKey);
     http.sendHeader("User-Agent", "Cosm-Arduino-Lib/1.0");    
 
-    CountingStream countingStream; // Used to work out how long that data will be
-    for (int i =kCalculateDataLength; i <= kSendData; i++)
+    if (_chunked)
     {
-      Print* s;
-      int len =0;
-      if (i == kCalculateDataLength)
-      {
-        s = &countingStream;
-      }
-      else
-      {
-        s = &http;
-      }
-      len = s->print(aFeed);
-      if (i == kCalculateDataLength)
-      {
-        // We now know how long the data will be...
-        http.sendHeader("Content-Length", len);
-      }
+      // Send the feed in chunks as it's printed
+      http.beginChunkedBody();
+    }
+    else
+    {
+      http.sendHeader("Content-Length", (int)aFeed.length());
     }
+    http.print(aFeed);
     // Now we're done sending the request
     http.endRequest();
 
     ret = http.responseStatusCode();
+    if (ret < 0)
+    {
+      // We didn't get a proper response, so don't try to reuse the connection
+      http.stop();
+      return ret;
+    }
     if ((ret < 200) || (ret > 299))
     {
       // It wasn't a successful response, ensure it's -ve so the error is easy to spot
-      if (ret > 0)
-      {
-        ret = ret * -1;
-      }
+      ret = ret * -1;
     }
-    http.flush();
-    http.stop();
+    // Closes the connection, or with keep-alive gets it ready for next time
+    http.endResponse();
   }
   return ret;
 }
@@ -71,7 +63,7 @@ void CosmClient::buildPath(char* aDest, unsigned long aFeedId, const char* aForm
 
 int CosmClient::get(CosmFeed& aFeed, const char* aApiKey)
 {
-  HttpClient http(_client);
+  HttpClient& http = _http;
   char path[30];
   buildPath(path, aFeed.id(), "csv");
   http.beginRequest();
@@ -83,88 +75,90 @@ int CosmClient::get(CosmFeed& aFeed, const char* aApiKey)
     http.endRequest();
 
     ret = http.responseStatusCode();
+    if (ret < 0)
+    {
+      // We didn't get a proper response, so don't try to reuse the connection
+      http.stop();
+      return ret;
+    }
     if ((ret < 200) || (ret > 299))
     {
       // It wasn't a successful response, ensure it's -ve so the error is easy to spot
-      if (ret > 0)
-      {
-        ret = ret * -1;
-      }
+      ret = ret * -1;
     }
     else
     {
       http.skipResponseHeaders();
-      // Now we need to run through each line, looking to see if it matches one
-      // of the given datastreams.
-      // So that we don't use any more memory than necessary, we'll keep track
-      // of which character we're up to in the ID string, and have a bit-field
-      // of the remaining datastreams that match.  This limits us (if we use
-      // and unsigned long) to 32 datastreams in a feed, but that's probably ok
-      int idIdx = 0;
-      unsigned long idBitfield = 0;
-      for (int i =0; i < aFeed.size(); i++)
-      {
-        idBitfield |= 1 << i;
-      }
-      // As long as we've got bitfields to read
-// FIXME Need to time out if this hangs for too long
-      while ((http.available() && http.connected()))  // srg - changed || to && per: https://github.com/cosm/cosm-arduino/issues/12
+      // Each line of the CSV is a datastream's ID, the time it was last
+      // updated and its value.  Read it a block at a time, straight out of
+      // HttpClient's buffer, and look for the datastreams once we've got
+      // each ID rather than matching them character by character
+      char id[FEED_ID_SIZE];
+      char value[FEED_VALUE_SIZE];
+      FeedReader reader(FEED_CSV, id, sizeof(id), value, sizeof(value));
+      CosmDatastream* match = NULL;
+      unsigned long timeoutStart = millis();
+      while ((millis() - timeoutStart) < http.httpResponseTimeout())
       {
-        if (http.available())
+        const uint8_t* data;
+        int len = http.readInPlace(data);
+        if (len < 0)
+        {
+          // We've read all of the body
+          break;
+        }
+        if (len == 0)
         {
-          char next = http.read();
-          switch (next)
+          if (!http.connected())
           {
-          case ',':
-            // We've reached the end of the ID string, see if it matches any of the
-            // datastreams in the feed
-            // But first skip the updated time, to get to the value
-            http.find(",");
+            break;
+          }
+          // Give some more data time to arrive
+          delay(10);
+          continue;
+        }
+        timeoutStart = millis();
+        while (len > 0)
+        {
+          int used = reader.parse((const char*)data, len);
+          data += used;
+          len -= used;
+          if (reader.event() == FEED_EVENT_ID)
+          {
+            match = NULL;
             for (int i =0; i < aFeed.size(); i++)
             {
-              if ((idBitfield & 1<<i) && (aFeed[i].idLength() == idIdx))
+              if (aFeed[i].hasId(id))
               {
-                // We've found a matching datastream
-                // FIXME cope with any errors returned
-                aFeed[i].updateValue(http);
-                // When we get here we'll be at the end of the line, but if aFeed[i]
-                // was a string or buffer type, we'll have consumed the '\n'
-                next = '\n';
+                match = &aFeed[i];
+                break;
               }
             }
-            // Need to run to the end of the line regardless now
-            // And deliberately drop through into the next case
-            while ((next != '\r')  && (next != '\n') && (http.available() || http.connected()))
-            {
-              next = http.read();
-            }
-          case '\r':
-          case '\n':
-            // We've hit the end of the line, reset everything
-            idIdx = 0;
-            for (int i =0; i < aFeed.size(); i++)
+            if (match && (match->_valueType == DATASTREAM_BUFFER))
             {
-              idBitfield |= 1 << i;
+              // Read the value straight into the datastream's buffer
+              reader.setValueBuffer(match->_value._valueBuffer._buffer, match->_value._valueBuffer._bufferSize);
             }
-            break;
-          default:
-            // Next character of the ID string
-            for (int i =0; i < aFeed.size(); i++)
+            else
             {
-              if (!(idBitfield & 1<<i) || (aFeed[i].idChar(idIdx) != next))
-              {
-                idBitfield &= ~(1<<i);
-              }
-              // else we're still matching
+              reader.setValueBuffer(value, sizeof(value));
             }
-            idIdx++; // onto the next character in the ID
-            break;
-          };
+          }
+          else if ((reader.event() == FEED_EVENT_DATASTREAM) && match)
+          {
+            match->updateValue(reader.value());
+            match = NULL;
+          }
         }
       }
-      delay(10);
+      if ((reader.finish() == FEED_EVENT_DATASTREAM) && match)
+      {
+        // The last line didn't end with a newline
+        match->updateValue(reader.value());
+      }
     }
-    http.stop();
+    // Closes the connection, or with keep-alive gets it ready for next time
+    http.endResponse();
   }
   return ret;
 }
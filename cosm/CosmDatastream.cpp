@@ -51,6 +51,32 @@ int CosmDatastream::updateValue(Stream& aStream)
     }
     break;
   };
+  return 0;
+}
+
+int CosmDatastream::updateValue(const char* aValue)
+{
+  switch (_valueType)
+  {
+  case DATASTREAM_INT:
+    _value._valueInt = atoi(aValue);
+    break;
+  case DATASTREAM_FLOAT:
+    _value._valueFloat = atof(aValue);
+    break;
+  case DATASTREAM_BUFFER:
+    // The value may have been read straight into our buffer already
+    if (aValue != _value._valueBuffer._buffer)
+    {
+      strncpy(_value._valueBuffer._buffer, aValue, _value._valueBuffer._bufferSize-1);
+      _value._valueBuffer._buffer[_value._valueBuffer._bufferSize-1] = '\0';
+    }
+    break;
+  case DATASTREAM_STRING:
+    _valueString = aValue;
+    break;
+  };
+  return 0;
 }
 
 int CosmDatastream::timedRead(Stream& aStream)
@@ -140,34 +166,37 @@ char* CosmDatastream::getBuffer()
 
 size_t CosmDatastream::printTo(Print& aPrint) const
 {
-  size_t count =0;
-  count += aPrint.print("{ \"id\" : \"");
+  FeedWriter writer(&aPrint, FEED_JSON);
+  writeTo(writer);
+  return writer.count();
+}
+
+void CosmDatastream::writeTo(FeedWriter& aWriter) const
+{
   if (_idType == DATASTREAM_STRING)
   {
-    count += aPrint.print(_idString);
+    aWriter.beginDatastream(_idString);
   }
   else
   {
-    count += aPrint.print(_idBuffer._buffer);
+    aWriter.beginDatastream(_idBuffer._buffer);
   }
-  count += aPrint.print("\", \"current_value\" : \"");
   switch (_valueType)
   {
   case DATASTREAM_STRING:
-    count += aPrint.print(_valueString);
+    aWriter.value(_valueString);
     break;
   case DATASTREAM_BUFFER:
-    count += aPrint.print(_value._valueBuffer._buffer);
+    aWriter.value(_value._valueBuffer._buffer);
     break;
   case DATASTREAM_INT:
-    count += aPrint.print(_value._valueInt);
+    aWriter.value((long)_value._valueInt);
     break;
   case DATASTREAM_FLOAT:
-    count += aPrint.print(_value._valueFloat);
+    aWriter.value(_value._valueFloat);
     break;
   };
-  count += aPrint.print("\" }");
-  return count;
+  aWriter.endDatastream();
 }
 
 #if 0
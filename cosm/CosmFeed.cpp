@@ -8,26 +8,23 @@ CosmFeed::CosmFeed(unsigned long aID, CosmDatastream* aDatastreams, int aDatastr
 
 size_t CosmFeed::printTo(Print& aPrint) const
 {
-  int len = 0;
-  len += aPrint.println("{");
-  len += aPrint.println("\"version\":\"1.0.0\",");
-  len += aPrint.println("\"datastreams\" : [");
+  return writeTo(&aPrint);
+}
+
+size_t CosmFeed::length() const
+{
+  return writeTo(NULL);
+}
+
+// With a NULL Print the FeedWriter only counts
+size_t CosmFeed::writeTo(Print* aOut) const
+{
+  FeedWriter writer(aOut, FEED_JSON);
+  writer.beginFeed();
   for (int j =0; j < _datastreamsCount; j++)
   {
-    len += aPrint.print(_datastreams[j]);
-    if (j == _datastreamsCount-1)
-    {
-      // Last time through
-      len += aPrint.println();
-    }
-    else
-    {
-      len += aPrint.println(",");
-    }
+    _datastreams[j].writeTo(writer);
   }
-  len += aPrint.println("]");
-  len += aPrint.println("}");
-  return len;
+  writer.endFeed();
+  return writer.count();
 }
-
-
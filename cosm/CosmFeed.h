@@ -12,10 +12,14 @@ public:
   CosmFeed(unsigned long aID, CosmDatastream* aDatastreams, int aDatastreamsCount);
 
   virtual size_t printTo(Print&) const;
+  // Number of bytes printTo() writes, worked out without printing
+  size_t length() const;
   unsigned long id() { return _id; };
   int size() { return _datastreamsCount; };
   CosmDatastream& operator[] (unsigned i) { return _datastreams[i]; };
 protected:
+  size_t writeTo(Print* aOut) const;
+
   unsigned long _id;
   CosmDatastream* _datastreams;
   int _datastreamsCount;
@@ -3,6 +3,7 @@
 #define XIVELYCLIENT_H
 
 #include <Client.h>
+#include <HttpClient.h>
 #include <XivelyFeed.h>
 
 class XivelyClient
@@ -13,12 +14,21 @@ public:
   int get(XivelyFeed& aFeed, const char* aApiKey);
   int put(XivelyFeed& aFeed, const char* aApiKey);
 
+  // Keep the connection to the server open between get()s and put()s,
+  // rather than connecting again each time.  Off by default
+  void setKeepAlive(bool aKeepAlive) { _http.setKeepAlive(aKeepAlive); };
+
+  // Send put()s with chunked transfer-encoding, so the feed is formatted
+  // once rather than first to find its Content-Length.  The server has
+  // to accept chunked request bodies.  Off by default
+  void setChunked(bool aChunked) { _chunked = aChunked; };
+
 protected:
-  static const int kCalculateDataLength =0;
-  static const int kSendData =1;
   void buildPath(char* aDest, unsigned long aFeedId, const char* aFormat);
 
   Client& _client;
+  HttpClient _http;
+  bool _chunked;
 };
 
 #endif
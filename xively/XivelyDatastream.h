@@ -3,6 +3,7 @@
 
 #include <Stream.h>
 #include <Printable.h>
+#include <FeedCodec.h>
 
 #define DATASTREAM_STRING 0
 #define DATASTREAM_BUFFER 1
@@ -11,6 +12,7 @@
 
 class XivelyDatastream : public Printable {
   friend class XivelyClient;
+  friend class XivelyFeed;
 
   typedef struct {
     char* _buffer;
@@ -22,6 +24,7 @@ public:
   XivelyDatastream(char* aIdBuffer, int aIdBufferLength, int aType);
   XivelyDatastream(char* aIdBuffer, int aIdBufferLength, int aType, char* aValueBuffer, int aValueBufferLength);
   int updateValue(Stream& aStream);
+  int updateValue(const char* aValue);
   void setInt(int aValue);
   void setFloat(float aValue);
   void setString(String& aValue);
@@ -32,8 +35,8 @@ public:
   char* getBuffer();
   virtual size_t printTo(Print&) const;
 protected:
-  int idLength() { return (_idType == DATASTREAM_STRING ? _idString.length() : strlen(_idBuffer._buffer)); };
-  char idChar(int idx) { return (_idType == DATASTREAM_STRING ? _idString[idx] : (idx > strlen(_idBuffer._buffer) ? '\0' : _idBuffer._buffer[idx])); };
+  bool hasId(const char* aId) { return (_idType == DATASTREAM_STRING ? _idString.equals(aId) : (strcmp(_idBuffer._buffer, aId) == 0)); };
+  void writeTo(FeedWriter& aWriter) const;
   // FIXME Only needed until readStringUntil is available in core
   int timedRead(Stream& aStream);
 
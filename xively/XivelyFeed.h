@@ -12,10 +12,14 @@ public:
   XivelyFeed(unsigned long aID, XivelyDatastream* aDatastreams, int aDatastreamsCount);
 
   virtual size_t printTo(Print&) const;
+  // Number of bytes printTo() writes, worked out without printing
+  size_t length() const;
   unsigned long id() { return _id; };
   int size() { return _datastreamsCount; };
   XivelyDatastream& operator[] (unsigned i) { return _datastreams[i]; };
 protected:
+  size_t writeTo(Print* aOut) const;
+
   unsigned long _id;
   XivelyDatastream* _datastreams;
   int _datastreamsCount;
@@ -1,6 +1,7 @@
 #include <SPI.h>
 #include <Ethernet.h>
 #include <HttpClient.h>
+#include <FeedCodec.h>
 #include <Xively.h>
 
 // MAC address for your Ethernet shield
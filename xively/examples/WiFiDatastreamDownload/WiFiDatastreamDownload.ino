@@ -1,6 +1,7 @@
 #include <SPI.h>
 #include <WiFi.h>
 #include <HttpClient.h>
+#include <FeedCodec.h>
 #include <Xively.h>
 
 char ssid[] = "YourNetwork"; //  your network SSID (name) 